@@ -13,6 +13,8 @@
  */
 #include "RuleRanger.h"
 #include "Logging/StructuredLog.h"
+#include "RuleRanger/RuleRangerMatcherResults.h"
+#include "RuleRanger/RuleRangerMatcherStats.h"
 #include "RuleRanger/UI/ContentBrowserExtension/RuleRangerContentBrowserExtensions.h"
 #include "RuleRanger/UI/RuleRangerCommands.h"
 #include "RuleRanger/UI/RuleRangerStyle.h"
@@ -31,6 +33,7 @@ const FName FRuleRangerModule::ModuleName{ TEXT("RuleRanger") };
 void FRuleRangerModule::StartupModule()
 {
     FRuleRangerMessageLog::Initialize();
+    FRuleRangerMatcherResults::Initialize();
 
     if (!IsRunningCommandlet())
     {
@@ -65,6 +68,8 @@ void FRuleRangerModule::ShutdownModule()
         FRuleRangerStyle::Shutdown();
     }
 
+    FRuleRangerMatcherStats::Get().Save();
+    FRuleRangerMatcherResults::Shutdown();
     FRuleRangerMessageLog::Shutdown();
 }
 
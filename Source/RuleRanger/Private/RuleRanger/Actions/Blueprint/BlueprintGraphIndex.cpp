@@ -0,0 +1,135 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "BlueprintGraphIndex.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_Event.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_FunctionResult.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+
+FRuleRangerBlueprintGraphIndex::FRuleRangerBlueprintGraphIndex(UObject* Object)
+    : Blueprint(CastChecked<UBlueprint>(Object))
+{
+    Blueprint->GetAllGraphs(AllGraphs);
+
+    for (const auto Graph : Blueprint->UbergraphPages)
+    {
+        if (Graph)
+        {
+            for (const auto Node : Graph->Nodes)
+            {
+                if (const auto EventNode = Cast<UK2Node_Event>(Node))
+                {
+                    UbergraphEventNodes.Add(EventNode);
+                }
+            }
+        }
+    }
+
+    Functions.Reserve(Blueprint->FunctionGraphs.Num());
+    for (const auto Graph : Blueprint->FunctionGraphs)
+    {
+        if (Graph)
+        {
+            FRuleRangerBlueprintFunction Function;
+            Function.Graph = Graph;
+            for (const auto Node : Graph->Nodes)
+            {
+                if (const auto FunctionEntry = Cast<UK2Node_FunctionEntry>(Node))
+                {
+                    if (!Function.FunctionEntry)
+                    {
+                        Function.FunctionEntry = FunctionEntry;
+                    }
+                }
+                else if (Node && Node->IsA<UK2Node_FunctionResult>())
+                {
+                    Function.ResultNodeCount++;
+                }
+            }
+            Functions.Add(Function);
+        }
+    }
+
+    for (const auto& Variable : Blueprint->NewVariables)
+    {
+        if (!FBlueprintEditorUtils::IsVariableComponent(Variable))
+        {
+            NonComponentVariableCount++;
+        }
+    }
+}
+
+FName FRuleRangerBlueprintGraphIndex::GetAnalysisName()
+{
+    static const FName AnalysisName(TEXT("BlueprintGraphIndex"));
+    return AnalysisName;
+}
+
+const FRuleRangerBlueprintFunction* FRuleRangerBlueprintGraphIndex::FindFunction(const UEdGraph* Graph) const
+{
+    return Functions.FindByPredicate([Graph](const auto& Function) { return Function.Graph == Graph; });
+}
+
+const TArray<FRuleRangerBlueprintNodeLinks>& FRuleRangerBlueprintGraphIndex::GetNodeLinks() const
+{
+    if (!bNodeLinksComputed)
+    {
+        bNodeLinksComputed = true;
+        for (const auto Graph : AllGraphs)
+        {
+            for (const auto Node : Graph->Nodes)
+            {
+                if (!Node)
+                {
+                    continue;
+                }
+                FRuleRangerBlueprintNodeLinks Links;
+                Links.Graph = Graph;
+                Links.Node = Node;
+                for (const auto Pin : Node->GetAllPins())
+                {
+                    // Exec pins in ControlRig are identified by name rather than by pin category
+                    const bool bIsExecPin =
+                        UEdGraphSchema_K2::IsExecPin(*Pin) || Pin->GetName().EndsWith(TEXT(".ExecuteContext"));
+                    if (bIsExecPin)
+                    {
+                        const bool bPinLinked = 0 != Pin->LinkedTo.Num();
+                        if (EGPD_Input == Pin->Direction)
+                        {
+                            if (bPinLinked)
+                            {
+                                // Some nodes have multiple Input Exec pins (i.e. Timeline node).
+                                // As long as at least one is connected then we consider the node used
+                                // so we also track the count that are linked
+                                Links.InputExecLinkCount++;
+                            }
+                            else
+                            {
+                                Links.bHasInputExecNotLinked = true;
+                            }
+                        }
+                        else if (EGPD_Output == Pin->Direction && !bPinLinked)
+                        {
+                            Links.bHasOutputExecNotLinked = true;
+                        }
+                    }
+                }
+                NodeLinks.Add(Links);
+            }
+        }
+    }
+    return NodeLinks;
+}
@@ -0,0 +1,105 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RuleRangerObjectAnalysis.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+class UK2Node_Event;
+class UK2Node_FunctionEntry;
+
+/**
+ * Summary of the exec pin links of a single node in a Blueprint graph.
+ */
+struct FRuleRangerBlueprintNodeLinks
+{
+    /** The graph containing the node. */
+    UEdGraph* Graph{ nullptr };
+
+    /** The node. */
+    UEdGraphNode* Node{ nullptr };
+
+    /** The number of input exec pins that are linked to another pin. */
+    int32 InputExecLinkCount{ 0 };
+
+    /** True if the node has at least one input exec pin that is not linked. */
+    bool bHasInputExecNotLinked{ false };
+
+    /** True if the node has at least one output exec pin that is not linked. */
+    bool bHasOutputExecNotLinked{ false };
+};
+
+/**
+ * A function graph in a Blueprint along with the nodes in the graph that are of interest to actions.
+ */
+struct FRuleRangerBlueprintFunction
+{
+    /** The function graph. */
+    UEdGraph* Graph{ nullptr };
+
+    /** The first function entry node in the graph or nullptr if the graph has no entry node. */
+    UK2Node_FunctionEntry* FunctionEntry{ nullptr };
+
+    /** The number of function result nodes in the graph. */
+    int32 ResultNodeCount{ 0 };
+};
+
+/**
+ * An index of the graphs, nodes and variables of a Blueprint.
+ * The index is built once per scan of a Blueprint and shared by the Blueprint actions so that each action
+ * does not need to walk every graph, node and pin of the Blueprint independently.
+ */
+class FRuleRangerBlueprintGraphIndex final : public FRuleRangerObjectAnalysis
+{
+public:
+    explicit FRuleRangerBlueprintGraphIndex(UObject* Object);
+
+    static FName GetAnalysisName();
+
+    FORCEINLINE UBlueprint* GetBlueprint() const { return Blueprint; }
+
+    /** Return every graph in the Blueprint including nested graphs. i.e. The result of UBlueprint::GetAllGraphs() */
+    FORCEINLINE const TArray<UEdGraph*>& GetAllGraphs() const { return AllGraphs; }
+
+    /** Return the event nodes that are directly contained in the ubergraph pages of the Blueprint. */
+    FORCEINLINE const TArray<UK2Node_Event*>& GetUbergraphEventNodes() const { return UbergraphEventNodes; }
+
+    /** Return the function graphs of the Blueprint in declaration order. */
+    FORCEINLINE const TArray<FRuleRangerBlueprintFunction>& GetFunctions() const { return Functions; }
+
+    /** Return the function for the specified function graph or nullptr if the graph is not a function graph. */
+    const FRuleRangerBlueprintFunction* FindFunction(const UEdGraph* Graph) const;
+
+    /** Return the number of Blueprint member variables that are not components. */
+    FORCEINLINE int32 GetNonComponentVariableCount() const { return NonComponentVariableCount; }
+
+    /**
+     * Return the exec pin link summary for every node in every graph of the Blueprint.
+     * The summaries are computed on first access as only some actions inspect pins.
+     */
+    const TArray<FRuleRangerBlueprintNodeLinks>& GetNodeLinks() const;
+
+private:
+    UBlueprint* Blueprint{ nullptr };
+    TArray<UEdGraph*> AllGraphs;
+    TArray<UK2Node_Event*> UbergraphEventNodes;
+    TArray<FRuleRangerBlueprintFunction> Functions;
+    int32 NonComponentVariableCount{ 0 };
+
+    mutable bool bNodeLinksComputed{ false };
+    mutable TArray<FRuleRangerBlueprintNodeLinks> NodeLinks;
+};
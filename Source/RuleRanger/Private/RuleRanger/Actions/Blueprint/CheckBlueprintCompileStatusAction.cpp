@@ -39,6 +39,8 @@ void UCheckBlueprintCompileStatusAction::Apply(URuleRangerActionContext* ActionC
             FBlueprintCompilationManager::FlushCompilationQueue(nullptr);
         }
         LogInfo(Object, FString::Printf(TEXT("Blueprint  compilation complete.")));
+        // Compilation may reconstruct nodes so any previously indexed graph data is stale
+        ActionContext->InvalidateObjectAnalyses();
     }
 
     switch (Blueprint->Status)
@@ -87,3 +89,30 @@ UClass* UCheckBlueprintCompileStatusAction::GetExpectedType() const
 {
     return UBlueprint::StaticClass();
 }
+
+bool UCheckBlueprintCompileStatusAction::ShouldPrepareForFix() const
+{
+    return true;
+}
+
+void UCheckBlueprintCompileStatusAction::PrepareForFix(const TConstArrayView<UObject*> Objects)
+{
+    int32 Count{ 0 };
+    for (const auto Object : Objects)
+    {
+        // ReSharper disable once CppTooWideScopeInitStatement
+        const auto Blueprint = Cast<UBlueprint>(Object);
+        if (Blueprint && (BS_Dirty == Blueprint->Status || BS_Unknown == Blueprint->Status)
+            && !Blueprint->bBeingCompiled)
+        {
+            FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+            Count++;
+        }
+    }
+    if (Count > 0)
+    {
+        LogInfo(FString::Printf(TEXT("Compiling %d Blueprint(s) before applying rules."), Count));
+        // Compile the whole batch and reinstance dependents once rather than compiling each Blueprint in Apply()
+        FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+    }
+}
@@ -14,6 +14,7 @@
 #include "EnsureBlueprintContainsNoUnlinkedNodesAction.h"
 #include "AnimGraphNode_TransitionResult.h"
 #include "AnimStateTransitionNode.h"
+#include "BlueprintGraphIndex.h"
 #include "EdGraphNode_Comment.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(EnsureBlueprintContainsNoUnlinkedNodesAction)
@@ -54,90 +55,40 @@ bool UEnsureBlueprintContainsNoUnlinkedNodesAction::ShouldHaveLinks(const TObjec
 
 void UEnsureBlueprintContainsNoUnlinkedNodesAction::Apply(URuleRangerActionContext* ActionContext, UObject* Object)
 {
-    const auto Blueprint = CastChecked<UBlueprint>(Object);
-    TArray<UEdGraph*> Graphs;
-    Blueprint->GetAllGraphs(Graphs);
-
-    for (const auto Graph : Graphs)
+    const auto& Index = ActionContext->GetObjectAnalysis<FRuleRangerBlueprintGraphIndex>(Object);
+    for (const auto& Links : Index.GetNodeLinks())
     {
-        for (const auto Node : Graph->Nodes)
+        const auto Node = Links.Node;
+        if ((Links.bHasInputExecNotLinked || Links.bHasOutputExecNotLinked) && ShouldHaveLinks(Node))
         {
-            if (ShouldHaveLinks(Node))
-            {
-                // If the node has no exec pins then it is pure and must have a
-                // consumer of one (Data) output pin. If a node is not pure then
-                // it must be connected by one input exec pin
-                bool bHasOutputExecPin = false;
-                bool bHasInputExecPin = false;
-                bool bHasInputPins = false;
-                bool bHasOutputPins = false;
-                bool bHasInputExecNotLinked = false;
-                bool bHasOutputExecNotLinked = false;
-                int32 InputExecLinkCount = 0;
-                for (const auto Pin : Node->GetAllPins())
-                {
-                    // Exec pins in controlRig are identified
-                    const bool bIsExecPin =
-                        UEdGraphSchema_K2::IsExecPin(*Pin) || Pin->GetName().EndsWith(TEXT(".ExecuteContext"));
-                    const bool bIsInputPin = EGPD_Input == Pin->Direction;
-                    const bool bIsOutputPin = EGPD_Output == Pin->Direction;
-                    const bool bPinLinked = 0 != Pin->LinkedTo.Num();
-                    bHasInputPins |= bIsInputPin;
-                    bHasOutputPins |= bIsOutputPin;
-                    bHasInputExecPin |= bIsInputPin && bIsExecPin;
-                    bHasOutputExecPin |= bIsOutputPin && bIsExecPin;
-                    if (bIsInputPin && bIsExecPin)
-                    {
-                        if (bPinLinked)
-                        {
-                            // Some nodes have multiple Input Exec pins (i.e. Timeline node).
-                            // As long as at least one is connected then we consider the node used
-                            // so we also track the count that are linked and use it later
-                            InputExecLinkCount++;
-                        }
-                        else
-                        {
-                            bHasInputExecNotLinked = true;
-                        }
-                    }
-                    else if (bIsOutputPin && bIsExecPin)
-                    {
-                        if (!bPinLinked)
-                        {
-                            bHasOutputExecNotLinked = true;
-                        }
-                    }
-                }
-
-                if (bHasInputExecNotLinked || bHasOutputExecNotLinked)
-                {
-                    const FString NodeTitle = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
-                    FGraphDisplayInfo Info;
-                    Graph->GetSchema()->GetGraphDisplayInformation(*Graph, Info);
-                    const FString GraphName = Info.DisplayName.ToString();
+            const auto Graph = Links.Graph;
+            const FString NodeTitle = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
+            FGraphDisplayInfo Info;
+            Graph->GetSchema()->GetGraphDisplayInformation(*Graph, Info);
+            const FString GraphName = Info.DisplayName.ToString();
 
-                    if (Node->IsAutomaticallyPlacedGhostNode())
-                    {
-                        ActionContext->Error(
-                            FText::Format(NSLOCTEXT("RuleRanger",
-                                                    "BlueprintLooseDefaultEvent",
-                                                    "Blueprint has a default event node named '{0}' in '{1}' "
-                                                    "with no outgoing links and bErrorOnLooseDefaultEvents=true. "
-                                                    "Remove event node or change bErrorOnLooseDefaultEvents to false."),
-                                          FText::FromString(NodeTitle),
-                                          FText::FromString(GraphName)));
-                    }
-                    else if (bHasInputExecNotLinked && 0 == InputExecLinkCount)
-                    {
-                        ActionContext->Error(
-                            FText::Format(NSLOCTEXT("RuleRanger",
-                                                    "BlueprintMissingExecInput",
-                                                    "Blueprint has a node named '{0}' in '{1}' "
-                                                    "missing an exec input pin. Remove node or connect pin."),
-                                          FText::FromString(NodeTitle),
-                                          FText::FromString(GraphName)));
-                    }
-                }
+            if (Node->IsAutomaticallyPlacedGhostNode())
+            {
+                ActionContext->Error(
+                    FText::Format(NSLOCTEXT("RuleRanger",
+                                            "BlueprintLooseDefaultEvent",
+                                            "Blueprint has a default event node named '{0}' in '{1}' "
+                                            "with no outgoing links and bErrorOnLooseDefaultEvents=true. "
+                                            "Remove event node or change bErrorOnLooseDefaultEvents to false."),
+                                  FText::FromString(NodeTitle),
+                                  FText::FromString(GraphName)));
+            }
+            else if (Links.bHasInputExecNotLinked && 0 == Links.InputExecLinkCount)
+            {
+                // Some nodes have multiple Input Exec pins (i.e. Timeline node).
+                // As long as at least one is connected then we consider the node used
+                ActionContext->Error(
+                    FText::Format(NSLOCTEXT("RuleRanger",
+                                            "BlueprintMissingExecInput",
+                                            "Blueprint has a node named '{0}' in '{1}' "
+                                            "missing an exec input pin. Remove node or connect pin."),
+                                  FText::FromString(NodeTitle),
+                                  FText::FromString(GraphName)));
             }
         }
     }
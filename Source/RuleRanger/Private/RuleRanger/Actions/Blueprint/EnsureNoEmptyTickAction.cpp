@@ -12,6 +12,7 @@
  * limitations under the License.
  */
 #include "EnsureNoEmptyTickAction.h"
+#include "BlueprintGraphIndex.h"
 #include "K2Node_Event.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(EnsureNoEmptyTickAction)
@@ -34,20 +35,14 @@ void UEnsureNoEmptyTickAction::Apply(URuleRangerActionContext* ActionContext, UO
 {
     static const FName EventTickName(TEXT("ReceiveTick"));
 
-    // ReSharper disable once CppTooWideScopeInitStatement
-    const UBlueprint* Blueprint = CastChecked<UBlueprint>(Object);
-    for (const auto Graph : Blueprint->UbergraphPages)
+    const auto& Index = ActionContext->GetObjectAnalysis<FRuleRangerBlueprintGraphIndex>(Object);
+    for (const auto EventNode : Index.GetUbergraphEventNodes())
     {
-        for (auto Node : Graph->Nodes)
+        if (EventTickName == EventNode->EventReference.GetMemberName() && IsEmptyTick(EventNode))
         {
-            // ReSharper disable once CppTooWideScopeInitStatement
-            const auto EventNode = Cast<UK2Node_Event>(Node);
-            if (EventNode && EventTickName == EventNode->EventReference.GetMemberName() && IsEmptyTick(EventNode))
-            {
-                ActionContext->Error(FText::FromString(TEXT("Blueprint has a Tick with no output pins connected. "
-                                                            "This node still ticks (in < 5.6) and results in "
-                                                            "unnecessary overhead. Please use or remove it.")));
-            }
+            ActionContext->Error(FText::FromString(TEXT("Blueprint has a Tick with no output pins connected. "
+                                                        "This node still ticks (in < 5.6) and results in "
+                                                        "unnecessary overhead. Please use or remove it.")));
         }
     }
 }
@@ -12,6 +12,7 @@
  * limitations under the License.
  */
 #include "BlueprintFunctionActionBase.h"
+#include "RuleRanger/Actions/Blueprint/BlueprintGraphIndex.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BlueprintFunctionActionBase)
 
@@ -61,23 +62,19 @@ void UBlueprintFunctionActionBase::Apply(URuleRangerActionContext* ActionContext
     {
         TArray<UEdGraph*> Graphs;
         TArray<UK2Node_FunctionEntry*> Functions;
+        const auto& Index = ActionContext->GetObjectAnalysis<FRuleRangerBlueprintGraphIndex>(Object);
         // For all the function graphs that are not construction scripts
-        for (const auto Graph : Blueprint->FunctionGraphs)
+        for (const auto& Function : Index.GetFunctions())
         {
+            const auto Graph = Function.Graph;
             if (ShouldAnalyzeGraph(Blueprint, Graph))
             {
-                TArray<UK2Node_FunctionEntry*> EntryNodes;
-                Graph->GetNodesOfClass(EntryNodes);
-
-                if ((EntryNodes.Num() > 0) && EntryNodes[0]->IsEditable())
+                if (const auto FunctionEntry = Function.FunctionEntry)
                 {
-                    if (const auto FunctionEntry = EntryNodes[0])
+                    if (FunctionEntry->IsEditable() && ShouldAnalyzeFunction(Blueprint, FunctionEntry))
                     {
-                        if (ShouldAnalyzeFunction(Blueprint, FunctionEntry))
-                        {
-                            Graphs.Add(Graph);
-                            Functions.Add(FunctionEntry);
-                        }
+                        Graphs.Add(Graph);
+                        Functions.Add(FunctionEntry);
                     }
                 }
             }
@@ -13,7 +13,7 @@
  */
 #include "EnsureFunctionsReturnAction.h"
 #include "K2Node_FunctionEntry.h"
-#include "K2Node_FunctionResult.h"
+#include "RuleRanger/Actions/Blueprint/BlueprintGraphIndex.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(EnsureFunctionsReturnAction)
 
@@ -27,10 +27,10 @@ void UEnsureFunctionsReturnAction::AnalyzeFunction(URuleRangerActionContext* Act
                                                    UK2Node_FunctionEntry* FunctionEntry,
                                                    UEdGraph* Graph)
 {
-    // Find the list of result nodes
-    TArray<UK2Node_FunctionResult*> ResultNodes;
-    Graph->GetNodesOfClass(ResultNodes);
-    if (ResultNodes.Num() <= 0)
+    // ReSharper disable once CppTooWideScopeInitStatement
+    const auto Function =
+        ActionContext->GetObjectAnalysis<FRuleRangerBlueprintGraphIndex>(Blueprint).FindFunction(Graph);
+    if (!Function || Function->ResultNodeCount <= 0)
     {
         const auto& ErrorMessage =
             FString::Printf(TEXT("Blueprint contains a function named '%s' that is missing a return node."),
@@ -13,6 +13,7 @@
  */
 #include "BlueprintVariableActionBase.h"
 #include "K2Node_FunctionEntry.h"
+#include "RuleRanger/Actions/Blueprint/BlueprintGraphIndex.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BlueprintVariableActionBase)
 
@@ -62,18 +63,16 @@ void UBlueprintVariableActionBase::Apply(URuleRangerActionContext* ActionContext
             }
         }
         // For all the function graphs that are not construction scripts
-        for (const auto Graph : Blueprint->FunctionGraphs)
+        const auto& Index = ActionContext->GetObjectAnalysis<FRuleRangerBlueprintGraphIndex>(Object);
+        for (const auto& Function : Index.GetFunctions())
         {
-            TArray<UK2Node_FunctionEntry*> EntryNodes;
-            Graph->GetNodesOfClass(EntryNodes);
-
-            if ((EntryNodes.Num() > 0) && EntryNodes[0]->IsEditable() && ShouldAnalyzeFunction(Graph, EntryNodes[0]))
+            // ReSharper disable once CppTooWideScopeInitStatement
+            const auto FunctionEntry = Function.FunctionEntry;
+            if (FunctionEntry && FunctionEntry->IsEditable() && ShouldAnalyzeFunction(Function.Graph, FunctionEntry))
             {
-                // ReSharper disable once CppTooWideScopeInitStatement
-                const auto FunctionEntry = EntryNodes[0];
                 for (auto& Variable : FunctionEntry->LocalVariables)
                 {
-                    AnalyzeVariable(ActionContext, Blueprint, Variable, FunctionEntry, Graph);
+                    AnalyzeVariable(ActionContext, Blueprint, Variable, FunctionEntry, Function.Graph);
                 }
             }
         }
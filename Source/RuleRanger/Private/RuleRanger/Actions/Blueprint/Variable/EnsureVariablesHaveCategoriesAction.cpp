@@ -14,6 +14,7 @@
 #include "EnsureVariablesHaveCategoriesAction.h"
 #include "K2Node_FunctionEntry.h"
 #include "Kismet2/BlueprintEditorUtils.h"
+#include "RuleRanger/Actions/Blueprint/BlueprintGraphIndex.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(EnsureVariablesHaveCategoriesAction)
 
@@ -78,15 +79,10 @@ void UEnsureVariablesHaveCategoriesAction::AnalyzeVariable(URuleRangerActionCont
         // Processing Blueprint Variable
         if (Blueprint->NewVariables.Num() >= Threshold)
         {
-            int32 VariableCount = Blueprint->NewVariables.Num();
-            for (FBPVariableDescription Desc : Blueprint->NewVariables)
-            {
-                // Ignore components
-                if (FBlueprintEditorUtils::IsVariableComponent(Desc))
-                {
-                    VariableCount--;
-                }
-            }
+            // Ignore components
+            const int32 VariableCount =
+                ActionContext->GetObjectAnalysis<FRuleRangerBlueprintGraphIndex>(Blueprint)
+                    .GetNonComponentVariableCount();
             if (VariableCount >= Threshold)
             {
                 if (Variable.Category.ToString().Equals(TEXT("Default")))
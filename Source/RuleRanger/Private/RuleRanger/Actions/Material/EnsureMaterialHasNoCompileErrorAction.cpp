@@ -12,9 +12,18 @@
  * limitations under the License.
  */
 #include "EnsureMaterialHasNoCompileErrorAction.h"
+#include "MaterialShared.h"
+#include "Materials/Material.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(EnsureMaterialHasNoCompileErrorAction)
 
+ERHIFeatureLevel::Type UEnsureMaterialHasNoCompileErrorAction::GetNativeFeatureLevel() const
+{
+    return EFeatureLevel::SM6 == FeatureLevel ? ERHIFeatureLevel::SM6
+        : EFeatureLevel::SM5 == FeatureLevel  ? ERHIFeatureLevel::SM5
+                                              : ERHIFeatureLevel::ES3_1;
+}
+
 void UEnsureMaterialHasNoCompileErrorAction::Apply(URuleRangerActionContext* ActionContext, UObject* Object)
 {
     // ReSharper disable once CppTooWideScopeInitStatement
@@ -25,10 +34,15 @@ void UEnsureMaterialHasNoCompileErrorAction::Apply(URuleRangerActionContext* Act
                             *Material->GetName(),
                             *StaticEnum<EFeatureLevel>()->GetDisplayNameText().ToString()));
 
-    // ReSharper disable once CppTooWideScopeInitStatement
-    const auto NativeFeatureLevel = EFeatureLevel::SM6 == FeatureLevel ? ERHIFeatureLevel::SM6
-        : EFeatureLevel::SM5 == FeatureLevel                           ? ERHIFeatureLevel::SM5
-                                                                       : ERHIFeatureLevel::ES3_1;
+    const auto NativeFeatureLevel = GetNativeFeatureLevel();
+    const auto Resource = Material->GetMaterialResource(NativeFeatureLevel);
+    if (IsRunningCommandlet() && Resource && !Resource->IsCompilationFinished())
+    {
+        // The commandlet does not wait for all shaders to compile before scanning,
+        // so wait for the shaders of this Material before checking the compile status
+        LogInfo(Material, TEXT("Waiting for Material shader compilation to complete."));
+        Resource->FinishCompilation();
+    }
 
     if (Material->IsCompilingOrHadCompileError(NativeFeatureLevel))
     {
@@ -47,16 +61,19 @@ void UEnsureMaterialHasNoCompileErrorAction::Apply(URuleRangerActionContext* Act
                                          "bErrorIfEmpty is set to false on the action  so ignoring this scenario.")));
             }
         }
-        else if (IsRunningCommandlet())
-        {
-            LogInfo(Material,
-                    FString::Printf(TEXT("Material compilation check is skipped when running in "
-                                         "Commandlet. (Unable to figure out how to make it work reliably)")));
-        }
         else
         {
             ActionContext->Error(
                 FText::FromString(TEXT("Material is compiling or had a compile error. Please rectify the error.")));
+            if (Resource)
+            {
+                for (const auto& CompileError : Resource->GetCompileErrors())
+                {
+                    ActionContext->Error(FText::Format(
+                        NSLOCTEXT("RuleRanger", "MaterialCompileError", "Material compile error: {0}"),
+                        FText::FromString(CompileError)));
+                }
+            }
         }
     }
     else
@@ -15,6 +15,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "RHIFeatureLevel.h"
 #include "RuleRangerAction.h"
 #include "EnsureMaterialHasNoCompileErrorAction.generated.h"
 
@@ -63,6 +64,9 @@ class UEnsureMaterialHasNoCompileErrorAction final : public URuleRangerAction
     bool bErrorIfEmpty{ true };
 
 public:
+    /** Return the RHI feature level that the Material is checked against. */
+    ERHIFeatureLevel::Type GetNativeFeatureLevel() const;
+
     virtual void Apply(URuleRangerActionContext* ActionContext, UObject* Object) override;
 
     virtual UClass* GetExpectedType() const override;
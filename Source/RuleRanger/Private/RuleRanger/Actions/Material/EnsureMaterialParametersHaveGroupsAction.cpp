@@ -38,7 +38,7 @@ void UEnsureMaterialParametersHaveGroupsAction::AnalyzeParameter(URuleRangerActi
 bool UEnsureMaterialParametersHaveGroupsAction::ShouldAnalyzeParameters(
     URuleRangerActionContext* ActionContext,
     const UMaterial* const Material,
-    const TMap<FMaterialParameterInfo, FMaterialParameterMetadata>& Parameters) const
+    TConstArrayView<FRuleRangerMaterialParameter> Parameters) const
 {
     const int32 ParameterCount = Parameters.Num();
     const bool bAnalyze = ParameterCount >= Threshold;
@@ -36,8 +36,7 @@ protected:
                                   const UMaterial* Material,
                                   const FMaterialParameterInfo& Info,
                                   const FMaterialParameterMetadata& Metadata) const override;
-    virtual bool
-    ShouldAnalyzeParameters(URuleRangerActionContext* ActionContext,
-                            const UMaterial* const Material,
-                            const TMap<FMaterialParameterInfo, FMaterialParameterMetadata>& Parameters) const override;
+    virtual bool ShouldAnalyzeParameters(URuleRangerActionContext* ActionContext,
+                                         const UMaterial* const Material,
+                                         TConstArrayView<FRuleRangerMaterialParameter> Parameters) const override;
 };
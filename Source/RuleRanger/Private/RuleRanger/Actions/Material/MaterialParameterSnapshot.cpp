@@ -0,0 +1,88 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "MaterialParameterSnapshot.h"
+#include "Algo/StableSort.h"
+#include "Materials/Material.h"
+
+static bool IsMaterialParameterInfoLess(const FMaterialParameterInfo& A, const FMaterialParameterInfo& B)
+{
+    if (A.Name != B.Name)
+    {
+        return A.Name.LexicalLess(B.Name);
+    }
+    else if (A.Association != B.Association)
+    {
+        return A.Association < B.Association;
+    }
+    else
+    {
+        return A.Index < B.Index;
+    }
+}
+
+FRuleRangerMaterialParameterSnapshot::FRuleRangerMaterialParameterSnapshot(UObject* Object)
+{
+    const auto Material = CastChecked<UMaterial>(Object);
+
+    static const EMaterialParameterType ParameterTypes[] = { EMaterialParameterType::Scalar,
+                                                             EMaterialParameterType::Vector,
+                                                             EMaterialParameterType::DoubleVector,
+                                                             EMaterialParameterType::Texture,
+                                                             EMaterialParameterType::Font,
+                                                             EMaterialParameterType::RuntimeVirtualTexture,
+                                                             EMaterialParameterType::SparseVolumeTexture,
+                                                             EMaterialParameterType::StaticSwitch,
+                                                             EMaterialParameterType::StaticComponentMask };
+
+    TMap<FMaterialParameterInfo, FMaterialParameterMetadata> TypeParameters;
+    for (const auto ParameterType : ParameterTypes)
+    {
+        Material->GetAllParametersOfType(ParameterType, TypeParameters);
+        for (auto& Pair : TypeParameters)
+        {
+            Parameters.Add({ Pair.Key, MoveTemp(Pair.Value) });
+        }
+    }
+
+    // When a parameter appears for multiple types the entry from the last type is retained
+    SortAndRemoveDuplicates(Parameters);
+}
+
+void FRuleRangerMaterialParameterSnapshot::SortAndRemoveDuplicates(
+    TArray<FRuleRangerMaterialParameter>& InOutParameters)
+{
+    // Stable sort so that duplicates remain in the order they were added and the last one can be retained
+    Algo::StableSort(InOutParameters,
+                     [](const auto& A, const auto& B) { return IsMaterialParameterInfoLess(A.Info, B.Info); });
+    int32 OutIndex = 0;
+    for (int32 i = 0; i < InOutParameters.Num(); i++)
+    {
+        if (i + 1 < InOutParameters.Num() && InOutParameters[i].Info == InOutParameters[i + 1].Info)
+        {
+            continue;
+        }
+        if (OutIndex != i)
+        {
+            InOutParameters[OutIndex] = MoveTemp(InOutParameters[i]);
+        }
+        OutIndex++;
+    }
+    InOutParameters.SetNum(OutIndex);
+}
+
+FName FRuleRangerMaterialParameterSnapshot::GetAnalysisName()
+{
+    static const FName AnalysisName(TEXT("MaterialParameterSnapshot"));
+    return AnalysisName;
+}
@@ -0,0 +1,55 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MaterialTypes.h"
+#include "RuleRangerObjectAnalysis.h"
+
+class UMaterial;
+
+/**
+ * A parameter defined in a Material.
+ */
+struct FRuleRangerMaterialParameter
+{
+    FMaterialParameterInfo Info;
+    FMaterialParameterMetadata Metadata;
+};
+
+/**
+ * A snapshot of the parameters of every type defined in a Material.
+ * The snapshot is gathered once per scan of a Material and shared by the Material parameter actions.
+ * The parameters are stored in a flat array sorted by parameter name, association and index.
+ */
+class FRuleRangerMaterialParameterSnapshot final : public FRuleRangerObjectAnalysis
+{
+public:
+    explicit FRuleRangerMaterialParameterSnapshot(UObject* Object);
+
+    static FName GetAnalysisName();
+
+    FORCEINLINE TConstArrayView<FRuleRangerMaterialParameter> GetParameters() const { return Parameters; }
+
+    /**
+     * Sort the parameters by parameter name, association and index and remove duplicates.
+     * When the same parameter appears multiple times, the entry that was added last is retained.
+     *
+     * @param InOutParameters the parameters in the order they were gathered.
+     */
+    static void SortAndRemoveDuplicates(TArray<FRuleRangerMaterialParameter>& InOutParameters);
+
+private:
+    TArray<FRuleRangerMaterialParameter> Parameters;
+};
@@ -26,13 +26,13 @@ void UMaterialParametersActionBase::AnalyzeParameter(URuleRangerActionContext* A
 void UMaterialParametersActionBase::AnalyzeParameters(
     URuleRangerActionContext* ActionContext,
     const UMaterial* const Material,
-    const TMap<FMaterialParameterInfo, FMaterialParameterMetadata>& Parameters) const
+    TConstArrayView<FRuleRangerMaterialParameter> Parameters) const
 {
     if (ShouldAnalyzeParameters(ActionContext, Material, Parameters))
     {
-        for (const auto& Pair : Parameters)
+        for (const auto& Parameter : Parameters)
         {
-            AnalyzeParameter(ActionContext, Material, Pair.Key, Pair.Value);
+            AnalyzeParameter(ActionContext, Material, Parameter.Info, Parameter.Metadata);
         }
     }
 }
@@ -40,7 +40,7 @@ void UMaterialParametersActionBase::AnalyzeParameters(
 bool UMaterialParametersActionBase::ShouldAnalyzeParameters(
     URuleRangerActionContext* ActionContext,
     const UMaterial* const Material,
-    const TMap<FMaterialParameterInfo, FMaterialParameterMetadata>& Parameters) const
+    TConstArrayView<FRuleRangerMaterialParameter> Parameters) const
 {
     return true;
 }
@@ -52,37 +52,8 @@ void UMaterialParametersActionBase::Apply(URuleRangerActionContext* ActionContex
 
     LogInfo(Material, FString::Printf(TEXT("Processing Material named '%s'."), *Material->GetName()));
 
-    TMap<FMaterialParameterInfo, FMaterialParameterMetadata> AllParameters;
-    TMap<FMaterialParameterInfo, FMaterialParameterMetadata> Parameters;
-
-    Material->GetAllParametersOfType(EMaterialParameterType::Scalar, Parameters);
-    AllParameters.Append(Parameters);
-
-    Material->GetAllParametersOfType(EMaterialParameterType::Vector, Parameters);
-    AllParameters.Append(Parameters);
-
-    Material->GetAllParametersOfType(EMaterialParameterType::DoubleVector, Parameters);
-    AllParameters.Append(Parameters);
-
-    Material->GetAllParametersOfType(EMaterialParameterType::Texture, Parameters);
-    AllParameters.Append(Parameters);
-
-    Material->GetAllParametersOfType(EMaterialParameterType::Font, Parameters);
-    AllParameters.Append(Parameters);
-
-    Material->GetAllParametersOfType(EMaterialParameterType::RuntimeVirtualTexture, Parameters);
-    AllParameters.Append(Parameters);
-
-    Material->GetAllParametersOfType(EMaterialParameterType::SparseVolumeTexture, Parameters);
-    AllParameters.Append(Parameters);
-
-    Material->GetAllParametersOfType(EMaterialParameterType::StaticSwitch, Parameters);
-    AllParameters.Append(Parameters);
-
-    Material->GetAllParametersOfType(EMaterialParameterType::StaticComponentMask, Parameters);
-    AllParameters.Append(Parameters);
-
-    AnalyzeParameters(ActionContext, Material, AllParameters);
+    const auto& Snapshot = ActionContext->GetObjectAnalysis<FRuleRangerMaterialParameterSnapshot>(Object);
+    AnalyzeParameters(ActionContext, Material, Snapshot.GetParameters());
 }
 
 UClass* UMaterialParametersActionBase::GetExpectedType() const
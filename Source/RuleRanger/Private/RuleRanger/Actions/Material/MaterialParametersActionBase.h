@@ -15,6 +15,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "MaterialParameterSnapshot.h"
 #include "RuleRangerAction.h"
 #include "MaterialParametersActionBase.generated.h"
 
@@ -28,13 +29,12 @@ class UMaterialParametersActionBase : public URuleRangerAction
 
     void AnalyzeParameters(URuleRangerActionContext* ActionContext,
                            const UMaterial* const Material,
-                           const TMap<FMaterialParameterInfo, FMaterialParameterMetadata>& Parameters) const;
+                           TConstArrayView<FRuleRangerMaterialParameter> Parameters) const;
 
 protected:
-    virtual bool
-    ShouldAnalyzeParameters(URuleRangerActionContext* ActionContext,
-                            const UMaterial* const Material,
-                            const TMap<FMaterialParameterInfo, FMaterialParameterMetadata>& Parameters) const;
+    virtual bool ShouldAnalyzeParameters(URuleRangerActionContext* ActionContext,
+                                         const UMaterial* const Material,
+                                         TConstArrayView<FRuleRangerMaterialParameter> Parameters) const;
 
     virtual void AnalyzeParameter(URuleRangerActionContext* ActionContext,
                                   const UMaterial* Material,
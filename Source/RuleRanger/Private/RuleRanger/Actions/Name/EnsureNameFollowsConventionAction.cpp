@@ -89,7 +89,7 @@ void UEnsureNameFollowsConventionAction::Apply(URuleRangerActionContext* ActionC
     const auto Subsystem = GEditor->GetEditorSubsystem<UEditorAssetSubsystem>();
     const auto Variant = Subsystem ? Subsystem->GetMetadataTag(Object, NAME_RuleRanger_Variant) : TEXT("");
 
-    const FString OriginalName{ Object->GetName() };
+    const FString OriginalName{ FRuleRangerUtilities::GetPendingAssetName(Object) };
 
     FString NewName{ OriginalName };
 
@@ -234,6 +234,7 @@ void UEnsureNameFollowsConventionAction::Apply(URuleRangerActionContext* ActionC
                                                 Arguments);
 
             ActionContext->Warning(Message);
+            FRuleRangerUtilities::RecordPlannedRename(Object, NewName);
         }
         else if (!Object->IsAsset())
         {
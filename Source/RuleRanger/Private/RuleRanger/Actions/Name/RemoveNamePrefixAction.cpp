@@ -26,7 +26,7 @@ void URemoveNamePrefixAction::Apply(URuleRangerActionContext* ActionContext, UOb
     else
     {
         // ReSharper disable once CppTooWideScopeInitStatement
-        const FString OriginalName{ Object->GetName() };
+        const FString OriginalName{ FRuleRangerUtilities::GetPendingAssetName(Object) };
         if (OriginalName.StartsWith(Prefix, bCaseSensitive ? ESearchCase::CaseSensitive : ESearchCase::IgnoreCase))
         {
             const FString NewName{ OriginalName.RightChop(Prefix.Len()) };
@@ -42,6 +42,7 @@ void URemoveNamePrefixAction::Apply(URuleRangerActionContext* ActionContext, UOb
                                                     Arguments);
 
                 ActionContext->Warning(Message);
+                FRuleRangerUtilities::RecordPlannedRename(Object, NewName);
             }
             else
             {
@@ -26,7 +26,7 @@ void URemoveNameSuffixAction::Apply(URuleRangerActionContext* ActionContext, UOb
     else
     {
         // ReSharper disable once CppTooWideScopeInitStatement
-        const FString OriginalName{ Object->GetName() };
+        const FString OriginalName{ FRuleRangerUtilities::GetPendingAssetName(Object) };
         if (OriginalName.EndsWith(Suffix, bCaseSensitive ? ESearchCase::CaseSensitive : ESearchCase::IgnoreCase))
         {
             const FString NewName{ OriginalName.LeftChop(Suffix.Len()) };
@@ -42,6 +42,7 @@ void URemoveNameSuffixAction::Apply(URuleRangerActionContext* ActionContext, UOb
                                                     Arguments);
 
                 ActionContext->Warning(Message);
+                FRuleRangerUtilities::RecordPlannedRename(Object, NewName);
             }
             else
             {
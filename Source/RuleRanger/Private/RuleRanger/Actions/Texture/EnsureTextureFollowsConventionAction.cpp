@@ -477,7 +477,7 @@ void UEnsureTextureFollowsConventionAction::PerformTextureCompressionCheck(
 
 FName UEnsureTextureFollowsConventionAction::FindVariantBySuffix(const UTexture2D* Texture)
 {
-    const FString OriginalName{ Texture->GetName() };
+    const FString OriginalName{ FRuleRangerUtilities::GetPendingAssetName(Texture) };
 
     TArray<FName> Keys;
     ConventionsCache.GetKeys(Keys);
@@ -562,7 +562,7 @@ void UEnsureTextureFollowsConventionAction::PerformNameSuffixCheck(URuleRangerAc
                                                                    const FRuleRangerTextureConvention* const Convention)
 {
     // ReSharper disable once CppTooWideScopeInitStatement
-    const FString OriginalName{ Texture->GetName() };
+    const FString OriginalName{ FRuleRangerUtilities::GetPendingAssetName(Texture) };
     if (!Convention->Suffix.IsEmpty() && !OriginalName.EndsWith(Convention->Suffix, ESearchCase::CaseSensitive))
     {
         const FString NewName{ FString::Printf(TEXT("%s%s"), *OriginalName, *Convention->Suffix) };
@@ -578,6 +578,7 @@ void UEnsureTextureFollowsConventionAction::PerformNameSuffixCheck(URuleRangerAc
                                                 Arguments);
 
             ActionContext->Warning(Message);
+            FRuleRangerUtilities::RecordPlannedRename(Texture, NewName);
         }
         else
         {
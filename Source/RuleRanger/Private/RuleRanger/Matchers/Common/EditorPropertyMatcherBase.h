@@ -38,4 +38,5 @@ protected:
 
 public:
     virtual bool Test(UObject* Object) const override;
+    virtual bool IsSideEffectFree() const override { return true; }
 };
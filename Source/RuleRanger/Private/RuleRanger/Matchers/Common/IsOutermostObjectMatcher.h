@@ -27,4 +27,5 @@ class UIsOutermostObjectMatcher final : public URuleRangerMatcher
 
 public:
     virtual bool Test(UObject* Object) const override;
+    virtual bool IsSideEffectFree() const override { return true; }
 };
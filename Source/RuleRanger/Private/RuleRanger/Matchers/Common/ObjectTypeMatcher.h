@@ -35,4 +35,5 @@ class UObjectTypeMatcher final : public URuleRangerMatcher
 
 public:
     virtual bool Test(UObject* Object) const override;
+    virtual bool IsSideEffectFree() const override { return true; }
 };
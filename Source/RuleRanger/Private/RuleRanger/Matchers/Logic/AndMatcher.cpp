@@ -12,6 +12,8 @@
  * limitations under the License.
  */
 #include "AndMatcher.h"
+#include "RuleRanger/RuleRangerMatcherResults.h"
+#include "RuleRanger/RuleRangerMatcherStats.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AndMatcher)
 
@@ -19,11 +21,13 @@ bool UAndMatcher::Test(UObject* Object) const
 {
     if (IsValid(Object))
     {
-        for (int32 i = 0; i < Matchers.Num(); i++)
+        TArray<int32, TInlineAllocator<8>> Order;
+        FRuleRangerMatcherStats::Get().GetEvaluationOrder(this, Matchers, true, bPinMatcherOrder, Order);
+        for (const auto i : Order)
         {
             if (auto Matcher = Matchers[i]; IsValid(Matcher))
             {
-                if (!Matcher->Test(Object))
+                if (!FRuleRangerMatcherResults::Test(Matcher, Object))
                 {
                     return false;
                 }
@@ -32,3 +36,15 @@ bool UAndMatcher::Test(UObject* Object) const
     }
     return true;
 }
+
+bool UAndMatcher::IsSideEffectFree() const
+{
+    for (const auto Matcher : Matchers)
+    {
+        if (IsValid(Matcher) && !Matcher->IsSideEffectFree())
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -30,6 +30,14 @@ class UAndMatcher final : public URuleRangerMatcher
     UPROPERTY(Instanced, EditAnywhere, meta = (AllowAbstract = "false", ForceShowPluginContent = "true"))
     TArray<TObjectPtr<URuleRangerMatcher>> Matchers;
 
+    /**
+     * Should the matchers always be evaluated in the authored order?
+     * Otherwise the matchers that are cheap and most likely to not match are evaluated first.
+     */
+    UPROPERTY(EditAnywhere)
+    bool bPinMatcherOrder{ false };
+
 public:
     virtual bool Test(UObject* Object) const override;
+    virtual bool IsSideEffectFree() const override;
 };
@@ -12,10 +12,16 @@
  * limitations under the License.
  */
 #include "NotMatcher.h"
+#include "RuleRanger/RuleRangerMatcherResults.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(NotMatcher)
 
 bool UNotMatcher::Test(UObject* Object) const
 {
-    return IsValid(Object) && IsValid(Matcher) && !Matcher->Test(Object);
+    return IsValid(Object) && IsValid(Matcher) && !FRuleRangerMatcherResults::Test(Matcher, Object);
+}
+
+bool UNotMatcher::IsSideEffectFree() const
+{
+    return !IsValid(Matcher) || Matcher->IsSideEffectFree();
 }
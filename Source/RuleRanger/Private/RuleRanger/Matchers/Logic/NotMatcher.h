@@ -32,4 +32,5 @@ class UNotMatcher final : public URuleRangerMatcher
 
 public:
     virtual bool Test(UObject* Object) const override;
+    virtual bool IsSideEffectFree() const override;
 };
@@ -12,6 +12,8 @@
  * limitations under the License.
  */
 #include "OrMatcher.h"
+#include "RuleRanger/RuleRangerMatcherResults.h"
+#include "RuleRanger/RuleRangerMatcherStats.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(OrMatcher)
 
@@ -19,11 +21,13 @@ bool UOrMatcher::Test(UObject* Object) const
 {
     if (IsValid(Object))
     {
-        for (int32 i = 0; i < Matchers.Num(); i++)
+        TArray<int32, TInlineAllocator<8>> Order;
+        FRuleRangerMatcherStats::Get().GetEvaluationOrder(this, Matchers, false, bPinMatcherOrder, Order);
+        for (const auto i : Order)
         {
             if (auto Matcher = Matchers[i]; IsValid(Matcher))
             {
-                if (Matcher->Test(Object))
+                if (FRuleRangerMatcherResults::Test(Matcher, Object))
                 {
                     return true;
                 }
@@ -32,3 +36,15 @@ bool UOrMatcher::Test(UObject* Object) const
     }
     return false;
 }
+
+bool UOrMatcher::IsSideEffectFree() const
+{
+    for (const auto Matcher : Matchers)
+    {
+        if (IsValid(Matcher) && !Matcher->IsSideEffectFree())
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -31,4 +31,5 @@ class UAutomaticallySetUsageInEditorMaterialMatcher final : public URuleRangerMa
 
 public:
     virtual bool Test(UObject* Object) const override;
+    virtual bool IsSideEffectFree() const override { return true; }
 };
@@ -31,4 +31,5 @@ class UFullyRoughMaterialMatcher final : public URuleRangerMatcher
 
 public:
     virtual bool Test(UObject* Object) const override;
+    virtual bool IsSideEffectFree() const override { return true; }
 };
@@ -13,6 +13,7 @@
  */
 #include "NameRegexMatcher.h"
 #include "Editor.h"
+#include "RuleRanger/RuleRangerUtilities.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(NameRegexMatcher)
 
@@ -20,6 +21,7 @@ bool UNameRegexMatcher::Test(UObject* Object) const
 {
     const FRegexPattern Pattern(RegexPattern,
                                 bCaseSensitive ? ERegexPatternFlags::None : ERegexPatternFlags::CaseInsensitive);
-    FRegexMatcher ElementRegexMatcher(Pattern, Object->GetName());
+    // The pending name includes any rename that an earlier action in the current batch has planned
+    FRegexMatcher ElementRegexMatcher(Pattern, FRuleRangerUtilities::GetPendingAssetName(Object));
     return ElementRegexMatcher.FindNext();
 }
@@ -13,10 +13,13 @@
  */
 #include "NameSuffixMatcher.h"
 #include "Editor.h"
+#include "RuleRanger/RuleRangerUtilities.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(NameSuffixMatcher)
 
 bool UNameSuffixMatcher::Test(UObject* Object) const
 {
-    return Object->GetName().EndsWith(Suffix, bCaseSensitive ? ESearchCase::CaseSensitive : ESearchCase::IgnoreCase);
+    // The pending name includes any rename that an earlier action in the current batch has planned
+    const auto Name = FRuleRangerUtilities::GetPendingAssetName(Object);
+    return Name.EndsWith(Suffix, bCaseSensitive ? ESearchCase::CaseSensitive : ESearchCase::IgnoreCase);
 }
@@ -34,4 +34,5 @@ public:
     bool bCaseSensitive{ true };
 
     virtual bool Test(UObject* Object) const override;
+    virtual bool IsSideEffectFree() const override { return true; }
 };
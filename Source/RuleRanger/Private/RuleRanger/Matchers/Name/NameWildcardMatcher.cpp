@@ -13,11 +13,13 @@
  */
 #include "NameWildcardMatcher.h"
 #include "Editor.h"
+#include "RuleRanger/RuleRangerUtilities.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(NameWildcardMatcher)
 
 bool UNameWildcardMatcher::Test(UObject* Object) const
 {
-    return Object->GetName().MatchesWildcard(WildcardPattern,
-                                             bCaseSensitive ? ESearchCase::CaseSensitive : ESearchCase::IgnoreCase);
+    // The pending name includes any rename that an earlier action in the current batch has planned
+    const auto Name = FRuleRangerUtilities::GetPendingAssetName(Object);
+    return Name.MatchesWildcard(WildcardPattern, bCaseSensitive ? ESearchCase::CaseSensitive : ESearchCase::IgnoreCase);
 }
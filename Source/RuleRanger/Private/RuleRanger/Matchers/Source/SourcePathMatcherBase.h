@@ -27,6 +27,7 @@ class USourcePathMatcherBase : public URuleRangerMatcher
 
 public:
     virtual bool Test(UObject* Object) const override;
+    virtual bool IsSideEffectFree() const override { return true; }
 
 protected:
     /** A flag controlling whether matching is Case Sensitive or not. */
@@ -14,6 +14,7 @@
 
 #include "EnsureNoEmptyContentFoldersAction.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
 #include "HAL/FileManager.h"
 #include "HAL/PlatformFile.h"
 #include "Interfaces/IPluginManager.h"
@@ -97,64 +98,6 @@ namespace
             }
         }
     }
-
-    static void CollectAllSubdirectories(const FString& RootDir, TArray<FString>& OutDirs)
-    {
-        // Non-recursive stack-based traversal to collect every subdirectory under RootDir
-        TArray<FString> Pending;
-        Pending.Add(RootDir);
-
-        while (Pending.Num() > 0)
-        {
-            const auto Dir{ Pending.Pop(EAllowShrinking::No) };
-
-            // List immediate children; collect subdirectories
-            class FVisitor final : public IPlatformFile::FDirectoryVisitor
-            {
-            public:
-                TArray<FString>& PendingRef;
-                explicit FVisitor(TArray<FString>& InPending) : PendingRef(InPending) {}
-                virtual bool Visit(const TCHAR* FilenameOrDirectory, const bool bIsDirectory) override
-                {
-                    if (bIsDirectory)
-                    {
-                        PendingRef.Add(FilenameOrDirectory);
-                    }
-                    return true;
-                }
-            } Visitor(Pending);
-
-            IFileManager::Get().IterateDirectory(*Dir, Visitor);
-
-            if (Dir != RootDir)
-            {
-                OutDirs.Add(Dir);
-            }
-        }
-    }
-
-    static bool HasSubdirectories(const FString& Dir)
-    {
-        bool bHasSubdir = false;
-        class FVisitor final : public IPlatformFile::FDirectoryVisitor
-        {
-        public:
-            bool& bFoundRef;
-            explicit FVisitor(bool& InFound) : bFoundRef(InFound) {}
-            virtual bool Visit(const TCHAR* FilenameOrDirectory, const bool bIsDirectory) override
-            {
-                if (bIsDirectory)
-                {
-                    bFoundRef = true;
-                    return false; // early out
-                }
-                return true;
-            }
-        } Visitor(bHasSubdir);
-
-        IFileManager::Get().IterateDirectory(*Dir, Visitor);
-        return bHasSubdir;
-    }
 } // namespace
 
 UEnsureNoEmptyContentFoldersAction::UEnsureNoEmptyContentFoldersAction()
@@ -165,173 +108,151 @@ UEnsureNoEmptyContentFoldersAction::UEnsureNoEmptyContentFoldersAction()
 }
 
 void UEnsureNoEmptyContentFoldersAction::ProcessDirEntry(URuleRangerProjectActionContext* ActionContext,
-                                                         const IAssetRegistry& AssetRegistry,
-                                                         const FDirEntry& Dir)
+                                                         const TSet<FName>& PathsWithAssets,
+                                                         TArray<FDirEntry>& Tree,
+                                                         const int32 Index)
 {
-    // A folder may have been removed due to a prior deletion
     // If there are any subdirectories, this folder is compliant regardless of assets
-    if (IFileManager::Get().DirectoryExists(*Dir.FileSystemPath) && !HasSubdirectories(Dir.FileSystemPath))
+    const auto& Dir = Tree[Index];
+    if (0 == Dir.SubdirectoryCount && !PathsWithAssets.Contains(FName(Dir.MountPath)))
     {
-        // Check for at least one asset directly under this folder (non-recursive)
-        TArray<FAssetData> Assets;
-        AssetRegistry.GetAssetsByPath(*Dir.MountPath, Assets, /*bRecursive=*/false);
-
-        if (0 == Assets.Num())
+        const bool bHasFilesOnDisk = 0 != Dir.FileCount;
+        if (ActionContext->IsDryRun())
         {
-            const bool bHasFilesOnDisk = HasAnyFilesNonRecursive(Dir.FileSystemPath);
-            if (ActionContext->IsDryRun())
+            if (bHasFilesOnDisk)
             {
-                if (bHasFilesOnDisk)
-                {
-                    ActionContext->Error(FText::Format(NSLOCTEXT("RuleRanger",
-                                                                 "ContentFolderHasFilesButNoAssets",
-                                                                 "Content folder {0} has files on disk but no "
-                                                                 "registered assets."),
-                                                       FText::FromString(Dir.MountPath)));
-                }
-                else
-                {
-                    ActionContext->Error(
-                        FText::Format(NSLOCTEXT("RuleRanger",
-                                                "EmptyContentFolderDetected",
-                                                "Empty content folder detected: {0}. "
-                                                "Folder must contain at least one asset or have subfolders."),
-                                      FText::FromString(Dir.MountPath)));
-                }
+                ActionContext->Error(FText::Format(NSLOCTEXT("RuleRanger",
+                                                             "ContentFolderHasFilesButNoAssets",
+                                                             "Content folder {0} has files on disk but no "
+                                                             "registered assets."),
+                                                   FText::FromString(Dir.MountPath)));
             }
-            // Fix: only remove directory if there are no files present on the filesystem
-            else if (bHasFilesOnDisk)
+            else
             {
                 ActionContext->Error(
                     FText::Format(NSLOCTEXT("RuleRanger",
-                                            "CannotDeleteNonEmptyFolderOnDisk",
-                                            "Folder {0} has files on disk but no assets; cannot remove."),
+                                            "EmptyContentFolderDetected",
+                                            "Empty content folder detected: {0}. "
+                                            "Folder must contain at least one asset or have subfolders."),
                                   FText::FromString(Dir.MountPath)));
             }
-            // Attempt removal (should succeed for an empty directory)
-            else if (IFileManager::Get().DeleteDirectory(*Dir.FileSystemPath,
-                                                         /*RequireExists=*/false,
-                                                         /*Tree=*/false))
-            {
-                ActionContext->Info(
-                    FText::Format(NSLOCTEXT("RuleRanger", "DeletedEmptyFolder", "Deleted empty content folder {0}"),
-                                  FText::FromString(Dir.MountPath)));
-            }
-            else
-            {
-                ActionContext->Error(FText::Format(
-                    NSLOCTEXT("RuleRanger", "FailedToDeleteEmptyFolder", "Failed to delete empty content folder {0}"),
-                    FText::FromString(Dir.MountPath)));
-            }
         }
-    }
-}
-
-bool UEnsureNoEmptyContentFoldersAction::HasAnyFilesNonRecursive(const FString& Dir)
-{
-    bool bHasFile = false;
-    class FVisitor final : public IPlatformFile::FDirectoryVisitor
-    {
-    public:
-        bool& bFoundRef;
-        explicit FVisitor(bool& InFound) : bFoundRef(InFound) {}
-        virtual bool Visit(const TCHAR* FilenameOrDirectory, const bool bIsDirectory) override
+        // Fix: only remove directory if there are no files present on the filesystem
+        else if (bHasFilesOnDisk)
         {
-            if (!bIsDirectory)
+            ActionContext->Error(
+                FText::Format(NSLOCTEXT("RuleRanger",
+                                        "CannotDeleteNonEmptyFolderOnDisk",
+                                        "Folder {0} has files on disk but no assets; cannot remove."),
+                              FText::FromString(Dir.MountPath)));
+        }
+        // Attempt removal (should succeed for an empty directory)
+        else if (IFileManager::Get().DeleteDirectory(*Dir.FileSystemPath,
+                                                     /*RequireExists=*/false,
+                                                     /*Tree=*/false))
+        {
+            ActionContext->Info(
+                FText::Format(NSLOCTEXT("RuleRanger", "DeletedEmptyFolder", "Deleted empty content folder {0}"),
+                              FText::FromString(Dir.MountPath)));
+            // The parent is processed after its children so it is re-evaluated without the removed folder
+            if (INDEX_NONE != Dir.ParentIndex)
             {
-                bFoundRef = true;
-                return false;
+                Tree[Dir.ParentIndex].SubdirectoryCount--;
             }
-            return true;
         }
-    } Visitor(bHasFile);
-
-    IFileManager::Get().IterateDirectory(*Dir, Visitor);
-    return bHasFile;
-}
-
-FString UEnsureNoEmptyContentFoldersAction::DeriveMountPath(FString Rel, const FString& MountRoot)
-{
-    auto MountPath{ MountRoot };
-    if (!Rel.IsEmpty())
-    {
-        // Normalize directory name and join
-        FPaths::NormalizeDirectoryName(Rel);
-        Rel.ReplaceInline(TEXT("\\"), TEXT("/"));
-        Rel.RightChopInline(8, EAllowShrinking::No);
-        MountPath = MountRoot + TEXT("/") + Rel;
+        else
+        {
+            ActionContext->Error(FText::Format(
+                NSLOCTEXT("RuleRanger", "FailedToDeleteEmptyFolder", "Failed to delete empty content folder {0}"),
+                FText::FromString(Dir.MountPath)));
+        }
     }
-    MountPath = NormalizeMountPath(MountPath);
-    return MountPath;
 }
 
-void UEnsureNoEmptyContentFoldersAction::GenerateDirectoriesForRoot(const FContentRoot& Root,
-                                                                    TArray<FDirEntry>& Candidates) const
+void UEnsureNoEmptyContentFoldersAction::ScanContentRoot(const FContentRoot& Root, TArray<FDirEntry>& Tree) const
 {
-    Candidates.Reserve(128);
-
-    TArray<FString> AbsSubDirPaths;
-    CollectAllSubdirectories(Root.FileSystemRoot, AbsSubDirPaths);
-
-    for (const auto& AbsPath : AbsSubDirPaths)
+    FDirEntry RootEntry;
+    RootEntry.FileSystemPath = Root.FileSystemRoot;
+    RootEntry.MountPath = Root.MountRoot;
+    Tree.Add(MoveTemp(RootEntry));
+
+    // Breadth-first traversal that lists each directory exactly once. Subdirectories and files are counted
+    // while listing so no further filesystem queries are required to evaluate a directory. Every directory is
+    // added after its parent so iterating the tree in reverse visits children before their parents.
+    for (auto Index = 0; Index < Tree.Num(); ++Index)
     {
-        auto Rel{ AbsPath };
-        // Determine mount path under this root
-        if (FPaths::MakePathRelativeTo(Rel, *Root.FileSystemRoot))
-        {
-            const auto MountPath{ DeriveMountPath(Rel, Root.MountRoot) };
-
-            if (!IsExcludedPath(MountPath, ExcludedPaths))
+        const auto DirPath{ Tree[Index].FileSystemPath };
+        const auto MountPath{ Tree[Index].MountPath };
+        auto SubdirectoryCount{ 0 };
+        auto FileCount{ 0 };
+        IFileManager::Get().IterateDirectory(*DirPath, [&](const TCHAR* FilenameOrDirectory, const bool bIsDirectory) {
+            if (bIsDirectory)
             {
-                auto SlashCount{ 0 };
-                for (auto i = 0; i < MountPath.Len(); ++i)
+                ++SubdirectoryCount;
+                const auto ChildMountPath = MountPath + TEXT("/") + FPaths::GetCleanFilename(FilenameOrDirectory);
+                // Excluded directories count as subdirectories of their parent but are not analyzed
+                if (!IsExcludedPath(ChildMountPath, ExcludedPaths))
                 {
-                    if (MountPath[i] == TEXT('/'))
-                    {
-                        ++SlashCount;
-                    }
+                    FDirEntry Entry;
+                    Entry.FileSystemPath = FilenameOrDirectory;
+                    Entry.MountPath = ChildMountPath;
+                    Entry.ParentIndex = Index;
+                    Tree.Add(MoveTemp(Entry));
                 }
-
-                FDirEntry Entry;
-                Entry.FileSystemPath = AbsPath;
-                Entry.MountPath = MountPath;
-                Entry.Depth = SlashCount;
-                Candidates.Add(MoveTemp(Entry));
             }
-        }
+            else
+            {
+                ++FileCount;
+            }
+            return true;
+        });
+        Tree[Index].SubdirectoryCount = SubdirectoryCount;
+        Tree[Index].FileCount = FileCount;
     }
 }
 
-void UEnsureNoEmptyContentFoldersAction::ProcessContentRoot(URuleRangerProjectActionContext* ActionContext,
-                                                            const FContentRoot& Root) const
+void UEnsureNoEmptyContentFoldersAction::Apply(URuleRangerProjectActionContext* ActionContext)
 {
-    TArray<FDirEntry> Candidates;
-    GenerateDirectoriesForRoot(Root, Candidates);
+    // Gather content roots to scan (project + optional plugin content)
+    TArray<FContentRoot> Roots;
+    CollectContentRoots(bScanPluginContent, Roots);
+    Roots.RemoveAll([](const auto& Root) { return !IFileManager::Get().DirectoryExists(*Root.FileSystemRoot); });
 
-    // Leaf-first: process deepest directories first
-    Candidates.Sort([](const auto& A, const auto& B) { return A.Depth > B.Depth; });
+    // Scan the directory tree of each content root concurrently as these are independent filesystem walks
+    TArray<TArray<FDirEntry>> Trees;
+    Trees.SetNum(Roots.Num());
+    ParallelFor(Roots.Num(),
+                [this, &Roots, &Trees](const int32 Index) { ScanContentRoot(Roots[Index], Trees[Index]); });
 
+    // A single registry query identifies every folder that directly contains an asset
     FRuleRangerUtilities::EnsureAssetRegistryReady();
     const auto& AssetRegistry =
         FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
-
-    for (const auto& Dir : Candidates)
+    FARFilter Filter;
+    for (const auto& Root : Roots)
     {
-        ProcessDirEntry(ActionContext, AssetRegistry, Dir);
+        Filter.PackagePaths.Add(FName(Root.MountRoot));
     }
-}
+    Filter.bRecursivePaths = true;
+    // In-memory assets can only be enumerated on the game thread so only on-disk assets are considered when the
+    // action is applied concurrently with other project actions
+    Filter.bIncludeOnlyOnDiskAssets = !IsInGameThread();
 
-void UEnsureNoEmptyContentFoldersAction::Apply(URuleRangerProjectActionContext* ActionContext)
-{
-    // Gather content roots to scan (project + optional plugin content)
-    TArray<FContentRoot> Roots;
-    CollectContentRoots(bScanPluginContent, Roots);
+    TSet<FName> PathsWithAssets;
+    if (!Filter.PackagePaths.IsEmpty())
+    {
+        AssetRegistry.EnumerateAssets(Filter, [&PathsWithAssets](const FAssetData& AssetData) {
+            PathsWithAssets.Add(AssetData.PackagePath);
+            return true;
+        });
+    }
 
-    for (const auto& Root : Roots)
+    for (auto& Tree : Trees)
     {
-        if (IFileManager::Get().DirectoryExists(*Root.FileSystemRoot))
+        // Leaf-first: the root of the tree at index 0 is never reported
+        for (auto Index = Tree.Num() - 1; Index > 0; --Index)
         {
-            ProcessContentRoot(ActionContext, Root);
+            ProcessDirEntry(ActionContext, PathsWithAssets, Tree, Index);
         }
     }
 }
@@ -18,14 +18,14 @@
 #include "RuleRangerProjectAction.h"
 #include "EnsureNoEmptyContentFoldersAction.generated.h"
 
-class IAssetRegistry;
-
-// Map: list all directories and process deepest-first
+// A directory in a content root along with the counts gathered while scanning the directory
 struct FDirEntry
 {
-    FString FileSystemPath; // absolute path
-    FString MountPath;      // content path e.g. /Game/Foo/Bar
-    int32 Depth{ 0 };       // depth by number of '/'
+    FString FileSystemPath;          // absolute path
+    FString MountPath;               // content path e.g. /Game/Foo/Bar
+    int32 ParentIndex{ INDEX_NONE }; // index of the parent directory in the scanned tree
+    int32 SubdirectoryCount{ 0 };    // number of immediate subdirectories (including excluded subdirectories)
+    int32 FileCount{ 0 };            // number of files directly in the directory
 };
 
 struct FContentRoot
@@ -48,15 +48,11 @@ class UEnsureNoEmptyContentFoldersAction final : public URuleRangerProjectAction
     GENERATED_BODY()
 
     static void ProcessDirEntry(URuleRangerProjectActionContext* ActionContext,
-                                const IAssetRegistry& AssetRegistry,
-                                const FDirEntry& Dir);
-    static FString DeriveMountPath(FString Rel, const FString& MountRoot);
-
-    static bool HasAnyFilesNonRecursive(const FString& Dir);
-
-    void GenerateDirectoriesForRoot(const FContentRoot& Root, TArray<FDirEntry>& Candidates) const;
+                                const TSet<FName>& PathsWithAssets,
+                                TArray<FDirEntry>& Tree,
+                                int32 Index);
 
-    void ProcessContentRoot(URuleRangerProjectActionContext* ActionContext, const FContentRoot& Root) const;
+    void ScanContentRoot(const FContentRoot& Root, TArray<FDirEntry>& Tree) const;
 
 public:
     UEnsureNoEmptyContentFoldersAction();
@@ -70,4 +66,5 @@ public:
     bool bScanPluginContent{ true };
 
     virtual void Apply(URuleRangerProjectActionContext* ActionContext) override;
+    virtual bool IsConcurrencySafe() const override { return true; }
 };
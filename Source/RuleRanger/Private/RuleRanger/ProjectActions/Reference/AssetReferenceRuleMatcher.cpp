@@ -0,0 +1,176 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "AssetReferenceRuleMatcher.h"
+#include "Algo/BinarySearch.h"
+#include "EnsureAssetReferencesFollowRulesAction.h"
+
+namespace
+{
+    const FString WildcardSegment{ TEXT("*") };
+
+    FString SubstituteCaptures(const FString& Pattern, const TArray<FStringView>& Captures)
+    {
+        auto Result{ Pattern };
+        for (auto i = FMath::Min(Captures.Num(), 9); i > 0; --i)
+        {
+            const FString Capture(Captures[i - 1]);
+            Result.ReplaceInline(*FString::Printf(TEXT("$%d"), i), *Capture, ESearchCase::CaseSensitive);
+        }
+        return Result;
+    }
+} // namespace
+
+FString FRuleRangerFolderPattern::ToString() const
+{
+    return TEXT("/") + FString::Join(Segments, TEXT("/"));
+}
+
+FRuleRangerFolderPattern FRuleRangerAssetReferenceRuleMatcher::ParsePattern(const FString& Pattern)
+{
+    FRuleRangerFolderPattern Result;
+    auto Normalized{ Pattern.TrimStartAndEnd() };
+    Normalized.ReplaceInline(TEXT("\\"), TEXT("/"));
+    Normalized.ParseIntoArray(Result.Segments, TEXT("/"), true);
+    return Result;
+}
+
+bool FRuleRangerAssetReferenceRuleMatcher::MatchFolder(const FRuleRangerFolderPattern& Pattern,
+                                                       FStringView Folder,
+                                                       const bool bIncludeSubfolders,
+                                                       TArray<FStringView>* OutCaptures)
+{
+    auto Remaining{ Folder };
+    for (const auto& PatternSegment : Pattern.Segments)
+    {
+        while (Remaining.StartsWith(TEXT('/')))
+        {
+            Remaining.RightChopInline(1);
+        }
+        if (Remaining.IsEmpty())
+        {
+            return false;
+        }
+
+        int32 SeparatorIndex{ INDEX_NONE };
+        const auto Segment = Remaining.FindChar(TEXT('/'), SeparatorIndex) ? Remaining.Left(SeparatorIndex) : Remaining;
+        Remaining.RightChopInline(Segment.Len());
+
+        if (WildcardSegment == PatternSegment)
+        {
+            if (OutCaptures)
+            {
+                OutCaptures->Add(Segment);
+            }
+        }
+        else if (!Segment.Equals(PatternSegment, ESearchCase::IgnoreCase))
+        {
+            return false;
+        }
+    }
+
+    while (Remaining.StartsWith(TEXT('/')))
+    {
+        Remaining.RightChopInline(1);
+    }
+    return bIncludeSubfolders || Remaining.IsEmpty();
+}
+
+void FRuleRangerAssetReferenceRuleMatcher::AddRule(const FAssetReferenceRule& Rule)
+{
+    // ReSharper disable once CppTooWideScopeInitStatement
+    auto Path = ParsePattern(Rule.Path);
+    if (!Path.Segments.IsEmpty())
+    {
+        FCompiledRule Compiled;
+        Compiled.Path = MoveTemp(Path);
+        Compiled.bIncludeSubfolders = Rule.bIncludeSubfolders;
+        Compiled.Priority = Rule.Priority;
+        Compiled.AllowedReferences = Rule.AllowedReferences;
+        Compiled.Description = Rule.Description;
+        for (const auto& Segment : Compiled.Path.Segments)
+        {
+            if (WildcardSegment != Segment)
+            {
+                Compiled.LiteralSegmentCount++;
+            }
+        }
+
+        // Keep rules ordered so that the first matching rule is the one that applies. Higher priority rules
+        // come first, then the more specific rule, then the rule that was added first.
+        const auto Index = Algo::UpperBound(Rules, Compiled, [](const FCompiledRule& A, const FCompiledRule& B) {
+            if (A.Priority != B.Priority)
+            {
+                return A.Priority > B.Priority;
+            }
+            else if (A.Path.Segments.Num() != B.Path.Segments.Num())
+            {
+                return A.Path.Segments.Num() > B.Path.Segments.Num();
+            }
+            else
+            {
+                return A.LiteralSegmentCount > B.LiteralSegmentCount;
+            }
+        });
+        Rules.Insert(MoveTemp(Compiled), Index);
+        PolicyCache.Reset();
+    }
+}
+
+const FRuleRangerAssetReferencePolicy* FRuleRangerAssetReferenceRuleMatcher::FindPolicy(const FString& Folder)
+{
+    if (const auto Cached = PolicyCache.Find(Folder))
+    {
+        return Cached->Get();
+    }
+    else
+    {
+        TSharedPtr<FRuleRangerAssetReferencePolicy> Policy;
+        TArray<FStringView> Captures;
+        for (const auto& Rule : Rules)
+        {
+            Captures.Reset();
+            if (MatchFolder(Rule.Path, Folder, Rule.bIncludeSubfolders, &Captures))
+            {
+                Policy = MakeShared<FRuleRangerAssetReferencePolicy>();
+                Policy->RulePath = Rule.Path.ToString();
+                Policy->RuleDescription = Rule.Description;
+                for (const auto& AllowedReference : Rule.AllowedReferences)
+                {
+                    // ReSharper disable once CppTooWideScopeInitStatement
+                    auto Pattern = ParsePattern(SubstituteCaptures(AllowedReference, Captures));
+                    if (!Pattern.Segments.IsEmpty())
+                    {
+                        Policy->AllowedReferences.Add(MoveTemp(Pattern));
+                    }
+                }
+                break;
+            }
+        }
+        PolicyCache.Add(Folder, Policy);
+        return Policy.Get();
+    }
+}
+
+bool FRuleRangerAssetReferenceRuleMatcher::IsReferenceAllowed(const FRuleRangerAssetReferencePolicy& Policy,
+                                                              const FStringView Folder)
+{
+    for (const auto& AllowedReference : Policy.AllowedReferences)
+    {
+        if (MatchFolder(AllowedReference, Folder, true))
+        {
+            return true;
+        }
+    }
+    return false;
+}
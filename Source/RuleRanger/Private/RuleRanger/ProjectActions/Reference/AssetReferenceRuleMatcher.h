@@ -0,0 +1,111 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FAssetReferenceRule;
+
+/**
+ * A folder pattern split into segments where a segment of "*" matches exactly one folder name.
+ */
+struct FRuleRangerFolderPattern
+{
+    TArray<FString> Segments;
+
+    /** Return the pattern in the same form it was declared in. */
+    FString ToString() const;
+};
+
+/**
+ * The folders that the packages in a folder governed by an asset reference rule are permitted to reference.
+ */
+struct FRuleRangerAssetReferencePolicy
+{
+    /** The Path of the rule that governs the folder. */
+    FString RulePath;
+
+    /** The Description of the rule that governs the folder. */
+    FString RuleDescription;
+
+    /** The permitted folders (and their subfolders) with any wildcard captures substituted. */
+    TArray<FRuleRangerFolderPattern> AllowedReferences;
+};
+
+/**
+ * Compiled form of a set of asset reference rules.
+ *
+ * Rules are ordered by priority when added so that resolving the rule that governs a folder is a single pass
+ * over the rules that stops at the first match. The policy resolved for a folder is cached, as every package
+ * in a folder shares the same policy. Resolving policies is not thread-safe but once resolved a policy can be
+ * read from multiple threads via IsReferenceAllowed().
+ */
+class FRuleRangerAssetReferenceRuleMatcher
+{
+public:
+    /** Add a rule to the matcher. Rules with an empty Path are ignored. */
+    void AddRule(const FAssetReferenceRule& Rule);
+
+    FORCEINLINE bool IsEmpty() const { return Rules.IsEmpty(); }
+
+    /**
+     * Return the policy for the folder or nullptr if no rule governs the folder.
+     *
+     * @param Folder the content folder. i.e. "/Game/Characters/Bob/Animations"
+     * @return the policy or nullptr.
+     */
+    const FRuleRangerAssetReferencePolicy* FindPolicy(const FString& Folder);
+
+    /**
+     * Return true if the specified folder is permitted by the policy.
+     *
+     * @param Policy the policy.
+     * @param Folder the folder containing the referenced package.
+     * @return true if the reference is permitted.
+     */
+    static bool IsReferenceAllowed(const FRuleRangerAssetReferencePolicy& Policy, FStringView Folder);
+
+    /**
+     * Return true if the folder matches the pattern.
+     *
+     * @param Pattern the pattern.
+     * @param Folder the folder to test.
+     * @param bIncludeSubfolders true if a subfolder of a folder matching the pattern also matches.
+     * @param OutCaptures if non-null, the folder names matched by the wildcard segments are added to this array.
+     * @return true if the folder matches the pattern.
+     */
+    static bool MatchFolder(const FRuleRangerFolderPattern& Pattern,
+                            FStringView Folder,
+                            bool bIncludeSubfolders,
+                            TArray<FStringView>* OutCaptures = nullptr);
+
+    /** Parse a pattern such as "/Game/Characters/*" into segments. */
+    static FRuleRangerFolderPattern ParsePattern(const FString& Pattern);
+
+private:
+    struct FCompiledRule
+    {
+        FRuleRangerFolderPattern Path;
+        bool bIncludeSubfolders{ true };
+        int32 Priority{ 0 };
+        int32 LiteralSegmentCount{ 0 };
+        TArray<FString> AllowedReferences;
+        FString Description;
+    };
+
+    TArray<FCompiledRule> Rules;
+
+    /** Cache of resolved policies indexed by folder. A null value indicates that no rule governs the folder. */
+    TMap<FString, TSharedPtr<FRuleRangerAssetReferencePolicy>> PolicyCache;
+};
@@ -0,0 +1,197 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "EnsureAssetReferencesFollowRulesAction.h"
+#include "AssetReferenceRuleMatcher.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "RuleRanger/RuleRangerUtilities.h"
+#include "RuleRangerConfig.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(EnsureAssetReferencesFollowRulesAction)
+
+namespace
+{
+    struct FReferencer
+    {
+        FName PackageName;
+        const FRuleRangerAssetReferencePolicy* Policy{ nullptr };
+    };
+
+    struct FReferenceEdge
+    {
+        int32 ReferencerIndex{ INDEX_NONE };
+        FName Dependency;
+    };
+
+    FStringView GetPackageFolder(const FStringView PackageName)
+    {
+        int32 SeparatorIndex{ INDEX_NONE };
+        return PackageName.FindLastChar(TEXT('/'), SeparatorIndex) ? PackageName.Left(SeparatorIndex) : PackageName;
+    }
+} // namespace
+
+UEnsureAssetReferencesFollowRulesAction::UEnsureAssetReferencesFollowRulesAction()
+{
+    ScanPaths.Add(TEXT("/Game"));
+    IgnoredReferencePaths.Add(TEXT("/Script"));
+    IgnoredReferencePaths.Add(TEXT("/Engine"));
+}
+
+void UEnsureAssetReferencesFollowRulesAction::BuildMatcher(const URuleRangerProjectActionContext* ActionContext,
+                                                           FRuleRangerAssetReferenceRuleMatcher& Matcher) const
+{
+    TArray<TObjectPtr<UDataTable>> Tables;
+    Tables.Append(RulesTables);
+    if (const auto Config = ActionContext->GetConfig())
+    {
+        Config->CollectDataTables(FAssetReferenceRule::StaticStruct(), Tables);
+    }
+
+    TSet<const UDataTable*> Visited;
+    for (const auto Table : Tables)
+    {
+        if (IsValid(Table) && !Visited.Contains(Table))
+        {
+            Visited.Add(Table);
+            Table->ForeachRow<FAssetReferenceRule>(TEXT("EnsureAssetReferencesFollowRules"),
+                                                   [&Matcher](const FName&, const FAssetReferenceRule& Rule) {
+                                                       Matcher.AddRule(Rule);
+                                                   });
+        }
+    }
+}
+
+void UEnsureAssetReferencesFollowRulesAction::Apply(URuleRangerProjectActionContext* ActionContext)
+{
+    FRuleRangerAssetReferenceRuleMatcher Matcher;
+    BuildMatcher(ActionContext, Matcher);
+    if (Matcher.IsEmpty())
+    {
+        LogInfo(TEXT("No asset reference rules defined. Skipping asset reference checks."));
+    }
+    else
+    {
+        FRuleRangerUtilities::EnsureAssetRegistryReady();
+        const auto& AssetRegistry =
+            FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+
+        FARFilter Filter;
+        for (const auto& ScanPath : ScanPaths)
+        {
+            Filter.PackagePaths.Add(FName(ScanPath));
+        }
+        Filter.bRecursivePaths = true;
+        Filter.bIncludeOnlyOnDiskAssets = true;
+
+        TArray<FAssetData> Assets;
+        AssetRegistry.GetAssets(Filter, Assets);
+
+        // Resolve the rule governing each package. Packages are sorted so that violations are reported in a
+        // deterministic order and the policy is resolved once per folder rather than once per package.
+        TSet<FName> PackageNames;
+        TMap<FName, const FRuleRangerAssetReferencePolicy*> FolderPolicies;
+        TArray<FReferencer> Referencers;
+        for (const auto& Asset : Assets)
+        {
+            if (!PackageNames.Contains(Asset.PackageName))
+            {
+                PackageNames.Add(Asset.PackageName);
+                const auto FolderPolicy = FolderPolicies.Find(Asset.PackagePath);
+                // ReSharper disable once CppTooWideScopeInitStatement
+                const auto Policy =
+                    FolderPolicy ? *FolderPolicy
+                                 : FolderPolicies.Add(Asset.PackagePath,
+                                                      Matcher.FindPolicy(Asset.PackagePath.ToString()));
+                if (Policy)
+                {
+                    Referencers.Add({ Asset.PackageName, Policy });
+                }
+            }
+        }
+        Referencers.Sort([](const auto& A, const auto& B) { return A.PackageName.LexicalLess(B.PackageName); });
+
+        // Snapshot the dependency graph for the governed packages
+        const auto Query = bCheckSoftReferences
+            ? UE::AssetRegistry::EDependencyQuery::NoRequirements
+            : UE::AssetRegistry::EDependencyQuery::Hard;
+        TArray<FReferenceEdge> Edges;
+        TArray<FName> Dependencies;
+        for (auto i = 0; i < Referencers.Num(); ++i)
+        {
+            Dependencies.Reset();
+            AssetRegistry.GetDependencies(Referencers[i].PackageName,
+                                          Dependencies,
+                                          UE::AssetRegistry::EDependencyCategory::Package,
+                                          Query);
+            Dependencies.Sort(FNameLexicalLess());
+            for (const auto& Dependency : Dependencies)
+            {
+                if (Dependency != Referencers[i].PackageName)
+                {
+                    Edges.Add({ i, Dependency });
+                }
+            }
+        }
+
+        FRuleRangerAssetReferencePolicy IgnoredPolicy;
+        for (const auto& IgnoredReferencePath : IgnoredReferencePaths)
+        {
+            // ReSharper disable once CppTooWideScopeInitStatement
+            auto Pattern = FRuleRangerAssetReferenceRuleMatcher::ParsePattern(IgnoredReferencePath);
+            if (!Pattern.Segments.IsEmpty())
+            {
+                IgnoredPolicy.AllowedReferences.Add(MoveTemp(Pattern));
+            }
+        }
+
+        // Policies are fully resolved at this point so edges can be evaluated concurrently
+        TArray<bool> Violations;
+        Violations.SetNumZeroed(Edges.Num());
+        ParallelFor(Edges.Num(), [&](const int32 Index) {
+            const auto& Edge = Edges[Index];
+            const FNameBuilder DependencyName(Edge.Dependency);
+            const auto Folder = GetPackageFolder(DependencyName.ToView());
+            const auto& Policy = *Referencers[Edge.ReferencerIndex].Policy;
+            Violations[Index] = !FRuleRangerAssetReferenceRuleMatcher::IsReferenceAllowed(IgnoredPolicy, Folder)
+                && !FRuleRangerAssetReferenceRuleMatcher::IsReferenceAllowed(Policy, Folder);
+        });
+
+        auto ViolationCount{ 0 };
+        for (auto i = 0; i < Edges.Num(); ++i)
+        {
+            if (Violations[i])
+            {
+                ViolationCount++;
+                const auto& Referencer = Referencers[Edges[i].ReferencerIndex];
+                const auto& Policy = *Referencer.Policy;
+                ActionContext->Error(FText::Format(
+                    NSLOCTEXT("RuleRanger",
+                              "AssetReferenceNotAllowed",
+                              "Asset {0} references {1} which is not permitted by the asset reference rule "
+                              "for {2}. {3}"),
+                    FText::FromName(Referencer.PackageName),
+                    FText::FromName(Edges[i].Dependency),
+                    FText::FromString(Policy.RulePath),
+                    FText::FromString(Policy.RuleDescription)));
+            }
+        }
+
+        LogInfo(FString::Printf(TEXT("Checked %d references from %d packages governed by asset reference rules. "
+                                     "Found %d references that are not permitted."),
+                                Edges.Num(),
+                                Referencers.Num(),
+                                ViolationCount));
+    }
+}
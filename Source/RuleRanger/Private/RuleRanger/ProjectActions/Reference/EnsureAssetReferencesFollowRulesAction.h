@@ -0,0 +1,99 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataTable.h"
+#include "RuleRangerProjectAction.h"
+#include "EnsureAssetReferencesFollowRulesAction.generated.h"
+
+class FRuleRangerAssetReferenceRuleMatcher;
+
+/**
+ * A rule restricting which folders the assets in a folder may reference.
+ */
+USTRUCT(BlueprintType)
+struct FAssetReferenceRule final : public FTableRowBase
+{
+    GENERATED_BODY();
+
+    /**
+     * The folder that the rule applies to.
+     * A folder name of "*" matches any single folder. i.e. "/Game/Characters/*" matches "/Game/Characters/Bob".
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FString Path{ "" };
+
+    /** Should the rule also apply to subfolders of the matched folder? */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    bool bIncludeSubfolders{ true };
+
+    /**
+     * The folders (and their subfolders) that assets governed by the rule may reference.
+     * A folder name of "*" matches any single folder and the tokens $1 to $9 are replaced by the folder names
+     * matched by the corresponding "*" in the Path. i.e. "/Game/Characters/$1" allows "/Game/Characters/Bob"
+     * to reference itself but no other character.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    TArray<FString> AllowedReferences;
+
+    /** When multiple rules match a folder, the rule with the highest priority is applied. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    int32 Priority{ 0 };
+
+    /** An explanation of the rule. */
+    UPROPERTY(EditAnywhere)
+    FString Description{ "" };
+};
+
+/**
+ * Project action that ensures assets only reference assets in the folders permitted by asset reference rules.
+ *
+ * - Snapshots the package dependencies from the Asset Registry and never loads a package.
+ * - The rule governing each folder is resolved once and shared by every package in the folder.
+ * - Dependencies are evaluated in parallel and violations are reported in a deterministic order.
+ */
+UCLASS(DisplayName = "Ensure Asset References Follow Rules", CollapseCategories, DefaultToInstanced, EditInlineNew)
+class UEnsureAssetReferencesFollowRulesAction final : public URuleRangerProjectAction
+{
+    GENERATED_BODY()
+
+    void BuildMatcher(const URuleRangerProjectActionContext* ActionContext,
+                      FRuleRangerAssetReferenceRuleMatcher& Matcher) const;
+
+public:
+    UEnsureAssetReferencesFollowRulesAction();
+
+    /** The array of tables that contains the asset reference rules. */
+    UPROPERTY(EditAnywhere,
+              Category = "Default",
+              meta = (RequiredAssetDataTags = "RowStructure=/Script/RuleRanger.AssetReferenceRule",
+                      ForceShowPluginContent = "true"))
+    TArray<TObjectPtr<UDataTable>> RulesTables;
+
+    /** The content paths (and sub-directories) containing the assets to check. */
+    UPROPERTY(EditAnywhere, Category = "Default")
+    TArray<FString> ScanPaths;
+
+    /** References to packages in these paths (and sub-directories) are always permitted. */
+    UPROPERTY(EditAnywhere, Category = "Default")
+    TArray<FString> IgnoredReferencePaths;
+
+    /** Should soft references be checked as well as hard references? */
+    UPROPERTY(EditAnywhere, Category = "Default")
+    bool bCheckSoftReferences{ true };
+
+    virtual void Apply(URuleRangerProjectActionContext* ActionContext) override;
+    virtual bool IsConcurrencySafe() const override { return true; }
+};
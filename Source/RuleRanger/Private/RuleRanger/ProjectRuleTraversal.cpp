@@ -13,10 +13,15 @@
  */
 #include "RuleRanger/ProjectRuleTraversal.h"
 #include "Logging/StructuredLog.h"
+#include "RuleRanger/RuleRangerUtilities.h"
 #include "RuleRangerConfig.h"
 #include "RuleRangerLogging.h"
+#include "RuleRangerProjectActionContext.h"
 #include "RuleRangerProjectRule.h"
 #include "RuleRangerRuleSet.h"
+#include "Tasks/Task.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/StrongObjectPtr.h"
 
 /*
  * Shared traversal utilities for project-level rules.
@@ -147,6 +152,92 @@ namespace RuleRanger::Traversal
         }
     }
 
+    class FProjectRuleScheduler
+    {
+        struct FScheduledRule
+        {
+            URuleRangerConfig* Config{ nullptr };
+            URuleRangerRuleSet* RuleSet{ nullptr };
+            URuleRangerProjectRule* Rule{ nullptr };
+
+            /** The context of a rule applied on a worker thread. Unset if applied on the calling thread. */
+            TStrongObjectPtr<URuleRangerProjectActionContext> TaskContext;
+            UE::Tasks::FTask Task;
+        };
+
+    public:
+        static void Report(const TConstArrayView<TWeakObjectPtr<URuleRangerConfig>> Configs,
+                           URuleRangerProjectActionContext* const ActionContext,
+                           const FProjectRuleResultVisitor& Visitor)
+        {
+            TArray<FScheduledRule> Rules;
+            TraverseProjectRulesForConfigs(Configs, [&Rules](auto Config, auto RuleSet, auto Rule) {
+                Rules.Add({ Config, RuleSet, Rule });
+                return true;
+            });
+
+            const bool bHasConcurrentRules =
+                Rules.ContainsByPredicate([](const auto& Scheduled) { return Scheduled.Rule->IsConcurrencySafe(); });
+            if (bHasConcurrentRules)
+            {
+                // Complete any pending asset registry scan on the calling thread before workers query the registry
+                FRuleRangerUtilities::EnsureAssetRegistryReady();
+            }
+
+            for (auto& Scheduled : Rules)
+            {
+                if (Scheduled.Rule->IsConcurrencySafe())
+                {
+                    Scheduled.TaskContext.Reset(NewObject<URuleRangerProjectActionContext>());
+                    Scheduled.TaskContext->ResetContext(Scheduled.Config,
+                                                        Scheduled.RuleSet,
+                                                        Scheduled.Rule,
+                                                        ERuleRangerProjectActionTrigger::AT_Report);
+                    Scheduled.Task = UE::Tasks::Launch(
+                        UE_SOURCE_LOCATION,
+                        [Rule = Scheduled.Rule, TaskContext = Scheduled.TaskContext.Get()] {
+                            // Garbage collection must not run while a worker thread is accessing objects
+                            FGCScopeGuard GCGuard;
+                            Rule->Apply(TaskContext);
+                        });
+                }
+            }
+
+            // Results are merged in traversal order regardless of the order in which concurrent rules complete
+            bool bContinue{ true };
+            for (auto& Scheduled : Rules)
+            {
+                if (Scheduled.TaskContext.IsValid())
+                {
+                    Scheduled.Task.Wait();
+                    if (bContinue)
+                    {
+                        bContinue = Visitor(Scheduled.TaskContext.Get());
+                    }
+                    Scheduled.TaskContext->ClearContext();
+                }
+                else if (bContinue)
+                {
+                    ActionContext->ResetContext(Scheduled.Config,
+                                                Scheduled.RuleSet,
+                                                Scheduled.Rule,
+                                                ERuleRangerProjectActionTrigger::AT_Report);
+                    Scheduled.Rule->Apply(ActionContext);
+                    bContinue = Visitor(ActionContext);
+                    ActionContext->ClearContext();
+                }
+            }
+        }
+    };
+
+    void ReportProjectRulesForConfigs(const TConstArrayView<TWeakObjectPtr<URuleRangerConfig>> Configs,
+                                      URuleRangerProjectActionContext* const ActionContext,
+                                      const FProjectRuleResultVisitor& Visitor)
+    {
+        check(ActionContext);
+        FProjectRuleScheduler::Report(Configs, ActionContext, Visitor);
+    }
+
     int32 CountProjectRulesInRuleSet(const URuleRangerRuleSet* RuleSet, TSet<const URuleRangerRuleSet*>& Visited)
     {
         if (!IsValid(RuleSet) || Visited.Contains(RuleSet))
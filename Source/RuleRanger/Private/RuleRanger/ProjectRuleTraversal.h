@@ -19,6 +19,7 @@
 class URuleRangerConfig;
 class URuleRangerRuleSet;
 class URuleRangerProjectRule;
+class URuleRangerProjectActionContext;
 
 namespace RuleRanger::Traversal
 {
@@ -33,6 +34,16 @@ namespace RuleRanger::Traversal
     void TraverseProjectRulesForSoftConfigs(TConstArrayView<TSoftObjectPtr<URuleRangerConfig>> Configs,
                                             const FProjectRuleVisitor& Visitor);
 
+    using FProjectRuleResultVisitor = TFunctionRef<bool(URuleRangerProjectActionContext* ActionContext)>;
+
+    // Apply project rules for already-loaded configs in report mode. Rules that are concurrency-safe are applied
+    // on worker threads with a context per rule while other rules are applied on the calling thread using the
+    // supplied context. The visitor is invoked on the calling thread, in traversal order, with the context of each
+    // applied rule and traversal stops when the visitor returns false.
+    void ReportProjectRulesForConfigs(TConstArrayView<TWeakObjectPtr<URuleRangerConfig>> Configs,
+                                      URuleRangerProjectActionContext* ActionContext,
+                                      const FProjectRuleResultVisitor& Visitor);
+
     // Count utilities
     int32 CountProjectRulesInRuleSet(const URuleRangerRuleSet* RuleSet, TSet<const URuleRangerRuleSet*>& Visited);
     int32 CountProjectRulesForConfigs(TConstArrayView<TWeakObjectPtr<URuleRangerConfig>> Configs);
@@ -0,0 +1,313 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "RuleRanger/RuleRangerChangeImpact.h"
+#include "Algo/AnyOf.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "RuleRanger/RuleRangerUtilities.h"
+#include "RuleRangerAction.h"
+#include "RuleRangerConfig.h"
+#include "RuleRangerExclusionSet.h"
+#include "RuleRangerRule.h"
+#include "RuleRangerRuleSet.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+    void AddPackage(const UObject* Object, TArray<FName>& OutPackages)
+    {
+        if (IsValid(Object))
+        {
+            OutPackages.AddUnique(Object->GetPackage()->GetFName());
+        }
+    }
+
+    // Collect the packages of the assets referenced by the object or any of its subobjects,
+    // such as the DataTables referenced by the actions of a rule.
+    void AddReferencedPackages(const UObject* Object, TArray<FName>& OutPackages)
+    {
+        TArray<UObject*> Objects;
+        Objects.Add(const_cast<UObject*>(Object));
+        GetObjectsWithOuter(Object, Objects, true);
+        for (const auto Current : Objects)
+        {
+            for (TPropertyValueIterator<FObjectPropertyBase> It(Current->GetClass(), Current); It; ++It)
+            {
+                // ReSharper disable once CppTooWideScopeInitStatement
+                const auto Referenced = It.Key()->GetObjectPropertyValue(It.Value());
+                if (IsValid(Referenced) && Referenced->IsAsset())
+                {
+                    AddPackage(Referenced, OutPackages);
+                }
+            }
+        }
+    }
+
+    // Return true if the filters select the same assets. Rules reached via the same config with the
+    // same expected types share a filter so the asset registry is only queried once per distinct filter.
+    bool IsSameSelection(const FARFilter& A, const FARFilter& B)
+    {
+        return A.PackagePaths == B.PackagePaths && A.ClassPaths == B.ClassPaths;
+    }
+} // namespace
+
+struct FRuleRangerChangeImpact::FIndexContext
+{
+    const URuleRangerConfig* Config{ nullptr };
+
+    // Packages that every rule reachable from the config depends upon
+    TArray<FName> ConfigPackages;
+
+    // Packages of the rule sets through which the current rule set is reached
+    TArray<FName> RuleSetPackages;
+
+    TSet<const URuleRangerRuleSet*> Visited;
+};
+
+void FRuleRangerChangeImpact::Build(const TConstArrayView<TWeakObjectPtr<URuleRangerConfig>> Configs)
+{
+    Reset();
+
+    for (const auto& ConfigPtr : Configs)
+    {
+        if (const auto Config = ConfigPtr.Get())
+        {
+            FIndexContext Context;
+            Context.Config = Config;
+            AddPackage(Config, Context.ConfigPackages);
+            for (const auto ExclusionSet : Config->ExclusionSets)
+            {
+                AddPackage(ExclusionSet, Context.ConfigPackages);
+            }
+
+            // Actions look up DataTables via the config, which collects the DataTables of every rule set,
+            // so the DataTables of any rule set in the config are dependencies of every rule in the config.
+            for (const auto DataTable : Config->DataTables)
+            {
+                AddPackage(DataTable, Context.ConfigPackages);
+            }
+            TArray<const URuleRangerRuleSet*> Pending;
+            TSet<const URuleRangerRuleSet*> Seen;
+            for (const auto RuleSet : Config->RuleSets)
+            {
+                Pending.Add(RuleSet);
+            }
+            while (!Pending.IsEmpty())
+            {
+                // ReSharper disable once CppTooWideScopeInitStatement
+                const auto RuleSet = Pending.Pop(EAllowShrinking::No);
+                if (IsValid(RuleSet) && !Seen.Contains(RuleSet))
+                {
+                    Seen.Add(RuleSet);
+                    for (const auto DataTable : RuleSet->DataTables)
+                    {
+                        AddPackage(DataTable, Context.ConfigPackages);
+                    }
+                    for (const auto Child : RuleSet->RuleSets)
+                    {
+                        Pending.Add(Child);
+                    }
+                }
+            }
+
+            for (const auto RuleSet : Config->RuleSets)
+            {
+                IndexRuleSet(Context, RuleSet);
+            }
+        }
+    }
+}
+
+void FRuleRangerChangeImpact::IndexRuleSet(FIndexContext& Context, const URuleRangerRuleSet* RuleSet)
+{
+    if (IsValid(RuleSet) && !Context.Visited.Contains(RuleSet))
+    {
+        Context.Visited.Add(RuleSet);
+        const auto PackageCount = Context.RuleSetPackages.Num();
+        AddPackage(RuleSet, Context.RuleSetPackages);
+        for (const auto Child : RuleSet->RuleSets)
+        {
+            IndexRuleSet(Context, Child);
+        }
+        for (const auto Rule : RuleSet->Rules)
+        {
+            if (IsValid(Rule))
+            {
+                const auto Index = Rules.AddDefaulted();
+                auto& Entry = Rules[Index];
+                Entry.Rule = Rule;
+                Entry.bHasFilter = BuildAssetFilter(Context.Config, Rule, Entry.Filter);
+
+                TArray<FName> Dependencies{ Context.ConfigPackages };
+                for (const auto& Package : Context.RuleSetPackages)
+                {
+                    Dependencies.AddUnique(Package);
+                }
+                AddPackage(Rule, Dependencies);
+                AddReferencedPackages(Rule, Dependencies);
+                for (const auto& Dependency : Dependencies)
+                {
+                    RulesByDependency.AddUnique(Dependency, Index);
+                }
+            }
+        }
+        Context.RuleSetPackages.SetNum(PackageCount);
+    }
+}
+
+void FRuleRangerChangeImpact::Reset()
+{
+    Rules.Reset();
+    RulesByDependency.Reset();
+}
+
+void FRuleRangerChangeImpact::CollectImpactedRules(const TSet<FName>& ChangedPackages,
+                                                   TArray<const URuleRangerRule*>& OutRules) const
+{
+    TSet<int32> Entries;
+    CollectImpactedEntries(ChangedPackages, Entries);
+    for (const auto Index : Entries)
+    {
+        if (const auto Rule = Rules[Index].Rule.Get())
+        {
+            OutRules.AddUnique(Rule);
+        }
+    }
+}
+
+int32 FRuleRangerChangeImpact::CollectImpactedAssets(const TSet<FName>& ChangedPackages,
+                                                     TArray<FAssetData>& OutAssets) const
+{
+    TSet<int32> Entries;
+    CollectImpactedEntries(ChangedPackages, Entries);
+    if (!Entries.IsEmpty())
+    {
+        const auto& AssetRegistry =
+            FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+        TArray<const FARFilter*> Queried;
+        TArray<FAssetData> Candidates;
+        for (const auto Index : Entries)
+        {
+            const auto& Entry = Rules[Index];
+            if (Entry.bHasFilter
+                && !Queried.ContainsByPredicate(
+                    [&Entry](const FARFilter* Filter) { return IsSameSelection(*Filter, Entry.Filter); }))
+            {
+                Queried.Add(&Entry.Filter);
+                AssetRegistry.GetAssets(Entry.Filter, Candidates);
+            }
+        }
+        FRuleRangerUtilities::AddPackageRepresentativeAssets(Candidates, OutAssets);
+    }
+    return Entries.Num();
+}
+
+void FRuleRangerChangeImpact::RemoveUntargetedAssets(TArray<FAssetData>& InOutAssets) const
+{
+    const auto& AssetRegistry =
+        FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+    TArray<const FARFilter*> Compiled;
+    TArray<FARCompiledFilter> Filters;
+    for (const auto& Entry : Rules)
+    {
+        if (Entry.bHasFilter
+            && !Compiled.ContainsByPredicate(
+                [&Entry](const FARFilter* Filter) { return IsSameSelection(*Filter, Entry.Filter); }))
+        {
+            Compiled.Add(&Entry.Filter);
+            AssetRegistry.CompileFilter(Entry.Filter, Filters.AddDefaulted_GetRef());
+        }
+    }
+    InOutAssets.RemoveAll([&AssetRegistry, &Filters](const FAssetData& Asset) {
+        return !Algo::AnyOf(Filters, [&AssetRegistry, &Asset](const FARCompiledFilter& Filter) {
+            return AssetRegistry.IsAssetIncludedByFilter(Asset, Filter);
+        });
+    });
+}
+
+bool FRuleRangerChangeImpact::BuildAssetFilter(const URuleRangerConfig* Config,
+                                               const URuleRangerRule* Rule,
+                                               FARFilter& OutFilter)
+{
+    OutFilter = FARFilter();
+    if (!IsValid(Config) || !IsValid(Rule))
+    {
+        return false;
+    }
+    else
+    {
+        // A rule is only applied to an object if one of its actions accepts the type of the object
+        auto bAnyAction{ false };
+        auto bAnyType{ false };
+        for (const auto Action : Rule->Actions)
+        {
+            // ReSharper disable once CppTooWideScopeInitStatement
+            const auto ExpectedType = IsValid(Action) ? Action->GetExpectedType() : nullptr;
+            if (ExpectedType)
+            {
+                bAnyAction = true;
+                if (UObject::StaticClass() == ExpectedType || ExpectedType->HasAnyClassFlags(CLASS_Interface))
+                {
+                    bAnyType = true;
+                }
+                else
+                {
+                    OutFilter.ClassPaths.AddUnique(ExpectedType->GetClassPathName());
+                }
+            }
+        }
+
+        for (const auto& Dir : Config->Dirs)
+        {
+            auto Path{ Dir.Path };
+            Path.RemoveFromEnd(TEXT("/"));
+            if (!Path.IsEmpty())
+            {
+                OutFilter.PackagePaths.AddUnique(FName(Path));
+            }
+        }
+
+        if (!bAnyAction || OutFilter.PackagePaths.IsEmpty())
+        {
+            return false;
+        }
+        else
+        {
+            OutFilter.bRecursivePaths = true;
+            if (bAnyType)
+            {
+                OutFilter.ClassPaths.Reset();
+            }
+            else
+            {
+                OutFilter.ClassPaths.AddUnique(UBlueprint::StaticClass()->GetClassPathName());
+                OutFilter.bRecursiveClasses = true;
+            }
+            return true;
+        }
+    }
+}
+
+void FRuleRangerChangeImpact::CollectImpactedEntries(const TSet<FName>& ChangedPackages,
+                                                     TSet<int32>& OutEntries) const
+{
+    for (const auto& PackageName : ChangedPackages)
+    {
+        for (auto It = RulesByDependency.CreateConstKeyIterator(PackageName); It; ++It)
+        {
+            OutEntries.Add(It.Value());
+        }
+    }
+}
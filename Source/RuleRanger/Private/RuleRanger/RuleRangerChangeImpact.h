@@ -0,0 +1,106 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "AssetRegistry/ARFilter.h"
+#include "CoreMinimal.h"
+
+struct FAssetData;
+class URuleRangerConfig;
+class URuleRangerRule;
+class URuleRangerRuleSet;
+
+/**
+ * Index of the packages that the rules reachable from a set of configs depend upon.
+ *
+ * A rule depends upon the package containing the rule, the packages containing the rule sets and config through
+ * which the rule is reached, the DataTables and exclusion sets of the config and its rule sets, and any asset
+ * referenced by the properties of the rule, its matchers or its actions. When one of these packages changes the
+ * results produced by the rule may change, so only the assets that the rule could apply to need to be scanned
+ * again.
+ *
+ * The assets that a rule could apply to are selected via an asset registry filter built when the index is built.
+ * The filter is restricted to the directories of the config and to the types expected by the actions of the rule,
+ * so a rule that has since been edited or removed can still be mapped to the assets it previously produced
+ * results for. Blueprints are always included as a blueprint may match an expected type via its generated class.
+ */
+class FRuleRangerChangeImpact
+{
+public:
+    /** Index the rules reachable from the configs, replacing the current index. */
+    void Build(TConstArrayView<TWeakObjectPtr<URuleRangerConfig>> Configs);
+
+    void Reset();
+
+    FORCEINLINE bool IsEmpty() const { return Rules.IsEmpty(); }
+
+    /** Return the number of (config, rule) pairs in the index. */
+    FORCEINLINE int32 Num() const { return Rules.Num(); }
+
+    /** Return true if any indexed rule depends upon the package. */
+    FORCEINLINE bool IsDependency(const FName PackageName) const { return RulesByDependency.Contains(PackageName); }
+
+    /**
+     * Collect the rules that depend upon any of the changed packages.
+     *
+     * @param ChangedPackages the names of the packages that changed.
+     * @param OutRules the array to add the impacted rules to. A rule is added once.
+     */
+    void CollectImpactedRules(const TSet<FName>& ChangedPackages, TArray<const URuleRangerRule*>& OutRules) const;
+
+    /**
+     * Collect the assets whose results may change as a result of the changed packages.
+     *
+     * @param ChangedPackages the names of the packages that changed.
+     * @param OutAssets the array to add the impacted assets to. One asset is added per package.
+     * @return the number of impacted rules.
+     */
+    int32 CollectImpactedAssets(const TSet<FName>& ChangedPackages, TArray<FAssetData>& OutAssets) const;
+
+    /**
+     * Remove the assets that no indexed rule could apply to.
+     *
+     * @param InOutAssets the assets to filter.
+     */
+    void RemoveUntargetedAssets(TArray<FAssetData>& InOutAssets) const;
+
+    /**
+     * Build the asset registry filter selecting the assets that the rule could apply to within the config.
+     *
+     * @param Config the config through which the rule is reached.
+     * @param Rule the rule.
+     * @param OutFilter the filter.
+     * @return false if the rule can not apply to any asset.
+     */
+    static bool BuildAssetFilter(const URuleRangerConfig* Config, const URuleRangerRule* Rule, FARFilter& OutFilter);
+
+private:
+    struct FRuleEntry
+    {
+        TWeakObjectPtr<const URuleRangerRule> Rule;
+
+        /** The filter selecting the assets that the rule could apply to, captured when the index was built. */
+        FARFilter Filter;
+        bool bHasFilter{ false };
+    };
+
+    struct FIndexContext;
+
+    TArray<FRuleEntry> Rules;
+    TMultiMap<FName, int32> RulesByDependency;
+
+    void IndexRuleSet(FIndexContext& Context, const URuleRangerRuleSet* RuleSet);
+
+    void CollectImpactedEntries(const TSet<FName>& ChangedPackages, TSet<int32>& OutEntries) const;
+};
@@ -0,0 +1,170 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "RuleRangerExplainTrace.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+FRuleRangerExplainTrace* FRuleRangerExplainTrace::ActiveTrace{ nullptr };
+
+FRuleRangerExplainTrace::FScope::FScope(FRuleRangerExplainTrace& Trace) : bActive(IsInGameThread())
+{
+    if (bActive)
+    {
+        PreviousTrace = ActiveTrace;
+        ActiveTrace = &Trace;
+    }
+}
+
+FRuleRangerExplainTrace::FScope::~FScope()
+{
+    if (bActive)
+    {
+        ActiveTrace = PreviousTrace;
+    }
+}
+
+FRuleRangerExplainTrace::FNodeScope::FNodeScope(const TCHAR* Kind, const UObject* Object)
+    : Trace(IsInGameThread() ? ActiveTrace : nullptr)
+{
+    if (Trace)
+    {
+        NodeIndex = Trace->AddNode(Kind, GetPathNameSafe(Object));
+        Trace->OpenNodes.Push(NodeIndex);
+        StartTime = FPlatformTime::Seconds();
+    }
+}
+
+FRuleRangerExplainTrace::FNodeScope::~FNodeScope()
+{
+    if (Trace)
+    {
+        Trace->Nodes[NodeIndex].Seconds = FPlatformTime::Seconds() - StartTime;
+        Trace->OpenNodes.Pop(EAllowShrinking::No);
+    }
+}
+
+void FRuleRangerExplainTrace::Note(const TCHAR* Kind, const FString& Name, const FString& Outcome)
+{
+    if (ActiveTrace && IsInGameThread())
+    {
+        const auto NodeIndex = ActiveTrace->AddNode(Kind, Name);
+        ActiveTrace->Nodes[NodeIndex].Outcome = Outcome;
+    }
+}
+
+void FRuleRangerExplainTrace::SetOutcome(const TCHAR* Outcome)
+{
+    if (ActiveTrace && IsInGameThread() && !ActiveTrace->OpenNodes.IsEmpty())
+    {
+        ActiveTrace->Nodes[ActiveTrace->OpenNodes.Last()].Outcome = Outcome;
+    }
+}
+
+void FRuleRangerExplainTrace::SetOutcome(const FString& Outcome)
+{
+    SetOutcome(*Outcome);
+}
+
+TArray<TSharedPtr<FJsonValue>> FRuleRangerExplainTrace::ToJson() const
+{
+    TArray<TSharedPtr<FJsonValue>> Values;
+    for (const auto Root : Roots)
+    {
+        Values.Add(ToJson(Root));
+    }
+    return Values;
+}
+
+FString FRuleRangerExplainTrace::ToText() const
+{
+    FString Text;
+    for (const auto Root : Roots)
+    {
+        AppendText(Root, 0, Text);
+    }
+    return Text;
+}
+
+void FRuleRangerExplainTrace::Reset()
+{
+    check(OpenNodes.IsEmpty());
+    Nodes.Reset();
+    Roots.Reset();
+}
+
+int32 FRuleRangerExplainTrace::AddNode(const TCHAR* Kind, FString Name)
+{
+    const auto NodeIndex = Nodes.AddDefaulted();
+    auto& Node = Nodes[NodeIndex];
+    Node.Kind = Kind;
+    Node.Name = MoveTemp(Name);
+    if (OpenNodes.IsEmpty())
+    {
+        Roots.Add(NodeIndex);
+    }
+    else
+    {
+        Nodes[OpenNodes.Last()].Children.Add(NodeIndex);
+    }
+    return NodeIndex;
+}
+
+TSharedPtr<FJsonValue> FRuleRangerExplainTrace::ToJson(const int32 NodeIndex) const
+{
+    const auto& Node = Nodes[NodeIndex];
+    const auto Object = MakeShared<FJsonObject>();
+    Object->SetStringField(TEXT("Kind"), Node.Kind);
+    Object->SetStringField(TEXT("Name"), Node.Name);
+    if (!Node.Outcome.IsEmpty())
+    {
+        Object->SetStringField(TEXT("Outcome"), Node.Outcome);
+    }
+    if (Node.Seconds >= 0.0)
+    {
+        Object->SetNumberField(TEXT("Seconds"), Node.Seconds);
+    }
+    if (!Node.Children.IsEmpty())
+    {
+        TArray<TSharedPtr<FJsonValue>> Children;
+        for (const auto Child : Node.Children)
+        {
+            Children.Add(ToJson(Child));
+        }
+        Object->SetArrayField(TEXT("Children"), Children);
+    }
+    return MakeShared<FJsonValueObject>(Object);
+}
+
+void FRuleRangerExplainTrace::AppendText(const int32 NodeIndex, const int32 Depth, FString& OutText) const
+{
+    const auto& Node = Nodes[NodeIndex];
+    OutText.Append(FString::ChrN(Depth * 2, TEXT(' ')));
+    OutText.Append(Node.Kind);
+    OutText.Append(TEXT(" "));
+    OutText.Append(Node.Name);
+    if (Node.Seconds >= 0.0)
+    {
+        OutText.Appendf(TEXT(" (%.3f ms)"), Node.Seconds * 1000.0);
+    }
+    if (!Node.Outcome.IsEmpty())
+    {
+        OutText.Append(TEXT(": "));
+        OutText.Append(Node.Outcome);
+    }
+    OutText.AppendChar(TEXT('\n'));
+    for (const auto Child : Node.Children)
+    {
+        AppendText(Child, Depth + 1, OutText);
+    }
+}
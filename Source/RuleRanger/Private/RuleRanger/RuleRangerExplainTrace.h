@@ -0,0 +1,107 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonValue;
+
+/**
+ * A tree describing the decisions made while applying rules to the chosen objects.
+ *
+ * The tree records each config considered, the exclusions applied, each rule set and rule visited and why a rule
+ * was skipped (trigger flags, the action type prefilter or the matcher that did not match), along with the
+ * actions run and the time spent in each node. Decisions are only recorded while a trace is active (via FScope)
+ * on the game thread, so the recording sites cost a pointer check when no object is being explained.
+ */
+class FRuleRangerExplainTrace
+{
+public:
+    struct FNode
+    {
+        /** The kind of node. i.e. "Config", "RuleSet", "Rule", "Matcher" or "Action" */
+        FString Kind;
+
+        /** The path of the object that the node describes. */
+        FString Name;
+
+        /** A description of the decision made. */
+        FString Outcome;
+
+        /** The time spent in the node or a negative value if the node is not timed. */
+        double Seconds{ -1.0 };
+
+        TArray<int32> Children;
+    };
+
+    /** Make the trace active for the duration of the scope. */
+    class FScope
+    {
+    public:
+        explicit FScope(FRuleRangerExplainTrace& Trace);
+        ~FScope();
+
+    private:
+        FRuleRangerExplainTrace* PreviousTrace{ nullptr };
+        bool bActive{ false };
+    };
+
+    /** Add a timed node below the current node of the active trace, making it current for the scope. */
+    class FNodeScope
+    {
+    public:
+        FNodeScope(const TCHAR* Kind, const UObject* Object);
+        ~FNodeScope();
+
+    private:
+        FRuleRangerExplainTrace* Trace{ nullptr };
+        int32 NodeIndex{ INDEX_NONE };
+        double StartTime{ 0.0 };
+    };
+
+    /** Return true if decisions are being recorded. Used to avoid describing decisions that are not recorded. */
+    FORCEINLINE static bool IsActive() { return nullptr != ActiveTrace; }
+
+    /** Add a leaf node below the current node of the active trace. */
+    static void Note(const TCHAR* Kind, const FString& Name, const FString& Outcome);
+
+    /** Describe the decision made for the current node of the active trace. */
+    static void SetOutcome(const TCHAR* Outcome);
+    static void SetOutcome(const FString& Outcome);
+
+    FORCEINLINE bool IsEmpty() const { return Roots.IsEmpty(); }
+    FORCEINLINE const TArray<FNode>& GetNodes() const { return Nodes; }
+    FORCEINLINE const TArray<int32>& GetRoots() const { return Roots; }
+
+    /** Return the tree as an array of JSON objects with Kind, Name, Outcome, Seconds and Children fields. */
+    TArray<TSharedPtr<FJsonValue>> ToJson() const;
+
+    /** Return the tree as indented text with one node per line. */
+    FString ToText() const;
+
+    void Reset();
+
+private:
+    static FRuleRangerExplainTrace* ActiveTrace;
+
+    TArray<FNode> Nodes;
+    TArray<int32> Roots;
+
+    /** The indexes of the nodes that are open, the last being the current node. */
+    TArray<int32> OpenNodes;
+
+    int32 AddNode(const TCHAR* Kind, FString Name);
+    TSharedPtr<FJsonValue> ToJson(int32 NodeIndex) const;
+    void AppendText(int32 NodeIndex, int32 Depth, FString& OutText) const;
+};
@@ -0,0 +1,179 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "RuleRangerMatcherResults.h"
+#include "Logging/StructuredLog.h"
+#include "RuleRanger/RuleRangerMatcherStats.h"
+#include "RuleRangerLogging.h"
+#include "RuleRangerMatcher.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    FRuleRangerMatcherResults* ActiveResults{ nullptr };
+
+    // Hash-consing table of matcher structures. The structure of a matcher is only computed the first time the
+    // matcher is seen, and again after any matcher is edited.
+    TMap<FObjectKey, int32> StructuralIds;
+    TMultiMap<uint32, int32> StructuralIdsByHash;
+    TArray<FString> Structures;
+
+    // Incremented when the structural ids are discarded as ids are reused and results keyed by a discarded id
+    // would be attributed to a different matcher
+    uint32 StructuralIdGeneration{ 0 };
+
+    FDelegateHandle OnObjectModifiedHandle;
+    FDelegateHandle OnObjectPropertyChangedHandle;
+    FDelegateHandle OnObjectTransactedHandle;
+
+    void ResetStructuralIdsIfMatcher(const UObject* Object)
+    {
+        // Matchers are instanced within their rule so editing a child matcher changes the structure of its parent
+        // ReSharper disable once CppTooWideScopeInitStatement
+        const auto bMatcher =
+            Object && (Object->IsA<URuleRangerMatcher>() || Object->IsInA(URuleRangerMatcher::StaticClass()));
+        if (bMatcher && !StructuralIds.IsEmpty())
+        {
+            FRuleRangerMatcherResults::ResetStructuralIds();
+        }
+    }
+} // namespace
+
+FRuleRangerMatcherResults::FRuleRangerMatcherResults(UObject* InObject)
+    : Object(InObject), Generation(StructuralIdGeneration)
+{
+}
+
+FName FRuleRangerMatcherResults::GetAnalysisName()
+{
+    static const FName AnalysisName(TEXT("MatcherResults"));
+    return AnalysisName;
+}
+
+FRuleRangerMatcherResults::FScope::FScope(FRuleRangerMatcherResults& Results) : bActive(IsInGameThread())
+{
+    if (bActive)
+    {
+        PreviousResults = ActiveResults;
+        ActiveResults = &Results;
+    }
+}
+
+FRuleRangerMatcherResults::FScope::~FScope()
+{
+    if (bActive)
+    {
+        ActiveResults = PreviousResults;
+    }
+}
+
+bool FRuleRangerMatcherResults::Test(const URuleRangerMatcher* Matcher, UObject* Object)
+{
+    auto& Stats = FRuleRangerMatcherStats::Get();
+    // ReSharper disable once CppTooWideScopeInitStatement
+    const auto Results = IsInGameThread() ? ActiveResults : nullptr;
+    if (Results && Results->Object.Get() == Object && Matcher->IsSideEffectFree())
+    {
+        if (StructuralIdGeneration != Results->Generation)
+        {
+            Results->Reset();
+            Results->Generation = StructuralIdGeneration;
+        }
+        const auto Id = GetStructuralId(Matcher);
+        if (const auto Result = Results->Results.Find(Id))
+        {
+            UE_LOGFMT(LogRuleRanger,
+                      VeryVerbose,
+                      "Matcher {Matcher} reused the result of a structurally equal matcher for {Object}",
+                      Matcher->GetPathName(),
+                      Object->GetName());
+            if (FRuleRangerMatcherStats::IsEnabled())
+            {
+                // A reused result costs nothing, so it is sampled to let the matcher be reordered like any other
+                Stats.Record(Matcher, *Result, 0.0);
+            }
+            return *Result;
+        }
+        else
+        {
+            const auto bMatched = Stats.Test(Matcher, Object);
+            // Not a reference taken before testing as a nested matcher may have added results
+            Results->Results.Add(Id, bMatched);
+            return bMatched;
+        }
+    }
+    else
+    {
+        return Stats.Test(Matcher, Object);
+    }
+}
+
+void FRuleRangerMatcherResults::Initialize()
+{
+    OnObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddLambda(
+        [](const UObject* Object) { ResetStructuralIdsIfMatcher(Object); });
+    OnObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda(
+        [](const UObject* Object, const FPropertyChangedEvent&) { ResetStructuralIdsIfMatcher(Object); });
+    OnObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddLambda(
+        [](const UObject* Object, const FTransactionObjectEvent&) { ResetStructuralIdsIfMatcher(Object); });
+}
+
+void FRuleRangerMatcherResults::Shutdown()
+{
+    FCoreUObjectDelegates::OnObjectModified.Remove(OnObjectModifiedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(OnObjectPropertyChangedHandle);
+    FCoreUObjectDelegates::OnObjectTransacted.Remove(OnObjectTransactedHandle);
+    OnObjectModifiedHandle.Reset();
+    OnObjectPropertyChangedHandle.Reset();
+    OnObjectTransactedHandle.Reset();
+    ResetStructuralIds();
+}
+
+int32 FRuleRangerMatcherResults::GetStructuralId(const URuleRangerMatcher* Matcher)
+{
+    const FObjectKey Key(Matcher);
+    if (const auto Id = StructuralIds.Find(Key))
+    {
+        return *Id;
+    }
+    else
+    {
+        FString Structure;
+        Matcher->AppendStructure(Structure);
+        // Configuration such as a case-sensitive prefix differs only by case so the comparison is case-sensitive
+        const auto Hash = FCrc::StrCrc32(*Structure);
+
+        TArray<int32, TInlineAllocator<4>> Candidates;
+        StructuralIdsByHash.MultiFind(Hash, Candidates);
+        for (const auto Candidate : Candidates)
+        {
+            if (Structures[Candidate].Equals(Structure, ESearchCase::CaseSensitive))
+            {
+                return StructuralIds.Add(Key, Candidate);
+            }
+        }
+
+        const auto NewId = Structures.Add(MoveTemp(Structure));
+        StructuralIdsByHash.Add(Hash, NewId);
+        return StructuralIds.Add(Key, NewId);
+    }
+}
+
+void FRuleRangerMatcherResults::ResetStructuralIds()
+{
+    StructuralIds.Reset();
+    StructuralIdsByHash.Reset();
+    Structures.Reset();
+    StructuralIdGeneration++;
+}
@@ -0,0 +1,79 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RuleRangerObjectAnalysis.h"
+
+class URuleRangerMatcher;
+
+/**
+ * The results of the matchers evaluated against an object, shared by every rule applied to the object.
+ *
+ * Rules are commonly configured with their own instances of identical matchers (i.e. the same type or content
+ * directory) so matchers are hash-consed by structure and each unique matcher is evaluated at most once per
+ * object. Matchers evaluated while the results are active (via FScope) reuse the results. Only side-effect free
+ * matchers share results and the results are discarded with the other analyses of the object.
+ */
+class FRuleRangerMatcherResults final : public FRuleRangerObjectAnalysis
+{
+public:
+    explicit FRuleRangerMatcherResults(UObject* InObject);
+
+    static FName GetAnalysisName();
+
+    /** Make the results active for the matchers evaluated on the game thread during the scope. */
+    class FScope
+    {
+    public:
+        explicit FScope(FRuleRangerMatcherResults& Results);
+        ~FScope();
+
+    private:
+        FRuleRangerMatcherResults* PreviousResults{ nullptr };
+        bool bActive{ false };
+    };
+
+    /**
+     * Test the object against the matcher, reusing the result of a structurally equal matcher if the active
+     * results are for the object.
+     */
+    static bool Test(const URuleRangerMatcher* Matcher, UObject* Object);
+
+    /** Discard the results. Invoked when the object may have been modified. */
+    FORCEINLINE void Reset() { Results.Reset(); }
+
+    FORCEINLINE int32 Num() const { return Results.Num(); }
+
+    /** Register the delegates that discard the structural ids of matchers when matchers are edited. */
+    static void Initialize();
+
+    static void Shutdown();
+
+    /**
+     * Return the id shared by every structurally equal matcher.
+     * Ids are assigned when a matcher is first seen and are discarded when any matcher is edited.
+     */
+    static int32 GetStructuralId(const URuleRangerMatcher* Matcher);
+
+    /** Discard the structural ids along with every result recorded against them. */
+    static void ResetStructuralIds();
+
+private:
+    TWeakObjectPtr<UObject> Object;
+    TMap<int32, bool> Results;
+
+    /** The generation of the structural ids that the results are keyed by. */
+    uint32 Generation{ 0 };
+};
@@ -0,0 +1,355 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "RuleRangerMatcherStats.h"
+#include "Algo/StableSort.h"
+#include "Dom/JsonObject.h"
+#include "Logging/StructuredLog.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "RuleRanger/UI/RuleRangerDeveloperSettings.h"
+#include "RuleRangerLogging.h"
+#include "RuleRangerMatcher.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    // The number of evaluations of a container between recomputing the order once every matcher is sampled
+    constexpr int32 RefreshInterval{ 256 };
+
+    // Persisted samples are scaled down to this many evaluations so that recent samples can change the order
+    constexpr int64 MaxPersistedEvaluations{ 1024 };
+
+    // The minimum probability that a matcher decides the result, so that a matcher that never decides the
+    // result is ranked by its cost rather than being ranked equally with every other such matcher
+    constexpr double MinDecisionProbability{ 0.001 };
+
+    // The placeholder rank of a matcher that has not been sampled enough times. Ranks are never negative.
+    constexpr double UnsampledRank{ -1.0 };
+
+    bool IsPersistent(const UObject* Object)
+    {
+        return Object && !Object->GetOutermost()->HasAnyFlags(RF_Transient)
+            && Object->GetOutermost() != GetTransientPackage();
+    }
+} // namespace
+
+FRuleRangerMatcherStats& FRuleRangerMatcherStats::Get()
+{
+    static FRuleRangerMatcherStats Instance;
+    return Instance;
+}
+
+bool FRuleRangerMatcherStats::IsEnabled()
+{
+    return GetDefault<URuleRangerDeveloperSettings>()->bReorderMatchersByCost;
+}
+
+void FRuleRangerMatcherStats::GetEvaluationOrder(const UObject* Container,
+                                                 const TConstArrayView<TObjectPtr<URuleRangerMatcher>> Matchers,
+                                                 const bool bConjunction,
+                                                 const bool bPinned,
+                                                 TArray<int32, TInlineAllocator<8>>& OutOrder)
+{
+    OutOrder.Reset();
+    if (bPinned || Matchers.Num() <= 1 || !Container || !IsInGameThread() || !IsEnabled())
+    {
+        for (int32 i = 0; i < Matchers.Num(); i++)
+        {
+            OutOrder.Add(i);
+        }
+    }
+    else
+    {
+        auto& ContainerOrder = ContainerOrders.FindOrAdd(FObjectKey(Container));
+        auto bChanged = ContainerOrder.MatcherKeys.Num() != Matchers.Num();
+        for (int32 i = 0; !bChanged && i < Matchers.Num(); i++)
+        {
+            bChanged = ContainerOrder.MatcherKeys[i] != FObjectKey(Matchers[i].Get());
+        }
+        if (bChanged)
+        {
+            ContainerOrder.ContainerPath = Container->GetPathName();
+            ContainerOrder.bConjunction = bConjunction;
+            ContainerOrder.MatcherKeys.Reset();
+            ContainerOrder.MatcherPaths.Reset();
+            for (const auto Matcher : Matchers)
+            {
+                ContainerOrder.MatcherKeys.Add(FObjectKey(Matcher.Get()));
+                ContainerOrder.MatcherPaths.Add(GetPathNameSafe(Matcher));
+            }
+            ContainerOrder.Order.Reset();
+            ContainerOrder.EvaluationsUntilRefresh = 0;
+        }
+        if (ContainerOrder.EvaluationsUntilRefresh <= 0)
+        {
+            ComputeOrder(ContainerOrder, Matchers);
+        }
+        ContainerOrder.EvaluationsUntilRefresh--;
+        OutOrder.Append(ContainerOrder.Order);
+    }
+}
+
+bool FRuleRangerMatcherStats::Test(const URuleRangerMatcher* Matcher, UObject* Object)
+{
+    if (IsInGameThread() && IsEnabled())
+    {
+        const auto StartTime = FPlatformTime::Seconds();
+        const auto bMatched = Matcher->Test(Object);
+        Record(Matcher, bMatched, FPlatformTime::Seconds() - StartTime);
+        return bMatched;
+    }
+    else
+    {
+        return Matcher->Test(Object);
+    }
+}
+
+void FRuleRangerMatcherStats::Record(const URuleRangerMatcher* Matcher, const bool bMatched, const double Seconds)
+{
+    auto& Sample = FindOrAddSample(Matcher);
+    Sample.Evaluations++;
+    Sample.Matches += bMatched ? 1 : 0;
+    Sample.Seconds += Seconds;
+}
+
+bool FRuleRangerMatcherStats::ExportReport(const FString& Path)
+{
+    TArray<const FContainerOrder*> Orders;
+    for (const auto& Entry : ContainerOrders)
+    {
+        Orders.Add(&Entry.Value);
+    }
+    Orders.Sort([](const auto& A, const auto& B) { return A.ContainerPath < B.ContainerPath; });
+
+    TArray<FString> Lines;
+    Lines.Add(TEXT("Container,Position,Matcher,AuthoredPosition,Evaluations,MatchRate,AverageMicroseconds"));
+    for (const auto Order : Orders)
+    {
+        for (int32 Position = 0; Position < Order->Order.Num(); Position++)
+        {
+            const auto Index = Order->Order[Position];
+            const auto Sample = Samples.Find(Order->MatcherKeys[Index]);
+            const auto Evaluations = Sample ? Sample->Evaluations : 0;
+            // Object paths can not contain commas so the values do not need to be quoted
+            Lines.Add(FString::Printf(TEXT("%s,%d,%s,%d,%lld,%.3f,%.3f"),
+                                      *Order->ContainerPath,
+                                      Position,
+                                      *Order->MatcherPaths[Index],
+                                      Index,
+                                      Evaluations,
+                                      Evaluations > 0 ? static_cast<double>(Sample->Matches) / Evaluations : 0.0,
+                                      Evaluations > 0 ? Sample->Seconds * 1000000.0 / Evaluations : 0.0));
+        }
+    }
+    return FFileHelper::SaveStringArrayToFile(Lines, *Path);
+}
+
+void FRuleRangerMatcherStats::Save()
+{
+    auto bRecorded{ false };
+    for (const auto& Entry : Samples)
+    {
+        // ReSharper disable once CppTooWideScopeInitStatement
+        const auto Matcher = Entry.Key.ResolveObjectPtr();
+        if (IsPersistent(Matcher))
+        {
+            Load();
+            // The live sample was seeded from the persisted sample so it replaces the persisted sample
+            PersistedSamples.Add(Matcher->GetPathName(), Entry.Value);
+            bRecorded = true;
+        }
+    }
+
+    // The persisted samples are only rewritten when this session has measured something to add to them
+    if (bRecorded)
+    {
+        const auto MatchersObject = MakeShared<FJsonObject>();
+        for (const auto& Entry : PersistedSamples)
+        {
+            const auto SampleObject = MakeShared<FJsonObject>();
+            SampleObject->SetNumberField(TEXT("Evaluations"), Entry.Value.Evaluations);
+            SampleObject->SetNumberField(TEXT("Matches"), Entry.Value.Matches);
+            SampleObject->SetNumberField(TEXT("Seconds"), Entry.Value.Seconds);
+            MatchersObject->SetObjectField(Entry.Key, SampleObject);
+        }
+        const auto Root = MakeShared<FJsonObject>();
+        Root->SetObjectField(TEXT("Matchers"), MatchersObject);
+
+        FString OutputString;
+        const auto Writer = TJsonWriterFactory<>::Create(&OutputString);
+        FJsonSerializer::Serialize(Root, Writer);
+        if (!FFileHelper::SaveStringToFile(OutputString, *GetStatsFilename()))
+        {
+            UE_LOGFMT(LogRuleRanger, Warning, "Unable to write matcher statistics to {Path}", GetStatsFilename());
+        }
+    }
+}
+
+void FRuleRangerMatcherStats::Reset()
+{
+    Samples.Reset();
+    ContainerOrders.Reset();
+    // The persisted samples are loaded again when next required
+    PersistedSamples.Reset();
+    bLoaded = false;
+}
+
+FRuleRangerMatcherStats::FSample& FRuleRangerMatcherStats::FindOrAddSample(const URuleRangerMatcher* Matcher)
+{
+    const FObjectKey Key(Matcher);
+    if (const auto Sample = Samples.Find(Key))
+    {
+        return *Sample;
+    }
+    else
+    {
+        Load();
+        // ReSharper disable once CppTooWideScopeInitStatement
+        const auto PersistedSample = IsPersistent(Matcher) ? PersistedSamples.Find(Matcher->GetPathName()) : nullptr;
+        return Samples.Add(Key, PersistedSample ? *PersistedSample : FSample());
+    }
+}
+
+void FRuleRangerMatcherStats::ComputeOrder(FContainerOrder& ContainerOrder,
+                                           const TConstArrayView<TObjectPtr<URuleRangerMatcher>> Matchers)
+{
+    TArray<int32> Order;
+    for (int32 i = 0; i < Matchers.Num(); i++)
+    {
+        Order.Add(i);
+    }
+
+    // An invalid matcher is reported by the container in the authored position and a matcher with side effects
+    // may rely on the matchers before it, so the authored order is retained for either
+    auto bReorderable{ true };
+    for (const auto Matcher : Matchers)
+    {
+        if (!IsValid(Matcher) || !Matcher->IsSideEffectFree())
+        {
+            bReorderable = false;
+            break;
+        }
+    }
+
+    auto bSampled{ true };
+    if (bReorderable)
+    {
+        TArray<double> Ranks;
+        TArray<double> SampledRanks;
+        for (const auto Matcher : Matchers)
+        {
+            const auto& Sample = FindOrAddSample(Matcher);
+            if (Sample.Evaluations < MinSamples)
+            {
+                bSampled = false;
+                Ranks.Add(UnsampledRank);
+            }
+            else
+            {
+                Ranks.Add(GetRank(Sample, ContainerOrder.bConjunction));
+                SampledRanks.Add(Ranks.Last());
+            }
+        }
+
+        // An unsampled matcher is given the median rank of the sampled matchers so that it is neither favoured
+        // nor penalised until its own cost is known
+        if (!bSampled && !SampledRanks.IsEmpty())
+        {
+            SampledRanks.Sort();
+            const auto NeutralRank = SampledRanks[SampledRanks.Num() / 2];
+            for (auto& Rank : Ranks)
+            {
+                Rank = UnsampledRank == Rank ? NeutralRank : Rank;
+            }
+        }
+        Algo::StableSort(Order, [&Ranks](const int32 A, const int32 B) { return Ranks[A] < Ranks[B]; });
+    }
+
+    if (Order != ContainerOrder.Order)
+    {
+        TArray<FString> Names;
+        for (const auto Index : Order)
+        {
+            Names.Add(FString::Printf(TEXT("%s@%d"), *GetNameSafe(Matchers[Index]), Index));
+        }
+        UE_LOGFMT(LogRuleRanger,
+                  Verbose,
+                  "Matchers of {Container} will be evaluated in the order {Order}",
+                  ContainerOrder.ContainerPath,
+                  FString::Join(Names, TEXT(", ")));
+        ContainerOrder.Order = MoveTemp(Order);
+    }
+    // Refresh sooner while matchers are being sampled so that they move once sampled
+    ContainerOrder.EvaluationsUntilRefresh = bSampled || !bReorderable ? RefreshInterval : MinSamples;
+}
+
+double FRuleRangerMatcherStats::GetRank(const FSample& Sample, const bool bConjunction)
+{
+    // Rank by the expected cost of evaluating the matcher per evaluation that decides the result. In a
+    // conjunction a matcher decides the result when it does not match and otherwise when it does match.
+    const auto Cost = Sample.Seconds / Sample.Evaluations;
+    const auto MatchProbability = static_cast<double>(Sample.Matches) / Sample.Evaluations;
+    const auto DecisionProbability = bConjunction ? 1.0 - MatchProbability : MatchProbability;
+    return Cost / FMath::Max(DecisionProbability, MinDecisionProbability);
+}
+
+FString FRuleRangerMatcherStats::GetStatsFilename()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("RuleRanger"), TEXT("MatcherStats.json"));
+}
+
+void FRuleRangerMatcherStats::Load()
+{
+    if (!bLoaded)
+    {
+        bLoaded = true;
+        FString Content;
+        TSharedPtr<FJsonObject> Root;
+        if (FFileHelper::LoadFileToString(Content, *GetStatsFilename())
+            && FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Content), Root) && Root.IsValid())
+        {
+            const TSharedPtr<FJsonObject>* MatchersObject{ nullptr };
+            if (Root->TryGetObjectField(TEXT("Matchers"), MatchersObject))
+            {
+                for (const auto& Entry : (*MatchersObject)->Values)
+                {
+                    const TSharedPtr<FJsonObject>* SampleObject{ nullptr };
+                    FSample Sample;
+                    if (Entry.Value->TryGetObject(SampleObject)
+                        && (*SampleObject)->TryGetNumberField(TEXT("Evaluations"), Sample.Evaluations)
+                        && (*SampleObject)->TryGetNumberField(TEXT("Matches"), Sample.Matches)
+                        && (*SampleObject)->TryGetNumberField(TEXT("Seconds"), Sample.Seconds)
+                        && Sample.Evaluations > 0)
+                    {
+                        if (Sample.Evaluations > MaxPersistedEvaluations)
+                        {
+                            const auto Scale = static_cast<double>(MaxPersistedEvaluations) / Sample.Evaluations;
+                            Sample.Matches = FMath::RoundToInt64(Sample.Matches * Scale);
+                            Sample.Seconds *= Scale;
+                            Sample.Evaluations = MaxPersistedEvaluations;
+                        }
+                        PersistedSamples.Add(Entry.Key, Sample);
+                    }
+                }
+                UE_LOGFMT(LogRuleRanger,
+                          Verbose,
+                          "Loaded statistics for {Count} matcher(s) from {Path}",
+                          PersistedSamples.Num(),
+                          GetStatsFilename());
+            }
+        }
+    }
+}
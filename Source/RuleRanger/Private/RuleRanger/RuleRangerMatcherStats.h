@@ -0,0 +1,111 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class URuleRangerMatcher;
+
+/**
+ * The measured cost and selectivity of matchers, used to choose the order in which a rule or logical matcher
+ * evaluates its matchers.
+ *
+ * A rule only applies if every matcher matches and an Or matcher stops at the first match, so the order of the
+ * matchers never changes the result but does change the cost. Matchers that are cheap and likely to decide the
+ * result are evaluated first, ranked by the expected cost per decided result. Until a matcher has been sampled enough
+ * times it is given the median rank of the sampled matchers of the container, so it is neither favoured nor
+ * penalised. The order of a container is only changed when all of its matchers are side-effect free and the container
+ * does not pin the order.
+ *
+ * Samples are recorded on the game thread and persisted by matcher path between sessions.
+ */
+class FRuleRangerMatcherStats
+{
+public:
+    /** The number of evaluations required before a matcher is reordered. */
+    static constexpr int32 MinSamples{ 8 };
+
+    static FRuleRangerMatcherStats& Get();
+
+    /** Return true if matchers are measured and reordered. Controlled by the developer settings. */
+    static bool IsEnabled();
+
+    /**
+     * Return the order in which the matchers should be evaluated.
+     *
+     * @param Container the rule or logical matcher that contains the matchers.
+     * @param Matchers the matchers in authored order.
+     * @param bConjunction true if evaluation stops at the first matcher that does not match, false if evaluation
+     * stops at the first matcher that matches.
+     * @param bPinned true if the container requires the authored order.
+     * @param OutOrder the indexes of the matchers in evaluation order.
+     */
+    void GetEvaluationOrder(const UObject* Container,
+                            TConstArrayView<TObjectPtr<URuleRangerMatcher>> Matchers,
+                            bool bConjunction,
+                            bool bPinned,
+                            TArray<int32, TInlineAllocator<8>>& OutOrder);
+
+    /** Test the object against the matcher, recording the duration and result when enabled. */
+    bool Test(const URuleRangerMatcher* Matcher, UObject* Object);
+
+    /** Record a sample for the matcher. */
+    void Record(const URuleRangerMatcher* Matcher, bool bMatched, double Seconds);
+
+    /**
+     * Write the current evaluation order of every container that has been evaluated as CSV.
+     *
+     * @param Path the file to write.
+     * @return true if the file was written.
+     */
+    bool ExportReport(const FString& Path);
+
+    /** Persist the samples of the non-transient matchers. Nothing is written if no such samples were recorded. */
+    void Save();
+
+    /** Discard the samples and orders recorded since the persisted samples were loaded. */
+    void Reset();
+
+private:
+    struct FSample
+    {
+        int64 Evaluations{ 0 };
+        int64 Matches{ 0 };
+        double Seconds{ 0.0 };
+    };
+
+    struct FContainerOrder
+    {
+        FString ContainerPath;
+        TArray<FObjectKey> MatcherKeys;
+        TArray<FString> MatcherPaths;
+        TArray<int32> Order;
+        bool bConjunction{ true };
+
+        /** The number of evaluations of the container remaining before the order is recomputed. */
+        int32 EvaluationsUntilRefresh{ 0 };
+    };
+
+    TMap<FObjectKey, FSample> Samples;
+    TMap<FObjectKey, FContainerOrder> ContainerOrders;
+    TMap<FString, FSample> PersistedSamples;
+    bool bLoaded{ false };
+
+    FSample& FindOrAddSample(const URuleRangerMatcher* Matcher);
+    void ComputeOrder(FContainerOrder& ContainerOrder, TConstArrayView<TObjectPtr<URuleRangerMatcher>> Matchers);
+    static double GetRank(const FSample& Sample, bool bConjunction);
+    static FString GetStatsFilename();
+    void Load();
+};
@@ -0,0 +1,273 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "RuleRanger/RuleRangerRenameBatch.h"
+#include "Algo/Count.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetToolsModule.h"
+#include "IAssetTools.h"
+#include "Logging/StructuredLog.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "RuleRanger/UI/RuleRangerDeveloperSettings.h"
+#include "RuleRangerLogging.h"
+#include "UObject/ObjectRedirector.h"
+#include "UObject/UObjectGlobals.h"
+
+FRuleRangerRenameBatch* FRuleRangerRenameBatch::Active{ nullptr };
+
+namespace
+{
+    const TCHAR* GetStatusName(const uint8 Status)
+    {
+        static const TCHAR* StatusNames[]{ TEXT("Planned"), TEXT("Queued"), TEXT("Renamed"), TEXT("Failed") };
+        return Status < UE_ARRAY_COUNT(StatusNames) ? StatusNames[Status] : TEXT("Unknown");
+    }
+} // namespace
+
+FRuleRangerRenameBatch::FRuleRangerRenameBatch()
+{
+    check(IsInGameThread());
+    if (const auto DevSettings = GetDefault<URuleRangerDeveloperSettings>())
+    {
+        bFixupRedirectors = DevSettings->bFixupRedirectorsAfterRenames;
+        ChunkBudgetBytes = static_cast<int64>(DevSettings->RenameChunkBudgetMb) * 1024 * 1024;
+    }
+
+    Outer = Active;
+    if (!Outer)
+    {
+        Active = this;
+    }
+}
+
+FRuleRangerRenameBatch::~FRuleRangerRenameBatch()
+{
+    if (IsActive())
+    {
+        Execute();
+        Active = nullptr;
+    }
+}
+
+FRuleRangerRenameBatch* FRuleRangerRenameBatch::GetActive()
+{
+    return IsInGameThread() ? Active : nullptr;
+}
+
+FRuleRangerRenameBatch::FEntry& FRuleRangerRenameBatch::FindOrAddEntry(const UObject* Object)
+{
+    const FObjectKey Key(Object);
+    if (const auto Index = EntryIndex.Find(Key))
+    {
+        return Entries[*Index];
+    }
+    else
+    {
+        const auto NewIndex = Entries.AddDefaulted();
+        Entries[NewIndex].ObjectPath = Object->GetPathName();
+        EntryIndex.Add(Key, NewIndex);
+        return Entries[NewIndex];
+    }
+}
+
+void FRuleRangerRenameBatch::Add(UObject* Object, const FString& NewName)
+{
+    auto& Entry = FindOrAddEntry(Object);
+    Entry.Object.Reset(Object);
+    Entry.NewName = NewName;
+    Entry.Status = EStatus::Queued;
+}
+
+void FRuleRangerRenameBatch::AddPlanned(const UObject* Object, const FString& NewName)
+{
+    // ReSharper disable once CppTooWideScopeInitStatement
+    auto& Entry = FindOrAddEntry(Object);
+    if (EStatus::Planned == Entry.Status)
+    {
+        Entry.NewName = NewName;
+    }
+}
+
+const FString* FRuleRangerRenameBatch::FindPendingName(const UObject* Object) const
+{
+    // Planned renames are never performed so report and dry run scans must see the current name of the object
+    const auto Index = EntryIndex.Find(FObjectKey(Object));
+    return Index && EStatus::Queued == Entries[*Index].Status ? &Entries[*Index].NewName : nullptr;
+}
+
+int32 FRuleRangerRenameBatch::Execute()
+{
+    if (!IsActive())
+    {
+        return 0;
+    }
+
+    // Renames requested while the renames are being performed are not batched
+    TGuardValue<FRuleRangerRenameBatch*> ActiveGuard(Active, nullptr);
+
+    // The batch may be executed more than once (i.e. at each scan checkpoint) so only new failures are returned
+    const auto CountFailed = [this] {
+        return Algo::CountIf(Entries, [](const FEntry& Entry) { return EStatus::Failed == Entry.Status; });
+    };
+    const auto PreviousFailedCount = CountFailed();
+
+    const auto& AssetRegistry =
+        FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+
+    // Chunks are bounded by the size of the renamed packages on disk as an estimate of the memory required to
+    // load the packages and their referencers. A chunk always contains at least one rename.
+    TArray<int32> Executed;
+    TArray<int32> Chunk;
+    int64 ChunkBytes{ 0 };
+    auto ChunkCount{ 0 };
+    for (auto i = 0; i < Entries.Num(); ++i)
+    {
+        if (auto& Entry = Entries[i]; EStatus::Queued == Entry.Status)
+        {
+            if (const auto Object = Entry.Object.Get(); IsValid(Object))
+            {
+                const auto PackageData = AssetRegistry.GetAssetPackageDataCopy(Object->GetPackage()->GetFName());
+                const auto Bytes = PackageData.IsSet() ? FMath::Max<int64>(PackageData->DiskSize, 0) : 0;
+                if (!Chunk.IsEmpty() && ChunkBudgetBytes > 0 && ChunkBytes + Bytes > ChunkBudgetBytes)
+                {
+                    ExecuteChunk(Chunk);
+                    Executed.Append(Chunk);
+                    Chunk.Reset();
+                    ChunkBytes = 0;
+                    ChunkCount++;
+
+                    // Release what the chunk loaded before loading the referencers of the next chunk
+                    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+                }
+                Chunk.Add(i);
+                ChunkBytes += Bytes;
+            }
+            else
+            {
+                UE_LOGFMT(LogRuleRanger,
+                          Error,
+                          "Unable to rename {Path} to {Name} as the object is no longer valid.",
+                          Entry.ObjectPath,
+                          Entry.NewName);
+                Entry.Status = EStatus::Failed;
+            }
+        }
+    }
+    if (!Chunk.IsEmpty())
+    {
+        ExecuteChunk(Chunk);
+        Executed.Append(Chunk);
+        ChunkCount++;
+    }
+
+    if (bFixupRedirectors && !Executed.IsEmpty())
+    {
+        FixupRedirectors(Executed);
+    }
+
+    const auto FailedCount = CountFailed() - PreviousFailedCount;
+    if (!Executed.IsEmpty())
+    {
+        UE_LOGFMT(LogRuleRanger,
+                  Display,
+                  "Performed {Count} batched rename(s) in {ChunkCount} chunk(s). {FailedCount} rename(s) failed.",
+                  Executed.Num(),
+                  ChunkCount,
+                  FailedCount);
+    }
+    return FailedCount;
+}
+
+void FRuleRangerRenameBatch::ExecuteChunk(const TConstArrayView<int32> EntryIndices)
+{
+    TArray<FAssetRenameData> AssetsAndNames;
+    AssetsAndNames.Reserve(EntryIndices.Num());
+    for (const auto Index : EntryIndices)
+    {
+        const auto& Entry = Entries[Index];
+        const auto Object = Entry.Object.Get();
+        const auto PackagePath = FPackageName::GetLongPackagePath(Object->GetOutermost()->GetName());
+        AssetsAndNames.Add(FAssetRenameData(Object, PackagePath, Entry.NewName));
+    }
+
+    // The result only indicates whether every rename succeeded so each object is checked individually
+    FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools")).Get().RenameAssets(AssetsAndNames);
+
+    for (const auto Index : EntryIndices)
+    {
+        auto& Entry = Entries[Index];
+        // ReSharper disable once CppTooWideScopeInitStatement
+        const auto Object = Entry.Object.Get();
+        if (IsValid(Object) && Object->GetName() == Entry.NewName)
+        {
+            // Notify asset registry of rename
+            FAssetRegistryModule::AssetRenamed(Object, Entry.ObjectPath);
+
+            // This should not be called during loads of object so neither of these functions should return false
+            ensure(Object->MarkPackageDirty());
+            ensure(Object->GetPackage()->MarkPackageDirty());
+            Entry.Status = EStatus::Renamed;
+        }
+        else
+        {
+            UE_LOGFMT(LogRuleRanger,
+                      Error,
+                      "Attempt to rename object '{Path}' to '{Name}' failed.",
+                      Entry.ObjectPath,
+                      Entry.NewName);
+            Entry.Status = EStatus::Failed;
+        }
+        // The object no longer needs to be kept alive
+        Entry.Object.Reset();
+    }
+}
+
+void FRuleRangerRenameBatch::FixupRedirectors(const TConstArrayView<int32> EntryIndices) const
+{
+    TArray<UObjectRedirector*> Redirectors;
+    for (const auto Index : EntryIndices)
+    {
+        const auto& Entry = Entries[Index];
+        if (EStatus::Renamed == Entry.Status)
+        {
+            if (const auto Redirector = FindObject<UObjectRedirector>(nullptr, *Entry.ObjectPath))
+            {
+                Redirectors.Add(Redirector);
+            }
+        }
+    }
+    if (!Redirectors.IsEmpty())
+    {
+        UE_LOGFMT(LogRuleRanger, Display, "Fixing up {Count} redirector(s) created by renames.", Redirectors.Num());
+        FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"))
+            .Get()
+            .FixupReferencers(Redirectors, false, ERedirectFixupMode::DeleteFixedUpRedirectors);
+    }
+}
+
+bool FRuleRangerRenameBatch::ExportPlan(const FString& Path) const
+{
+    TArray<FString> Lines;
+    Lines.Reserve(Entries.Num() + 1);
+    Lines.Add(TEXT("ObjectPath,NewName,Status"));
+    for (const auto& Entry : Entries)
+    {
+        // Object names can not contain commas so the values do not need to be quoted
+        Lines.Add(FString::Printf(TEXT("%s,%s,%s"),
+                                  *Entry.ObjectPath,
+                                  *Entry.NewName,
+                                  GetStatusName(static_cast<uint8>(Entry.Status))));
+    }
+    return FFileHelper::SaveStringArrayToFile(Lines, *Path);
+}
@@ -0,0 +1,115 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/StrongObjectPtr.h"
+
+/**
+ * Collects the asset renames requested while the batch is active so that they can be performed together.
+ *
+ * Renaming assets one at a time loads the referencers of each asset and creates a redirector for each rename.
+ * While a batch is active FRuleRangerUtilities::RenameAsset() queues the rename and the queued renames are
+ * performed when the batch is executed (or destroyed). The renames are passed to IAssetTools::RenameAssets() in
+ * chunks bounded by the estimated size of the renamed packages, optionally followed by a single pass that fixes
+ * up the redirectors that were created. Renames that would be performed in a dry run are also recorded so that
+ * the complete plan can be exported.
+ *
+ * Only one batch is active at a time. A batch created while another is active defers to the outer batch.
+ * Batches are only used from the game thread.
+ */
+class FRuleRangerRenameBatch
+{
+public:
+    FRuleRangerRenameBatch();
+    ~FRuleRangerRenameBatch();
+
+    UE_NONCOPYABLE(FRuleRangerRenameBatch);
+
+    /** Return the active batch or nullptr if no batch is active. */
+    static FRuleRangerRenameBatch* GetActive();
+
+    /**
+     * Queue the rename of an asset.
+     * Queuing another rename of the same asset replaces the name so that the asset is only renamed once.
+     */
+    void Add(UObject* Object, const FString& NewName);
+
+    /** Record a rename that was not performed as the action was a dry run. */
+    void AddPlanned(const UObject* Object, const FString& NewName);
+
+    /**
+     * Return the name that the object will have once the batch executes or nullptr if no rename is queued.
+     * Planned, performed and failed renames are ignored.
+     */
+    const FString* FindPendingName(const UObject* Object) const;
+
+    /** Should a single redirector fixup pass run after the renames? */
+    void SetFixupRedirectors(const bool bInFixupRedirectors) { bFixupRedirectors = bInFixupRedirectors; }
+
+    /** Set the estimated package size in bytes that a single call to IAssetTools::RenameAssets may rename. */
+    void SetChunkBudgetBytes(const int64 InChunkBudgetBytes) { ChunkBudgetBytes = InChunkBudgetBytes; }
+
+    /** Return true if this batch is the active batch rather than deferring to an outer batch. */
+    FORCEINLINE bool IsActive() const { return nullptr == Outer; }
+
+    FORCEINLINE int32 Num() const { return Entries.Num(); }
+
+    /**
+     * Perform the queued renames. Renames queued after the batch executes are performed when it next executes.
+     *
+     * @return the number of renames that failed during this execution.
+     */
+    int32 Execute();
+
+    /**
+     * Write the renames as CSV with the columns ObjectPath, NewName and Status.
+     *
+     * @param Path the file to write.
+     * @return true if the file was written.
+     */
+    bool ExportPlan(const FString& Path) const;
+
+private:
+    enum class EStatus : uint8
+    {
+        Planned,
+        Queued,
+        Renamed,
+        Failed
+    };
+
+    struct FEntry
+    {
+        /** Keeps the object alive until the rename is performed. Null for planned renames. */
+        TStrongObjectPtr<UObject> Object;
+        FString ObjectPath;
+        FString NewName;
+        EStatus Status{ EStatus::Planned };
+    };
+
+    TArray<FEntry> Entries;
+    TMap<FObjectKey, int32> EntryIndex;
+
+    FRuleRangerRenameBatch* Outer{ nullptr };
+    bool bFixupRedirectors{ false };
+    int64 ChunkBudgetBytes{ 0 };
+
+    static FRuleRangerRenameBatch* Active;
+
+    FEntry& FindOrAddEntry(const UObject* Object);
+    void ExecuteChunk(TConstArrayView<int32> EntryIndices);
+    void FixupRedirectors(TConstArrayView<int32> EntryIndices) const;
+};
@@ -18,6 +18,7 @@
 #include "IAssetTools.h"
 #include "Materials/MaterialInterface.h"
 #include "Misc/PackageName.h"
+#include "RuleRanger/RuleRangerRenameBatch.h"
 
 static const FName AssetToolsModuleName("AssetTools");
 
@@ -40,6 +41,12 @@ void FRuleRangerUtilities::EnsureAssetRegistryReady()
 
 bool FRuleRangerUtilities::RenameAsset(UObject* Object, const FString& NewName)
 {
+    if (const auto Batch = FRuleRangerRenameBatch::GetActive())
+    {
+        Batch->Add(Object, NewName);
+        return true;
+    }
+
     const auto PathName = Object->GetPathName();
     const auto PackagePath = FPackageName::GetLongPackagePath(Object->GetOutermost()->GetName());
 
@@ -60,6 +67,22 @@ bool FRuleRangerUtilities::RenameAsset(UObject* Object, const FString& NewName)
     return bSuccess;
 }
 
+FString FRuleRangerUtilities::GetPendingAssetName(const UObject* Object)
+{
+    const auto Batch = FRuleRangerRenameBatch::GetActive();
+    // ReSharper disable once CppTooWideScopeInitStatement
+    const auto PendingName = Batch ? Batch->FindPendingName(Object) : nullptr;
+    return PendingName ? *PendingName : Object->GetName();
+}
+
+void FRuleRangerUtilities::RecordPlannedRename(const UObject* Object, const FString& NewName)
+{
+    if (const auto Batch = FRuleRangerRenameBatch::GetActive())
+    {
+        Batch->AddPlanned(Object, NewName);
+    }
+}
+
 void FRuleRangerUtilities::AddPackageRepresentativeAssets(const TArray<FAssetData>& CandidateAssets,
                                                           TArray<FAssetData>& OutAssets)
 {
@@ -72,11 +95,23 @@ void FRuleRangerUtilities::AddPackageRepresentativeAssets(const TArray<FAssetDat
         }
     }
 
+    // Large scans append many packages so duplicates are detected by package rather than by searching the output
+    TSet<FName> OutputPackages;
+    OutputPackages.Reserve(OutAssets.Num() + AssetsByPackage.Num());
+    for (const auto& Asset : OutAssets)
+    {
+        OutputPackages.Add(Asset.PackageName);
+    }
     for (const auto& Entry : AssetsByPackage)
     {
         if (const auto Representative = UE::AssetRegistry::GetMostImportantAsset(Entry.Value))
         {
-            OutAssets.AddUnique(*Representative);
+            bool bAlreadyAdded{ false };
+            OutputPackages.Add(Entry.Key, &bAlreadyAdded);
+            if (!bAlreadyAdded)
+            {
+                OutAssets.Add(*Representative);
+            }
         }
     }
 }
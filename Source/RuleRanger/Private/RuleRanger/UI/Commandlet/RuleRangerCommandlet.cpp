@@ -15,30 +15,66 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Dom/JsonObject.h"
 #include "Editor.h"
+#include "HAL/FileManager.h"
 #include "Logging/StructuredLog.h"
+#include "Materials/Material.h"
 #include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "PackageTools.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "RuleRanger/Actions/Material/EnsureMaterialHasNoCompileErrorAction.h"
 #include "RuleRanger/ProjectRuleTraversal.h"
+#include "RuleRanger/RuleRangerChangeImpact.h"
+#include "RuleRanger/RuleRangerExplainTrace.h"
+#include "RuleRanger/RuleRangerMatcherStats.h"
+#include "RuleRanger/RuleRangerRenameBatch.h"
 #include "RuleRanger/RuleRangerUtilities.h"
 #include "RuleRanger/UI/RuleRangerDeveloperSettings.h"
 #include "RuleRanger/UI/RuleRangerEditorSubsystem.h"
 #include "RuleRangerActionContext.h"
+#include "RuleRangerCommandletServer.h"
 #include "RuleRangerConfig.h"
 #include "RuleRangerLogging.h"
 #include "RuleRangerProjectActionContext.h"
+#include "RuleRangerScanCheckpoint.h"
 // ReSharper disable 2 CppUnusedIncludeDirective
 #include "RuleRangerProjectRule.h"
 #include "RuleRangerRuleSet.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "ShaderCompiler.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "UObject/UObjectIterator.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(RuleRangerCommandlet)
 
-static void WaitForShaders()
+// The maximum number of shader jobs that may be outstanding before the commandlet waits before compiling more Materials
+static constexpr int32 MaxOutstandingShaderJobs{ 2048 };
+
+// The default number of dirty packages that may accumulate before they are saved when -save is specified
+static constexpr int32 DefaultSaveBatchSize{ 256 };
+
+// The default number of packages completed between saves of the checkpoint when -checkpoint is specified
+static constexpr int32 DefaultCheckpointInterval{ 100 };
+
+// The default loopback port and idle timeout used when running with -server
+static constexpr int32 DefaultServerPort{ 47820 };
+static constexpr double DefaultServerIdleTimeoutSeconds{ 3600.0 };
+
+// The options that modify content or write files, which server requests reject as the server is long-lived
+static const TCHAR* const ServerDisallowedSwitches[] = { TEXT("fix"), TEXT("save"), TEXT("fixupRedirectors") };
+static const TCHAR* const ServerDisallowedValues[] = { TEXT("report="),
+                                                       TEXT("renamePlan="),
+                                                       TEXT("matcherReport="),
+                                                       TEXT("checkpoint=") };
+
+static void WaitForOutstandingShaderJobs(const int32 MaxOutstandingJobs)
 {
-    if (GShaderCompilingManager)
+    while (GShaderCompilingManager && GShaderCompilingManager->GetNumRemainingJobs() > MaxOutstandingJobs)
     {
-        GShaderCompilingManager->FinishAllCompilation();
+        GShaderCompilingManager->ProcessAsyncResults(false, false);
+        FPlatformProcess::Sleep(0.01f);
     }
 }
 
@@ -51,15 +87,41 @@ static void PrintRuleRangerCommandletUsage()
     Usage.Append(TEXT("  -help                       Show this help and exit\n"));
     Usage.Append(TEXT("  -paths=/Game[,/Game/Foo]    Comma-separated content roots to scan\n"));
     Usage.Append(TEXT("  -packages=/Game/Foo/Bar     Comma-separated asset/package names to scan\n"));
+    Usage.Append(TEXT("  -changedSince=File|Time     Scan packages listed in the file or modified since\n"));
+    Usage.Append(TEXT("  -includeReferencers=N       Also scan referencers of changed packages up to N levels deep\n"));
     Usage.Append(TEXT("  -fix                        Apply autofixes where supported (assets + project)\n"));
+    Usage.Append(TEXT("  -fixupRedirectors           Fix up the redirectors left by each batch of renames\n"));
+    Usage.Append(TEXT("  -renamePlan=Path            Write the asset renames (performed or planned) as CSV\n"));
+    Usage.Append(TEXT("  -save                       Save the packages modified by -fix\n"));
+    Usage.Append(TEXT("  -saveBatchSize=N            Save once N packages are modified (default 256)\n"));
     Usage.Append(TEXT("  -report=Path                Write JSON report to the given file\n"));
+    Usage.Append(TEXT("  -checkpoint=Path            Periodically save the scan progress to the given file\n"));
+    Usage.Append(TEXT("  -checkpointInterval=N       Save the checkpoint once N packages complete (default 100)\n"));
+    Usage.Append(TEXT("  -resume                     Resume the scan from the progress saved in the checkpoint\n"));
+    Usage.Append(TEXT("  -matcherReport=Path         Write the order that matchers were evaluated in as CSV\n"));
+    Usage.Append(TEXT("  -explain=/Game/Foo/Bar      Comma-separated assets to trace rule decisions for\n"));
     Usage.Append(TEXT("  -exitOnWarning              Exit non-zero if warnings are present\n"));
     Usage.Append(TEXT("  -quiet                      Suppress \"report written\" log\n"));
     Usage.Append(TEXT("  -assetsOnly                 Run only asset rules\n"));
-    Usage.Append(TEXT("  -projectOnly                Run only project rules\n\n"));
+    Usage.Append(TEXT("  -projectOnly                Run only project rules\n"));
+    Usage.Append(TEXT("  -server                     Stay running and serve scan requests from a loopback socket\n"));
+    Usage.Append(TEXT("  -serverPort=N               The port the server listens on (default 47820)\n"));
+    Usage.Append(TEXT("  -serverIdleTimeout=Seconds  Stop the server after it is idle (default 3600, 0 disables)\n\n"));
     Usage.Append(TEXT("Notes:\n"));
     Usage.Append(TEXT("  - By default, both asset and project rules run.\n"));
     Usage.Append(TEXT("  - Default asset scan path is /Game when -paths is not supplied.\n"));
+    Usage.Append(TEXT("  - Only the -explain assets are scanned when neither -paths nor -packages is supplied.\n"));
+    Usage.Append(TEXT("  - A package being processed when a checkpointed scan dies is quarantined. Later scans\n"));
+    Usage.Append(TEXT("    using the checkpoint skip quarantined packages and report them as errors.\n"));
+    Usage.Append(TEXT("  - With -changedSince, -paths limits the content roots checked for modified packages.\n"));
+    Usage.Append(TEXT("  - The file passed to -changedSince lists one file or package per line (i.e. the output\n"));
+    Usage.Append(TEXT("    of git diff --name-only). A time is an ISO 8601 date, HTTP date or Unix timestamp.\n"));
+    Usage.Append(TEXT("  - With -changedSince or -includeReferencers, the assets that rules depending upon the\n"));
+    Usage.Append(TEXT("    changed packages apply to are also scanned. Referencers are only scanned if targeted.\n"));
+    Usage.Append(TEXT("  - A server request is a line of options and the response is a line containing the JSON\n"));
+    Usage.Append(TEXT("    report with an additional ExitCode field. A request of -shutdown stops the server.\n"));
+    Usage.Append(TEXT("  - Server requests only report. Requests with -fix, -save, -fixupRedirectors or an option\n"));
+    Usage.Append(TEXT("    that writes a file (i.e. -report) are rejected.\n"));
     UE_LOG(LogRuleRanger, Display, TEXT("%s"), *Usage);
 }
 
@@ -79,6 +141,7 @@ bool URuleRangerCommandlet::CollectAssetsFromPackageAllowlist(const TArray<FStri
     const auto& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
     const auto& Registry = AssetRegistry.Get();
     bool bAllPackagesResolved = true;
+    TArray<FAssetData> CandidateAssets;
     for (const auto& PackagePath : AllowlistPackages)
     {
         TArray<FAssetData> PackageAssets;
@@ -96,8 +159,10 @@ bool URuleRangerCommandlet::CollectAssetsFromPackageAllowlist(const TArray<FStri
             continue;
         }
 
-        FRuleRangerUtilities::AddPackageRepresentativeAssets(PackageAssets, Assets);
+        CandidateAssets.Append(MoveTemp(PackageAssets));
     }
+    // The representatives are selected once so that the output is not searched for every package
+    FRuleRangerUtilities::AddPackageRepresentativeAssets(CandidateAssets, Assets);
 
     return bAllPackagesResolved;
 }
@@ -178,6 +243,248 @@ void URuleRangerCommandlet::DeriveAllowlistPackages(const FString& Params, TArra
     }
 }
 
+// ReSharper disable once CppMemberFunctionMayBeStatic
+void URuleRangerCommandlet::DeriveExplainPackages(const FString& Params, TArray<FString>& ExplainPackages)
+{
+    FString ExplainParam;
+    if (FParse::Value(*Params, TEXT("explain="), ExplainParam, false))
+    {
+        TArray<FString> Paths;
+        ExplainParam.ParseIntoArray(Paths, TEXT(","), true);
+        for (const auto& Path : Paths)
+        {
+            // Accept object paths (i.e. /Game/Foo/Bar.Bar) as well as package names
+            ExplainPackages.AddUnique(FPackageName::ObjectPathToPackageName(Path.TrimStartAndEnd()));
+        }
+    }
+}
+
+// ReSharper disable once CppMemberFunctionMayBeStatic
+bool URuleRangerCommandlet::DeriveChangedPackages(const FString& ChangedSince,
+                                                  const TArray<FString>& Roots,
+                                                  TArray<FName>& ChangedPackages)
+{
+    if (FPaths::FileExists(ChangedSince))
+    {
+        TArray<FString> Lines;
+        if (!FFileHelper::LoadFileToStringArray(Lines, *ChangedSince))
+        {
+            UE_LOGFMT(LogRuleRanger, Error, "Unable to read the changed file list {Path}", ChangedSince);
+            return false;
+        }
+        TSet<FName> Checked;
+        for (const auto& Line : Lines)
+        {
+            const auto Entry = Line.TrimStartAndEnd();
+            FString PackageName;
+            if (FPackageName::IsValidLongPackageName(Entry))
+            {
+                PackageName = Entry;
+            }
+            else if (FPackageName::IsPackageExtension(*FPaths::GetExtension(Entry, true)))
+            {
+                // Relative file names are relative to the project. i.e. the output of git diff --name-only
+                const auto Filename = FPaths::IsRelative(Entry) ? FPaths::Combine(FPaths::ProjectDir(), Entry) : Entry;
+                FPackageName::TryConvertFilenameToLongPackageName(FPaths::ConvertRelativePathToFull(Filename),
+                                                                  PackageName);
+            }
+            if (!PackageName.IsEmpty())
+            {
+                bool bAlreadyChecked{ false };
+                Checked.Add(FName(PackageName), &bAlreadyChecked);
+                if (!bAlreadyChecked)
+                {
+                    ChangedPackages.Add(FName(PackageName));
+                }
+            }
+            else if (!Entry.IsEmpty())
+            {
+                UE_LOGFMT(LogRuleRanger, Verbose, "Ignored changed file {Entry} as it is not a package", Entry);
+            }
+        }
+        return true;
+    }
+    else
+    {
+        FDateTime Since;
+        if (ChangedSince.IsNumeric())
+        {
+            Since = FDateTime::FromUnixTimestamp(FCString::Atoi64(*ChangedSince));
+        }
+        else if (!FDateTime::ParseIso8601(*ChangedSince, Since) && !FDateTime::ParseHttpDate(ChangedSince, Since))
+        {
+            UE_LOGFMT(LogRuleRanger,
+                      Error,
+                      "-changedSince={Value} is neither an existing file nor a time",
+                      ChangedSince);
+            return false;
+        }
+
+        FRuleRangerUtilities::EnsureAssetRegistryReady();
+        const auto& Registry =
+            FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+        FARFilter Filter;
+        for (const auto& Root : Roots)
+        {
+            Filter.PackagePaths.Add(FName(Root));
+        }
+        Filter.bRecursivePaths = true;
+        Filter.bIncludeOnlyOnDiskAssets = true;
+        TArray<FAssetData> Candidates;
+        Registry.GetAssets(Filter, Candidates);
+
+        auto& FileManager = IFileManager::Get();
+        TSet<FName> Checked;
+        for (const auto& Candidate : Candidates)
+        {
+            if (!Checked.Contains(Candidate.PackageName))
+            {
+                Checked.Add(Candidate.PackageName);
+                FString Filename;
+                if (FPackageName::DoesPackageExist(Candidate.PackageName.ToString(), &Filename)
+                    && FileManager.GetTimeStamp(*Filename) > Since)
+                {
+                    ChangedPackages.Add(Candidate.PackageName);
+                }
+            }
+        }
+        return true;
+    }
+}
+
+// ReSharper disable once CppMemberFunctionMayBeStatic
+void URuleRangerCommandlet::CollectImpactedAssets(const TSet<FName>& ChangedPackages,
+                                                  const int32 ReferencerDepth,
+                                                  TArray<FAssetData>& Assets)
+{
+    TArray<TWeakObjectPtr<URuleRangerConfig>> Configs;
+    LoadConfigs(Configs);
+    FRuleRangerChangeImpact Impact;
+    Impact.Build(Configs);
+
+    // A change to a rule or to an asset that a rule depends upon (i.e. a DataTable) may change the
+    // results of every asset that the rule applies to
+    const auto InitialCount = Assets.Num();
+    const auto ImpactedRuleCount = Impact.CollectImpactedAssets(ChangedPackages, Assets);
+
+    // A change to an asset may change the results of the assets that reference it (i.e. the instances of a
+    // changed material) so the referencers are scanned if any rule could apply to them
+    FRuleRangerUtilities::EnsureAssetRegistryReady();
+    const auto& Registry =
+        FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+    TSet<FName> Visited{ ChangedPackages };
+    TArray<FName> Frontier{ ChangedPackages.Array() };
+    TArray<FName> Referencers;
+    TArray<FAssetData> Candidates;
+    for (auto Depth = 0; Depth < ReferencerDepth && !Frontier.IsEmpty(); ++Depth)
+    {
+        TArray<FName> Next;
+        for (const auto& PackageName : Frontier)
+        {
+            Referencers.Reset();
+            Registry.GetReferencers(PackageName, Referencers, UE::AssetRegistry::EDependencyCategory::Package);
+            for (const auto& Referencer : Referencers)
+            {
+                if (!Visited.Contains(Referencer) && !FPackageName::IsScriptPackage(Referencer.ToString()))
+                {
+                    Visited.Add(Referencer);
+                    Next.Add(Referencer);
+                    Registry.GetAssetsByPackageName(Referencer, Candidates, /*bIncludeOnlyOnDiskAssets=*/true);
+                }
+            }
+        }
+        Frontier = MoveTemp(Next);
+    }
+    TArray<FAssetData> ReferencerAssets;
+    FRuleRangerUtilities::AddPackageRepresentativeAssets(Candidates, ReferencerAssets);
+    const auto ReferencerCount = ReferencerAssets.Num();
+    Impact.RemoveUntargetedAssets(ReferencerAssets);
+    TSet<FName> SeenPackages;
+    SeenPackages.Reserve(Assets.Num() + ReferencerAssets.Num());
+    for (const auto& Asset : Assets)
+    {
+        SeenPackages.Add(Asset.PackageName);
+    }
+    for (const auto& Asset : ReferencerAssets)
+    {
+        bool bAlreadySeen{ false };
+        SeenPackages.Add(Asset.PackageName, &bAlreadySeen);
+        if (!bAlreadySeen)
+        {
+            Assets.Add(Asset);
+        }
+    }
+
+    UE_LOGFMT(LogRuleRanger,
+              Display,
+              "RuleRanger added {Count} asset(s) impacted by {ChangedCount} changed package(s). "
+              "{RuleCount} rule(s) depend upon the changes and {ReferencerCount} referencer(s) were found, "
+              "{TargetedCount} of which are targeted by rules.",
+              Assets.Num() - InitialCount,
+              ChangedPackages.Num(),
+              ImpactedRuleCount,
+              ReferencerCount,
+              ReferencerAssets.Num());
+}
+
+void URuleRangerCommandlet::CompileMaterialShaders(URuleRangerEditorSubsystem* Subsystem,
+                                                   const TArray<FAssetData>& Assets,
+                                                   const bool bFix)
+{
+    if (!GShaderCompilingManager)
+    {
+        return;
+    }
+
+    // Only load the Materials that are in the directories of a config with a rule that checks Materials
+    TArray<FAssetData> Candidates;
+    for (const auto& Asset : Assets)
+    {
+        if (Asset.IsInstanceOf(UMaterial::StaticClass()))
+        {
+            Candidates.Add(Asset);
+        }
+    }
+    Subsystem->FilterAssetsForOnDemandActions(
+        [](const auto& Action) { return Action.IsA(UEnsureMaterialHasNoCompileErrorAction::StaticClass()); },
+        Candidates);
+
+    int32 MaterialCount{ 0 };
+    for (const auto& Asset : Candidates)
+    {
+        if (const auto Material = Cast<UMaterial>(Asset.GetAsset()))
+        {
+            TArray<URuleRangerAction*> Actions;
+            Subsystem->CollectOnDemandActions(Material,
+                                              UEnsureMaterialHasNoCompileErrorAction::StaticClass(),
+                                              bFix,
+                                              Actions);
+            for (const auto Action : Actions)
+            {
+                // ReSharper disable once CppTooWideScopeInitStatement
+                const auto FeatureLevel =
+                    CastChecked<UEnsureMaterialHasNoCompileErrorAction>(Action)->GetNativeFeatureLevel();
+                if (!Material->GetMaterialResource(FeatureLevel))
+                {
+                    // Shaders are only cached for the active feature levels when the Material is loaded
+                    Material->CacheShaders(EMaterialShaderPrecompileMode::Background);
+                    break;
+                }
+            }
+            if (!Actions.IsEmpty())
+            {
+                MaterialCount++;
+                // Bound the number of outstanding jobs rather than queuing shaders for every Material up front
+                WaitForOutstandingShaderJobs(MaxOutstandingShaderJobs);
+            }
+        }
+    }
+    UE_LOGFMT(LogRuleRanger,
+              Verbose,
+              "RuleRangerCommandlet: Started shader compilation for {Count} Material(s) checked by rules",
+              MaterialCount);
+}
+
 void URuleRangerCommandlet::ResetState()
 {
     NumErrors = 0;
@@ -185,8 +492,14 @@ void URuleRangerCommandlet::ResetState()
     NumFatals = 0;
     NumAssetsScanned = 0;
     NumProjectRulesScanned = 0;
+    NumPackagesSaved = 0;
+    NumPackagesFailedToSave = 0;
+    NumCheckpointedResults = 0;
+    SaveSeconds = 0.0;
+    DirtyPackages.Reset();
     AssetRuleResults.Reset();
     ProjectRuleResults.Reset();
+    ExplainResults.Reset();
 }
 
 int32 URuleRangerCommandlet::Main(const FString& Params)
@@ -198,92 +511,348 @@ int32 URuleRangerCommandlet::Main(const FString& Params)
     }
     if (const auto Subsystem = GEditor ? GEditor->GetEditorSubsystem<URuleRangerEditorSubsystem>() : nullptr)
     {
-        const auto bFix = Params.Contains(TEXT("fix"));
-        const auto bExitOnWarning = Params.Contains(TEXT("exitOnWarning"));
-        const auto bQuiet = Params.Contains(TEXT("quiet"));
-        const bool bAssetsOnly = Params.Contains(TEXT("assetsOnly"));
-        const bool bProjectOnly = Params.Contains(TEXT("projectOnly"));
-        const bool bRunAssets = bAssetsOnly || !bProjectOnly;  // run unless explicitly project-only
-        const bool bRunProject = bProjectOnly || !bAssetsOnly; // run unless explicitly assets-only
+        return FParse::Param(*Params, TEXT("server")) ? RunServer(Subsystem, Params)
+                                                      : RunScan(Subsystem, Params, nullptr);
+    }
+    else
+    {
+        UE_LOGFMT(LogRuleRanger, Error, "RuleRangerCommandlet: Unable to get URuleRangerEditorSubsystem");
+        return 1;
+    }
+}
 
-        FString ReportPath;
-        FParse::Value(*Params, TEXT("report="), ReportPath);
+int32 URuleRangerCommandlet::RunScan(URuleRangerEditorSubsystem* Subsystem,
+                                     const FString& Params,
+                                     FString* OutResponse)
+{
+    // Matched as a whole switch so that it is not confused with -fixupRedirectors
+    const auto bFix = FParse::Param(*Params, TEXT("fix"));
+    const auto bExitOnWarning = Params.Contains(TEXT("exitOnWarning"));
+    const auto bQuiet = Params.Contains(TEXT("quiet"));
+    const bool bAssetsOnly = Params.Contains(TEXT("assetsOnly"));
+    const bool bProjectOnly = Params.Contains(TEXT("projectOnly"));
+    const bool bRunAssets = bAssetsOnly || !bProjectOnly;  // run unless explicitly project-only
+    const bool bRunProject = bProjectOnly || !bAssetsOnly; // run unless explicitly assets-only
 
-        TArray<FAssetData> Assets;
-        if (bRunAssets)
-        {
-            TArray<FString> AllowlistPaths;
-            TArray<FString> AllowlistPackages;
-            DeriveAllowlistPaths(Params, AllowlistPaths);
-            DeriveAllowlistPackages(Params, AllowlistPackages);
+    FString ReportPath;
+    FParse::Value(*Params, TEXT("report="), ReportPath);
+    FString RenamePlanPath;
+    FParse::Value(*Params, TEXT("renamePlan="), RenamePlanPath);
+    FString MatcherReportPath;
+    FParse::Value(*Params, TEXT("matcherReport="), MatcherReportPath);
+    FString CheckpointPath;
+    FParse::Value(*Params, TEXT("checkpoint="), CheckpointPath);
+    auto CheckpointInterval{ DefaultCheckpointInterval };
+    FParse::Value(*Params, TEXT("checkpointInterval="), CheckpointInterval);
+    CheckpointInterval = FMath::Max(1, CheckpointInterval);
+
+    // Fixes are the only changes made by the commandlet so there is nothing to save without -fix
+    const auto bSave = bFix && FParse::Param(*Params, TEXT("save"));
+    auto SaveBatchSize{ DefaultSaveBatchSize };
+    FParse::Value(*Params, TEXT("saveBatchSize="), SaveBatchSize);
+    SaveBatchSize = FMath::Max(1, SaveBatchSize);
+
+    TArray<FString> ExplainPackages;
+    DeriveExplainPackages(Params, ExplainPackages);
+
+    TArray<FAssetData> Assets;
+    if (bRunAssets)
+    {
+        TArray<FString> AllowlistPaths;
+        TArray<FString> AllowlistPackages;
+        DeriveAllowlistPaths(Params, AllowlistPaths);
+        DeriveAllowlistPackages(Params, AllowlistPackages);
 
-            if (AllowlistPaths.IsEmpty() && AllowlistPackages.IsEmpty())
+        TSet<FName> ChangedPackages;
+        FString ChangedSince;
+        const auto bChangedSince = FParse::Value(*Params, TEXT("changedSince="), ChangedSince, false);
+        if (bChangedSince)
+        {
+            // The content roots select the packages checked for modifications rather than being scanned in full
+            TArray<FName> Changed;
+            if (!DeriveChangedPackages(ChangedSince,
+                                       AllowlistPaths.IsEmpty() ? TArray<FString>{ TEXT("/Game") } : AllowlistPaths,
+                                       Changed))
+            {
+                ResetState();
+                return 1;
+            }
+            AllowlistPaths.Reset();
+            TSet<FString> SeenPackages{ AllowlistPackages };
+            for (const auto& PackageName : Changed)
+            {
+                ChangedPackages.Add(PackageName);
+                // Deleted packages are not scanned but the packages that referenced them are
+                if (const auto PackageString = PackageName.ToString();
+                    FPackageName::DoesPackageExist(PackageString) && !SeenPackages.Contains(PackageString))
+                {
+                    SeenPackages.Add(PackageString);
+                    AllowlistPackages.Add(PackageString);
+                }
+            }
+            UE_LOGFMT(LogRuleRanger, Display, "RuleRanger detected {Count} changed package(s)", Changed.Num());
+        }
+        else if (AllowlistPaths.IsEmpty() && AllowlistPackages.IsEmpty())
+        {
+            if (ExplainPackages.IsEmpty())
             {
                 AllowlistPaths.Add(TEXT("/Game"));
             }
+            else
+            {
+                AllowlistPackages = ExplainPackages;
+            }
+        }
 
-            if (!CollectAssetsFromPathAllowlist(AllowlistPaths, Assets)
-                || !CollectAssetsFromPackageAllowlist(AllowlistPackages, Assets))
+        if (!CollectAssetsFromPathAllowlist(AllowlistPaths, Assets)
+            || !CollectAssetsFromPackageAllowlist(AllowlistPackages, Assets))
+        {
+            ResetState();
+            return 1;
+        }
+
+        auto ReferencerDepth{ 0 };
+        FParse::Value(*Params, TEXT("includeReferencers="), ReferencerDepth);
+        if (bChangedSince || ReferencerDepth > 0)
+        {
+            for (const auto& PackageName : AllowlistPackages)
             {
-                ResetState();
-                return 1;
+                ChangedPackages.Add(FName(PackageName));
             }
+            CollectImpactedAssets(ChangedPackages, ReferencerDepth, Assets);
         }
+    }
 
-        // Reset state
-        ResetState();
+    // Reset state
+    ResetState();
 
-        // blocks until all async package loads are finished
-        FlushAsyncLoading();
+    // Restore the progress of the previous scan and skip the packages that it completed or died while processing
+    TUniquePtr<FRuleRangerScanCheckpoint> Checkpoint;
+    if (!CheckpointPath.IsEmpty())
+    {
+        Checkpoint = MakeUnique<FRuleRangerScanCheckpoint>(CheckpointPath);
+        FRuleRangerScanCounters Counters;
+        if (!Checkpoint->Load(FParse::Param(*Params, TEXT("resume")), Counters, AssetRuleResults))
+        {
+            ResetState();
+            return 1;
+        }
+        SetScanCounters(Counters);
+        NumCheckpointedResults = AssetRuleResults.Num();
+        Assets.RemoveAll([this, &Checkpoint](const FAssetData& Asset) {
+            if (Checkpoint->IsCompleted(Asset.PackageName))
+            {
+                return true;
+            }
+            else if (Checkpoint->IsQuarantined(Asset.PackageName))
+            {
+                UE_LOGFMT(LogRuleRanger,
+                          Error,
+                          "RuleRanger skipped package {Package} as it was quarantined when a previous scan "
+                          "stopped while processing it",
+                          Asset.PackageName);
+                NumErrors++;
+                // Completed so that the error is not reported again if this scan is resumed
+                Checkpoint->MarkCompleted(Asset.PackageName);
+                return true;
+            }
+            else
+            {
+                return false;
+            }
+        });
+    }
+
+    // blocks until all async package loads are finished
+    FlushAsyncLoading();
+
+    FDelegateHandle PackageMarkedDirtyHandle;
+    if (bSave)
+    {
+        PackageMarkedDirtyHandle =
+            UPackage::PackageMarkedDirtyEvent.AddUObject(this, &URuleRangerCommandlet::OnPackageMarkedDirty);
+    }
+    const auto ScanStartTime = FPlatformTime::Seconds();
 
-        // Make sure all shaders are compiled
-        WaitForShaders();
+    // --- Scan assets ---
+    if (bRunAssets)
+    {
+        // Only compile the shaders for Materials checked by rules. Each Material waits
+        // for its own shaders when it is checked rather than waiting for all shaders here
+        CompileMaterialShaders(Subsystem, Assets, bFix);
 
-        // --- Scan assets ---
-        if (bRunAssets)
+        if (bFix)
         {
-            for (const auto& Asset : Assets)
+            // Allow actions to prepare all the assets at once (i.e. batch compile) rather than one at a time
+            Subsystem->PrepareAssetsForFix(Assets);
+        }
+
+        // Renames are performed together before each checkpoint and once every asset has been scanned
+        FRuleRangerRenameBatch RenameBatch;
+        if (FParse::Param(*Params, TEXT("fixupRedirectors")))
+        {
+            RenameBatch.SetFixupRedirectors(true);
+        }
+        for (const auto& Asset : Assets)
+        {
+            CurrentAsset = Asset;
+            if (Checkpoint)
             {
-                CurrentAsset = Asset;
-                if (const auto Object = Asset.GetAsset())
+                // Recorded before the package is loaded as loading a bad asset is the most likely cause of a crash
+                Checkpoint->BeginPackage(Asset.PackageName);
+            }
+            if (const auto Object = Asset.GetAsset())
+            {
+                NumAssetsScanned++;
+                if (ExplainPackages.Contains(Asset.PackageName.ToString()))
                 {
-                    NumAssetsScanned++;
-                    if (bFix)
-                    {
-                        Subsystem->ScanAndFixObject(Object, this);
-                    }
-                    else
-                    {
-                        Subsystem->ScanObject(Object, this);
-                    }
+                    FRuleRangerExplainTrace Trace;
+                    Subsystem->ExplainObject(Object, bFix, Trace, this);
+                    UE_LOGFMT(LogRuleRanger, Display, "RuleRanger explanation:\n{Explanation}", Trace.ToText());
+                    ExplainResults.Append(Trace.ToJson());
                 }
+                else if (bFix)
+                {
+                    Subsystem->ScanAndFixObject(Object, this);
+                }
+                else
+                {
+                    Subsystem->ScanObject(Object, this);
+                }
+            }
+            if (Checkpoint)
+            {
+                Checkpoint->EndPackage(Asset.PackageName);
             }
+            if (bSave && DirtyPackages.Num() >= SaveBatchSize)
+            {
+                // Save at a checkpoint so that the packages loaded so far can be released
+                SaveDirtyPackages();
+                CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+            }
+            if (Checkpoint && Checkpoint->GetUnsavedCount() >= CheckpointInterval)
+            {
+                // A package is only completed once the renames queued while processing it have been performed
+                NumErrors += RenameBatch.Execute();
+                SaveCheckpoint(*Checkpoint, bSave);
+            }
+        }
+        NumErrors += RenameBatch.Execute();
+        if (Checkpoint)
+        {
+            SaveCheckpoint(*Checkpoint, bSave);
         }
 
-        // Execute project-level rules (scan or fix)
-        if (bRunProject)
+        if (!RenamePlanPath.IsEmpty())
         {
-            ExecuteProjectRules(bFix);
+            if (RenameBatch.ExportPlan(RenamePlanPath))
+            {
+                if (!bQuiet)
+                {
+                    UE_LOGFMT(LogRuleRanger, Display, "RuleRanger rename plan written to {Path}", RenamePlanPath);
+                }
+            }
+            else
+            {
+                UE_LOGFMT(LogRuleRanger, Error, "Unable to write rename plan to {Path}", RenamePlanPath);
+                NumErrors++;
+            }
         }
 
-        // --- JSON report ---
-        if (!ReportPath.IsEmpty())
+        // Persist the matcher measurements so that later scans start with the order learned by this scan
+        auto& MatcherStats = FRuleRangerMatcherStats::Get();
+        MatcherStats.Save();
+        if (!MatcherReportPath.IsEmpty())
         {
-            const auto Root = MakeShared<FJsonObject>();
+            if (MatcherStats.ExportReport(MatcherReportPath))
+            {
+                if (!bQuiet)
+                {
+                    UE_LOGFMT(LogRuleRanger, Display, "RuleRanger matcher report written to {Path}", MatcherReportPath);
+                }
+            }
+            else
+            {
+                UE_LOGFMT(LogRuleRanger, Error, "Unable to write matcher report to {Path}", MatcherReportPath);
+                NumErrors++;
+            }
+        }
+    }
+
+    // Execute project-level rules (scan or fix)
+    if (bRunProject)
+    {
+        ExecuteProjectRules(bFix);
+    }
+
+    // Time spent saving at checkpoints is reported separately from the time spent scanning
+    const auto ScanSeconds = FPlatformTime::Seconds() - ScanStartTime - SaveSeconds;
+    UE_LOGFMT(LogRuleRanger,
+              Display,
+              "RuleRanger scanned {Count} asset(s) in {Seconds} seconds",
+              NumAssetsScanned,
+              FString::Printf(TEXT("%.2f"), ScanSeconds));
 
-            // Summary
-            const auto Summary = MakeShared<FJsonObject>();
-            Summary->SetNumberField(TEXT("AssetsScanned"), NumAssetsScanned);
-            Summary->SetNumberField(TEXT("Errors"), NumErrors);
-            Summary->SetNumberField(TEXT("Warnings"), NumWarnings);
-            Summary->SetNumberField(TEXT("Fatals"), NumFatals);
-            Summary->SetNumberField(TEXT("ProjectRulesExecuted"), NumProjectRulesScanned);
-            Root->SetObjectField(TEXT("Summary"), Summary);
+    if (bSave)
+    {
+        SaveDirtyPackages();
+        UPackage::PackageMarkedDirtyEvent.Remove(PackageMarkedDirtyHandle);
+        UE_LOGFMT(LogRuleRanger,
+                  Display,
+                  "RuleRanger saved {Count} package(s) in {Seconds} seconds. {FailedCount} package(s) failed.",
+                  NumPackagesSaved,
+                  FString::Printf(TEXT("%.2f"), SaveSeconds),
+                  NumPackagesFailedToSave);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> QuarantinedPackages;
+    if (Checkpoint)
+    {
+        // The scan completed so only the quarantined packages are retained for later scans
+        Checkpoint->Complete();
+        for (const auto& PackageName : Checkpoint->GetQuarantinedPackages())
+        {
+            QuarantinedPackages.Add(MakeShared<FJsonValueString>(PackageName.ToString()));
+        }
+    }
+
+    const int32 Result = NumErrors > 0 || NumFatals > 0 || (bExitOnWarning && NumWarnings > 0) ? 1 : 0;
+
+    // --- JSON report ---
+    if (!ReportPath.IsEmpty() || OutResponse)
+    {
+        const auto Root = MakeShared<FJsonObject>();
+
+        // Summary
+        const auto Summary = MakeShared<FJsonObject>();
+        Summary->SetNumberField(TEXT("AssetsScanned"), NumAssetsScanned);
+        Summary->SetNumberField(TEXT("Errors"), NumErrors);
+        Summary->SetNumberField(TEXT("Warnings"), NumWarnings);
+        Summary->SetNumberField(TEXT("Fatals"), NumFatals);
+        Summary->SetNumberField(TEXT("ProjectRulesExecuted"), NumProjectRulesScanned);
+        Summary->SetNumberField(TEXT("ScanSeconds"), ScanSeconds);
+        if (bSave)
+        {
+            Summary->SetNumberField(TEXT("PackagesSaved"), NumPackagesSaved);
+            Summary->SetNumberField(TEXT("PackagesFailedToSave"), NumPackagesFailedToSave);
+            Summary->SetNumberField(TEXT("SaveSeconds"), SaveSeconds);
+        }
+        Root->SetObjectField(TEXT("Summary"), Summary);
 
-            // Results
-            Root->SetArrayField(TEXT("AssetRuleResults"), AssetRuleResults);
-            Root->SetArrayField(TEXT("ProjectRuleResults"), ProjectRuleResults);
+        // Results
+        Root->SetArrayField(TEXT("AssetRuleResults"), AssetRuleResults);
+        Root->SetArrayField(TEXT("ProjectRuleResults"), ProjectRuleResults);
+        if (Checkpoint)
+        {
+            Root->SetArrayField(TEXT("QuarantinedPackages"), QuarantinedPackages);
+        }
+        if (!ExplainPackages.IsEmpty())
+        {
+            Root->SetArrayField(TEXT("Explain"), ExplainResults);
+        }
 
+        if (!ReportPath.IsEmpty())
+        {
             FString OutputString;
             const auto Writer = TJsonWriterFactory<>::Create(&OutputString);
             FJsonSerializer::Serialize(Root, Writer);
@@ -295,18 +864,176 @@ int32 URuleRangerCommandlet::Main(const FString& Params)
                 UE_LOGFMT(LogRuleRanger, Display, "RuleRanger report written to {Path}", ReportPath);
             }
         }
+        if (OutResponse)
+        {
+            // The response is a single line so that the client can detect the end of the response
+            Root->SetNumberField(TEXT("ExitCode"), Result);
+            const auto Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(OutResponse);
+            FJsonSerializer::Serialize(Root, Writer);
+        }
+    }
 
-        const int32 Result = NumErrors > 0 || NumFatals > 0 || (bExitOnWarning && NumWarnings > 0) ? 1 : 0;
-        ResetState();
-        return Result;
+    ResetState();
+    return Result;
+}
+
+int32 URuleRangerCommandlet::RunServer(URuleRangerEditorSubsystem* Subsystem, const FString& Params)
+{
+    auto Port{ DefaultServerPort };
+    FParse::Value(*Params, TEXT("serverPort="), Port);
+    auto IdleTimeoutSeconds{ DefaultServerIdleTimeoutSeconds };
+    FParse::Value(*Params, TEXT("serverIdleTimeout="), IdleTimeoutSeconds);
+
+    // The asset registry is populated once and kept warm for every request
+    FRuleRangerUtilities::EnsureAssetRegistryReady();
+    TrackLoadedPackageTimestamps();
+
+    FRuleRangerCommandletServer Server(Port, [this, Subsystem](const FString& Request) {
+        FString Option;
+        if (FindDisallowedServerOption(Request, Option))
+        {
+            UE_LOGFMT(LogRuleRanger, Error, "RuleRanger server rejected a request with the -{Option} option", Option);
+            return FString::Printf(
+                TEXT("{\"ExitCode\":1,\"Error\":\"The -%s option is not supported by server requests\"}"),
+                *Option);
+        }
+
+        RefreshAssetRegistry(Request);
+        // Assets are RF_Standalone so they remain loaded between requests. Any that changed on disk are reloaded.
+        ReloadModifiedPackages();
+
+        FString Response;
+        const auto ExitCode = RunScan(Subsystem, Request, &Response);
+        if (Response.IsEmpty())
+        {
+            // The request failed before a report was produced (i.e. an unknown package)
+            Response = FString::Printf(TEXT("{\"ExitCode\":%d}"), ExitCode);
+        }
+
+        // Release the transient objects created by the scan. The loaded assets remain loaded.
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+        TrackLoadedPackageTimestamps();
+        return Response;
+    });
+    if (Server.Start())
+    {
+        UE_LOGFMT(LogRuleRanger, Display, "RuleRanger server listening on 127.0.0.1:{Port}", Server.GetPort());
+        Server.Run(IdleTimeoutSeconds);
+        return 0;
     }
     else
     {
-        UE_LOGFMT(LogRuleRanger, Error, "RuleRangerCommandlet: Unable to get URuleRangerEditorSubsystem");
         return 1;
     }
 }
 
+bool URuleRangerCommandlet::FindDisallowedServerOption(const FString& Request, FString& OutOption) const
+{
+    for (const auto Switch : ServerDisallowedSwitches)
+    {
+        if (FParse::Param(*Request, Switch))
+        {
+            OutOption = Switch;
+            return true;
+        }
+    }
+    for (const auto Value : ServerDisallowedValues)
+    {
+        FString Ignored;
+        if (FParse::Value(*Request, Value, Ignored))
+        {
+            OutOption = FString(Value).LeftChop(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void URuleRangerCommandlet::TrackLoadedPackageTimestamps()
+{
+    for (TObjectIterator<UPackage> It; It; ++It)
+    {
+        const auto PackageName = It->GetFName();
+        if (!LoadedPackageTimestamps.Contains(PackageName) && !FPackageName::IsScriptPackage(PackageName.ToString()))
+        {
+            // Packages that have no file on disk (i.e. transient packages) are recorded so they are not checked again
+            FString Filename;
+            LoadedPackageTimestamps.Add(PackageName,
+                                        FPackageName::DoesPackageExist(PackageName.ToString(), &Filename)
+                                            ? IFileManager::Get().GetTimeStamp(*Filename)
+                                            : FDateTime::MinValue());
+        }
+    }
+}
+
+void URuleRangerCommandlet::ReloadModifiedPackages()
+{
+    TArray<UPackage*> Packages;
+    for (auto It = LoadedPackageTimestamps.CreateIterator(); It; ++It)
+    {
+        if (FDateTime::MinValue() != It.Value())
+        {
+            const auto Package = FindPackage(nullptr, *It.Key().ToString());
+            if (!Package)
+            {
+                // A package that was unloaded is loaded from disk and tracked again when it is next used
+                It.RemoveCurrent();
+            }
+            else
+            {
+                FString Filename;
+                if (FPackageName::DoesPackageExist(It.Key().ToString(), &Filename))
+                {
+                    // ReSharper disable once CppTooWideScopeInitStatement
+                    const auto Timestamp = IFileManager::Get().GetTimeStamp(*Filename);
+                    if (Timestamp != It.Value())
+                    {
+                        It.Value() = Timestamp;
+                        Packages.Add(Package);
+                    }
+                }
+            }
+        }
+    }
+    if (!Packages.IsEmpty())
+    {
+        UE_LOGFMT(LogRuleRanger, Display, "RuleRanger reloading {Count} package(s) modified on disk", Packages.Num());
+        FText ErrorMessage;
+        if (!UPackageTools::ReloadPackages(Packages, ErrorMessage, EReloadPackagesInteractionMode::AssumePositive))
+        {
+            UE_LOGFMT(LogRuleRanger, Warning, "RuleRanger failed to reload packages: {Error}", ErrorMessage.ToString());
+        }
+    }
+}
+
+void URuleRangerCommandlet::RefreshAssetRegistry(const FString& Params)
+{
+    TArray<FString> Paths;
+    TArray<FString> Packages;
+    DeriveAllowlistPaths(Params, Paths);
+    DeriveAllowlistPackages(Params, Packages);
+
+    auto& AssetRegistry =
+        FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+    TArray<FString> Files;
+    for (const auto& Package : Packages)
+    {
+        FString Filename;
+        if (FPackageName::DoesPackageExist(Package, &Filename))
+        {
+            Files.Add(MoveTemp(Filename));
+        }
+    }
+    if (!Files.IsEmpty())
+    {
+        AssetRegistry.ScanFilesSynchronous(Files, true);
+    }
+    if (!Paths.IsEmpty())
+    {
+        AssetRegistry.ScanPathsSynchronous(Paths, true);
+    }
+}
+
 void URuleRangerCommandlet::OnRuleApplied(URuleRangerActionContext* ActionContext)
 {
     const auto Fatals = ActionContext->GetFatalMessages().Num();
@@ -352,6 +1079,14 @@ void URuleRangerCommandlet::OnRuleApplied(URuleRangerActionContext* ActionContex
 }
 
 void URuleRangerCommandlet::ExecuteProjectRules(const bool bFix)
+{
+    TArray<TWeakObjectPtr<URuleRangerConfig>> Configs;
+    LoadConfigs(Configs);
+    ExecuteProjectRulesForConfigs(Configs, bFix);
+}
+
+// ReSharper disable once CppMemberFunctionMayBeStatic
+void URuleRangerCommandlet::LoadConfigs(TArray<TWeakObjectPtr<URuleRangerConfig>>& Configs)
 {
     // Build list of configured RuleRangerConfig assets from developer settings
     const auto DevSettings = GetDefault<URuleRangerDeveloperSettings>();
@@ -361,7 +1096,6 @@ void URuleRangerCommandlet::ExecuteProjectRules(const bool bFix)
         return;
     }
 
-    TArray<TWeakObjectPtr<URuleRangerConfig>> Configs;
     for (const auto& SoftConfig : DevSettings->Configs)
     {
         if (const auto Config = SoftConfig.LoadSynchronous())
@@ -373,8 +1107,6 @@ void URuleRangerCommandlet::ExecuteProjectRules(const bool bFix)
             UE_LOGFMT(LogRuleRanger, Error, "RuleRangerCommandlet: Invalid RuleRangerConfig skipped");
         }
     }
-
-    ExecuteProjectRulesForConfigs(Configs, bFix);
 }
 
 void URuleRangerCommandlet::ExecuteProjectRulesForConfigs(
@@ -385,69 +1117,188 @@ void URuleRangerCommandlet::ExecuteProjectRulesForConfigs(
     const auto ProjectContext =
         NewObject<URuleRangerProjectActionContext>(this, URuleRangerProjectActionContext::StaticClass());
 
-    RuleRanger::Traversal::TraverseProjectRulesForConfigs(Configs, [&, bFix](auto Config, auto RuleSet, auto Rule) {
-        // Apply the rule
-        const auto Trigger =
-            bFix ? ERuleRangerProjectActionTrigger::AT_Fix : ERuleRangerProjectActionTrigger::AT_Report;
+    if (bFix)
+    {
+        RuleRanger::Traversal::TraverseProjectRulesForConfigs(Configs, [&](auto Config, auto RuleSet, auto Rule) {
+            ProjectContext->ResetContext(Config, RuleSet, Rule, ERuleRangerProjectActionTrigger::AT_Fix);
+            Rule->Apply(ProjectContext);
+
+            const auto State = RecordProjectRuleResult(ProjectContext);
+            ProjectContext->ClearContext();
+
+            if (ERuleRangerActionState::AS_Fatal == State)
+            {
+                return false; // stop processing
+            }
+            else if (ERuleRangerActionState::AS_Error == State && !Rule->bContinueOnError)
+            {
+                return false; // stop processing on error in fix mode if rule disallows continue
+            }
+            return true;
+        });
+    }
+    else
+    {
+        // Report mode rules may be applied concurrently but results are recorded in traversal order
+        RuleRanger::Traversal::ReportProjectRulesForConfigs(Configs, ProjectContext, [this](auto ActionContext) {
+            return ERuleRangerActionState::AS_Fatal != RecordProjectRuleResult(ActionContext);
+        });
+    }
+}
 
-        ProjectContext->ResetContext(Config, RuleSet, Rule, Trigger);
-        Rule->Apply(ProjectContext);
+ERuleRangerActionState URuleRangerCommandlet::RecordProjectRuleResult(const URuleRangerProjectActionContext* Context)
+{
+    // Aggregate messages into counts and JSON results
+    const auto Fatals = Context->GetFatalMessages().Num();
+    const auto Errors = Context->GetErrorMessages().Num();
+    const auto Warnings = Context->GetWarningMessages().Num();
 
-        // Aggregate messages into counts and JSON results
-        const auto Fatals = ProjectContext->GetFatalMessages().Num();
-        const auto Errors = ProjectContext->GetErrorMessages().Num();
-        const auto Warnings = ProjectContext->GetWarningMessages().Num();
+    NumFatals += Fatals;
+    NumErrors += Errors;
+    NumWarnings += Warnings;
+    ++NumProjectRulesScanned;
 
-        NumFatals += Fatals;
-        NumErrors += Errors;
-        NumWarnings += Warnings;
-        ++NumProjectRulesScanned;
+    if (Warnings > 0 || Errors > 0 || Fatals > 0)
+    {
+        const auto Rule = Context->GetRule();
+        auto Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("RuleName"), Rule->GetName());
+        Result->SetStringField(TEXT("RulePath"), Rule->GetPathName());
+        Result->SetStringField(TEXT("RuleSetPath"), Context->GetRuleSet()->GetPathName());
 
-        if (Warnings > 0 || Errors > 0 || Fatals > 0)
+        if (Errors > 0 || Fatals > 0)
         {
-            auto Result = MakeShared<FJsonObject>();
-            Result->SetStringField(TEXT("RuleName"), Rule->GetName());
-            Result->SetStringField(TEXT("RulePath"), Rule->GetPathName());
-            Result->SetStringField(TEXT("RuleSetPath"), RuleSet->GetPathName());
-
-            if (Errors > 0 || Fatals > 0)
+            TArray<TSharedPtr<FJsonValue>> ErrorsJson;
+            for (const auto& Msg : Context->GetErrorMessages())
             {
-                TArray<TSharedPtr<FJsonValue>> ErrorsJson;
-                for (const auto& Msg : ProjectContext->GetErrorMessages())
-                {
-                    ErrorsJson.Add(MakeShared<FJsonValueString>(Msg.ToString()));
-                }
-                for (const auto& Msg : ProjectContext->GetFatalMessages())
-                {
-                    ErrorsJson.Add(MakeShared<FJsonValueString>(Msg.ToString()));
-                }
-                Result->SetArrayField(TEXT("Errors"), ErrorsJson);
+                ErrorsJson.Add(MakeShared<FJsonValueString>(Msg.ToString()));
             }
-
-            if (Warnings > 0)
+            for (const auto& Msg : Context->GetFatalMessages())
             {
-                TArray<TSharedPtr<FJsonValue>> WarningsJson;
-                for (const auto& Msg : ProjectContext->GetWarningMessages())
-                {
-                    WarningsJson.Add(MakeShared<FJsonValueString>(Msg.ToString()));
-                }
-                Result->SetArrayField(TEXT("Warnings"), WarningsJson);
+                ErrorsJson.Add(MakeShared<FJsonValueString>(Msg.ToString()));
             }
+            Result->SetArrayField(TEXT("Errors"), ErrorsJson);
+        }
 
-            ProjectRuleResults.Add(MakeShared<FJsonValueObject>(Result));
+        if (Warnings > 0)
+        {
+            TArray<TSharedPtr<FJsonValue>> WarningsJson;
+            for (const auto& Msg : Context->GetWarningMessages())
+            {
+                WarningsJson.Add(MakeShared<FJsonValueString>(Msg.ToString()));
+            }
+            Result->SetArrayField(TEXT("Warnings"), WarningsJson);
         }
 
-        const auto State = ProjectContext->GetState();
-        ProjectContext->ClearContext();
+        ProjectRuleResults.Add(MakeShared<FJsonValueObject>(Result));
+    }
+
+    return Context->GetState();
+}
+
+void URuleRangerCommandlet::OnPackageMarkedDirty(UPackage* Package, bool)
+{
+    if (IsValid(Package))
+    {
+        DirtyPackages.Add(Package);
+    }
+}
 
-        if (ERuleRangerActionState::AS_Fatal == State)
+void URuleRangerCommandlet::SaveDirtyPackages()
+{
+    const auto StartTime = FPlatformTime::Seconds();
+
+    TArray<UPackage*> Packages;
+    for (const auto& DirtyPackage : DirtyPackages)
+    {
+        // ReSharper disable once CppTooWideScopeInitStatement
+        const auto Package = DirtyPackage.Get();
+        if (IsValid(Package) && Package->IsDirty() && !Package->HasAnyFlags(RF_Transient)
+            && !Package->HasAnyPackageFlags(PKG_CompiledIn | PKG_InMemoryOnly) && !UPackage::IsEmptyPackage(Package))
         {
-            return false; // stop processing
+            Packages.Add(Package);
         }
-        else if (bFix && ERuleRangerActionState::AS_Error == State && !Rule->bContinueOnError)
+    }
+    DirtyPackages.Reset();
+
+    auto FailedCount{ 0 };
+    FSavePackageArgs SaveArgs;
+    SaveArgs.TopLevelFlags = RF_Standalone;
+    // File writes complete asynchronously so that writing a package overlaps serializing the next package
+    SaveArgs.SaveFlags = SAVE_Async;
+    for (const auto Package : Packages)
+    {
+        FString Filename;
+        const auto& Extension =
+            Package->ContainsMap() ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension();
+        if (!FPackageName::TryConvertLongPackageNameToFilename(Package->GetName(), Filename, Extension))
         {
-            return false; // stop processing on error in fix mode if rule disallows continue
+            UE_LOGFMT(LogRuleRanger, Error, "Unable to determine the file for package {Package}", Package->GetName());
+            FailedCount++;
         }
-        return true;
-    });
+        else if (IFileManager::Get().IsReadOnly(*Filename))
+        {
+            UE_LOGFMT(LogRuleRanger,
+                      Error,
+                      "Unable to save package {Package} as {Filename} is read-only",
+                      Package->GetName(),
+                      Filename);
+            FailedCount++;
+        }
+        else if (!UPackage::SavePackage(Package, nullptr, *Filename, SaveArgs))
+        {
+            UE_LOGFMT(LogRuleRanger, Error, "Failed to save package {Package}", Package->GetName());
+            FailedCount++;
+        }
+        else
+        {
+            UE_LOGFMT(LogRuleRanger, Verbose, "Saved package {Package}", Package->GetName());
+            NumPackagesSaved++;
+        }
+    }
+    UPackage::WaitForAsyncFileWrites();
+
+    NumPackagesFailedToSave += FailedCount;
+    NumErrors += FailedCount;
+    SaveSeconds += FPlatformTime::Seconds() - StartTime;
+}
+
+FRuleRangerScanCounters URuleRangerCommandlet::GetScanCounters() const
+{
+    FRuleRangerScanCounters Counters;
+    Counters.Errors = NumErrors;
+    Counters.Warnings = NumWarnings;
+    Counters.Fatals = NumFatals;
+    Counters.AssetsScanned = NumAssetsScanned;
+    Counters.PackagesSaved = NumPackagesSaved;
+    Counters.PackagesFailedToSave = NumPackagesFailedToSave;
+    return Counters;
+}
+
+void URuleRangerCommandlet::SetScanCounters(const FRuleRangerScanCounters& Counters)
+{
+    NumErrors = Counters.Errors;
+    NumWarnings = Counters.Warnings;
+    NumFatals = Counters.Fatals;
+    NumAssetsScanned = Counters.AssetsScanned;
+    NumPackagesSaved = Counters.PackagesSaved;
+    NumPackagesFailedToSave = Counters.PackagesFailedToSave;
+}
+
+void URuleRangerCommandlet::SaveCheckpoint(FRuleRangerScanCheckpoint& Checkpoint, const bool bSave)
+{
+    if (bSave)
+    {
+        // Packages are only recorded as completed once the fixes applied to them have been saved
+        SaveDirtyPackages();
+    }
+    const auto NewResults = TConstArrayView<TSharedPtr<FJsonValue>>(AssetRuleResults).RightChop(NumCheckpointedResults);
+    if (Checkpoint.Save(GetScanCounters(), NewResults))
+    {
+        NumCheckpointedResults = AssetRuleResults.Num();
+    }
+    else
+    {
+        NumErrors++;
+    }
 }
@@ -14,10 +14,14 @@
 #pragma once
 
 #include "Commandlets/Commandlet.h"
+#include "RuleRangerCommonContext.h"
 #include "RuleRangerResultHandler.h"
 #include "RuleRangerCommandlet.generated.h"
 
+class FRuleRangerScanCheckpoint;
+struct FRuleRangerScanCounters;
 class URuleRangerConfig;
+class URuleRangerEditorSubsystem;
 class URuleRangerRuleSet;
 class URuleRangerProjectRule;
 class URuleRangerProjectActionContext;
@@ -35,9 +39,28 @@ class URuleRangerCommandlet final : public UCommandlet, public IRuleRangerResult
     bool CollectAssetsFromPathAllowlist(const TArray<FString>& AllowlistPaths, TArray<FAssetData>& Assets);
     void DeriveAllowlistPaths(const FString& Params, TArray<FString>& AllowlistPaths);
     void DeriveAllowlistPackages(const FString& Params, TArray<FString>& AllowlistPackages);
+    void DeriveExplainPackages(const FString& Params, TArray<FString>& ExplainPackages);
+    bool DeriveChangedPackages(const FString& ChangedSince,
+                               const TArray<FString>& Roots,
+                               TArray<FName>& ChangedPackages);
+    void CollectImpactedAssets(const TSet<FName>& ChangedPackages, int32 ReferencerDepth, TArray<FAssetData>& Assets);
+    void LoadConfigs(TArray<TWeakObjectPtr<URuleRangerConfig>>& Configs);
+    void RefreshAssetRegistry(const FString& Params);
+    bool FindDisallowedServerOption(const FString& Request, FString& OutOption) const;
+    void TrackLoadedPackageTimestamps();
+    void ReloadModifiedPackages();
+    int32 RunScan(URuleRangerEditorSubsystem* Subsystem, const FString& Params, FString* OutResponse);
+    int32 RunServer(URuleRangerEditorSubsystem* Subsystem, const FString& Params);
     void ResetState();
+    void CompileMaterialShaders(URuleRangerEditorSubsystem* Subsystem, const TArray<FAssetData>& Assets, bool bFix);
     void ExecuteProjectRules(bool bFix);
     void ExecuteProjectRulesForConfigs(TConstArrayView<TWeakObjectPtr<URuleRangerConfig>> Configs, bool bFix);
+    ERuleRangerActionState RecordProjectRuleResult(const URuleRangerProjectActionContext* Context);
+    void OnPackageMarkedDirty(UPackage* Package, bool bWasDirty);
+    void SaveDirtyPackages();
+    FRuleRangerScanCounters GetScanCounters() const;
+    void SetScanCounters(const FRuleRangerScanCounters& Counters);
+    void SaveCheckpoint(FRuleRangerScanCheckpoint& Checkpoint, bool bSave);
 
     FAssetData CurrentAsset;
     int32 NumErrors{ 0 };
@@ -45,10 +68,28 @@ class URuleRangerCommandlet final : public UCommandlet, public IRuleRangerResult
     int32 NumFatals{ 0 };
     int32 NumAssetsScanned{ 0 };
     int32 NumProjectRulesScanned{ 0 };
+    int32 NumPackagesSaved{ 0 };
+    int32 NumPackagesFailedToSave{ 0 };
+    double SaveSeconds{ 0.0 };
+
+    /** The packages marked dirty since they were last saved. Only collected when -save is specified. */
+    TSet<TWeakObjectPtr<UPackage>> DirtyPackages;
 
     TArray<TSharedPtr<FJsonValue>> AssetRuleResults;
     TArray<TSharedPtr<FJsonValue>> ProjectRuleResults;
 
+    /** The decisions recorded for the assets specified by -explain. */
+    TArray<TSharedPtr<FJsonValue>> ExplainResults;
+
+    /** The number of AssetRuleResults persisted by the last save of the checkpoint when -checkpoint is specified. */
+    int32 NumCheckpointedResults{ 0 };
+
+    /**
+     * The file timestamps of the packages loaded while running with -server. Loaded packages remain loaded between
+     * requests, so a package is reloaded when its timestamp changes. Packages without a file use FDateTime::MinValue().
+     */
+    TMap<FName, FDateTime> LoadedPackageTimestamps;
+
 public:
     URuleRangerCommandlet();
 
@@ -0,0 +1,233 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "RuleRangerCommandletServer.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Common/TcpSocketBuilder.h"
+#include "Containers/Ticker.h"
+#include "CoreGlobals.h"
+#include "Interfaces/IPv4/IPv4Address.h"
+#include "Logging/StructuredLog.h"
+#include "RuleRangerLogging.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+
+namespace
+{
+    const FString ShutdownRequest{ TEXT("-shutdown") };
+
+    // The maximum time to wait for the client to send the request or accept the response
+    const FTimespan TransferTimeout{ FTimespan::FromSeconds(30) };
+} // namespace
+
+FRuleRangerCommandletServer::FRuleRangerCommandletServer(const int32 InPort, FRequestHandler InHandler)
+    : Port(InPort), Handler(MoveTemp(InHandler))
+{
+}
+
+FRuleRangerCommandletServer::~FRuleRangerCommandletServer()
+{
+    if (Listener)
+    {
+        Listener->Close();
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Listener);
+        Listener = nullptr;
+    }
+}
+
+bool FRuleRangerCommandletServer::Start()
+{
+    if (!Listener)
+    {
+        // Only accept connections from the local machine
+        Listener = FTcpSocketBuilder(TEXT("RuleRangerCommandletServer"))
+                       .AsReusable()
+                       .BoundToAddress(FIPv4Address(127, 0, 0, 1))
+                       .BoundToPort(Port)
+                       .Listening(8)
+                       .Build();
+        if (Listener)
+        {
+            Port = Listener->GetPortNo();
+        }
+        else
+        {
+            UE_LOGFMT(LogRuleRanger, Error, "RuleRanger server is unable to listen on port {Port}", Port);
+        }
+    }
+    return nullptr != Listener;
+}
+
+int32 FRuleRangerCommandletServer::GetPort() const
+{
+    return Port;
+}
+
+void FRuleRangerCommandletServer::Run(const double IdleTimeoutSeconds)
+{
+    auto LastRequestTime = FPlatformTime::Seconds();
+    auto LastTickTime = LastRequestTime;
+    while (Listener && !IsEngineExitRequested())
+    {
+        const auto Result = ServeNextConnection(FTimespan::FromMilliseconds(100));
+        const auto Now = FPlatformTime::Seconds();
+        if (EServeResult::Shutdown == Result)
+        {
+            UE_LOGFMT(LogRuleRanger, Display, "RuleRanger server received a shutdown request");
+            break;
+        }
+        else if (EServeResult::Served == Result)
+        {
+            LastRequestTime = Now;
+        }
+        else if (IdleTimeoutSeconds > 0 && Now - LastRequestTime > IdleTimeoutSeconds)
+        {
+            UE_LOGFMT(LogRuleRanger, Display, "RuleRanger server stopping after being idle");
+            break;
+        }
+
+        // Keep the engine responsive to deferred work (i.e. asset registry updates) while idle
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FTSTicker::GetCoreTicker().Tick(static_cast<float>(Now - LastTickTime));
+        LastTickTime = Now;
+    }
+}
+
+FRuleRangerCommandletServer::EServeResult FRuleRangerCommandletServer::ServeNextConnection(const FTimespan& WaitTime)
+{
+    bool bPending{ false };
+    if (!Listener || !Listener->WaitForPendingConnection(bPending, WaitTime) || !bPending)
+    {
+        return EServeResult::Idle;
+    }
+    else
+    {
+        // ReSharper disable once CppTooWideScopeInitStatement
+        const auto Connection = Listener->Accept(TEXT("RuleRangerCommandletServerConnection"));
+        if (!Connection)
+        {
+            return EServeResult::Idle;
+        }
+        else
+        {
+            auto Result{ EServeResult::Served };
+            FString Request;
+            if (!ReadLine(Connection, Request))
+            {
+                UE_LOGFMT(LogRuleRanger, Warning, "RuleRanger server was unable to read the request");
+            }
+            else if (ShutdownRequest == Request.TrimStartAndEnd())
+            {
+                WriteLine(Connection, TEXT("{\"Shutdown\":true}"));
+                Result = EServeResult::Shutdown;
+            }
+            else
+            {
+                UE_LOGFMT(LogRuleRanger, Display, "RuleRanger server processing request: {Request}", Request);
+                const auto StartTime = FPlatformTime::Seconds();
+                const auto Response = Handler(Request);
+                if (!WriteLine(Connection, Response))
+                {
+                    UE_LOGFMT(LogRuleRanger, Warning, "RuleRanger server was unable to send the response");
+                }
+                UE_LOGFMT(LogRuleRanger,
+                          Display,
+                          "RuleRanger server processed request in {Seconds} seconds",
+                          FString::Printf(TEXT("%.2f"), FPlatformTime::Seconds() - StartTime));
+            }
+            Connection->Close();
+            ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Connection);
+            return Result;
+        }
+    }
+}
+
+bool FRuleRangerCommandletServer::ReadLine(FSocket* Socket, FString& OutLine)
+{
+    TArray<uint8> Bytes;
+    uint8 Buffer[4096];
+    bool bComplete{ false };
+    while (!bComplete)
+    {
+        if (!Socket->Wait(ESocketWaitConditions::WaitForRead, TransferTimeout))
+        {
+            return false;
+        }
+        else
+        {
+            int32 BytesRead{ 0 };
+            if (!Socket->Recv(Buffer, sizeof(Buffer), BytesRead) || 0 == BytesRead)
+            {
+                // The connection was closed by the client
+                bComplete = true;
+            }
+            else
+            {
+                // Only the newly received bytes are searched as earlier chunks held no newline
+                const auto SearchStart = Bytes.Num();
+                Bytes.Append(Buffer, BytesRead);
+                for (auto Index = SearchStart; Index < Bytes.Num(); ++Index)
+                {
+                    if ('\n' == Bytes[Index])
+                    {
+                        Bytes.SetNum(Index);
+                        bComplete = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (Bytes.Num() > MaxRequestBytes)
+        {
+            // A truncated request could be misread as different parameters so it is rejected outright
+            UE_LOGFMT(LogRuleRanger,
+                      Warning,
+                      "RuleRanger server rejected a request larger than {MaxBytes} bytes",
+                      MaxRequestBytes);
+            return false;
+        }
+    }
+
+    if (Bytes.IsEmpty())
+    {
+        return false;
+    }
+    else
+    {
+        const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+        OutLine = FString(Converted.Length(), Converted.Get()).TrimEnd();
+        return true;
+    }
+}
+
+bool FRuleRangerCommandletServer::WriteLine(FSocket* Socket, const FString& Line)
+{
+    const FTCHARToUTF8 Converted(*(Line + TEXT("\n")));
+    const auto Data = reinterpret_cast<const uint8*>(Converted.Get());
+    auto Offset{ 0 };
+    while (Offset < Converted.Length())
+    {
+        int32 BytesSent{ 0 };
+        if (!Socket->Wait(ESocketWaitConditions::WaitForWrite, TransferTimeout)
+            || !Socket->Send(Data + Offset, Converted.Length() - Offset, BytesSent))
+        {
+            return false;
+        }
+        else
+        {
+            Offset += BytesSent;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,88 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FSocket;
+
+/**
+ * Serves scan requests for a RuleRanger commandlet that stays running between requests.
+ *
+ * The server listens on a loopback port. Each connection carries a single request, a line containing the
+ * commandlet parameters, and receives a single line containing the JSON report. Keeping the commandlet running
+ * avoids paying for engine startup and the asset registry scan on every request. A request of "-shutdown" stops
+ * the server.
+ */
+class FRuleRangerCommandletServer
+{
+public:
+    /** Handles the commandlet parameters of a request and returns the JSON response. */
+    using FRequestHandler = TFunction<FString(const FString& Params)>;
+
+    enum class EServeResult : uint8
+    {
+        /** No connection arrived within the wait time. */
+        Idle,
+        /** A request was served. */
+        Served,
+        /** A shutdown request was received. */
+        Shutdown
+    };
+
+    FRuleRangerCommandletServer(int32 InPort, FRequestHandler InHandler);
+    ~FRuleRangerCommandletServer();
+
+    UE_NONCOPYABLE(FRuleRangerCommandletServer);
+
+    /**
+     * Start listening for connections.
+     *
+     * @return true if the server is listening.
+     */
+    bool Start();
+
+    /** Return the port the server is listening on. */
+    int32 GetPort() const;
+
+    /**
+     * Serve requests until a shutdown request is received, the server has been idle for the specified time or
+     * the engine is asked to exit. The core ticker and the game thread tasks are processed between requests.
+     *
+     * @param IdleTimeoutSeconds the time without a request after which the server stops. Zero disables the timeout.
+     */
+    void Run(double IdleTimeoutSeconds);
+
+    /**
+     * Wait for a connection and serve the request it carries.
+     *
+     * @param WaitTime the maximum time to wait for a connection.
+     * @return the outcome.
+     */
+    EServeResult ServeNextConnection(const FTimespan& WaitTime);
+
+private:
+    /**
+     * The maximum size of a request. Requests are commandlet parameters so this is generous.
+     * Larger requests are rejected rather than truncated.
+     */
+    static constexpr int32 MaxRequestBytes{ 1024 * 1024 };
+
+    int32 Port{ 0 };
+    FRequestHandler Handler;
+    FSocket* Listener{ nullptr };
+
+    static bool ReadLine(FSocket* Socket, FString& OutLine);
+    static bool WriteLine(FSocket* Socket, const FString& Line);
+};
@@ -0,0 +1,336 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "RuleRangerScanCheckpoint.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Logging/StructuredLog.h"
+#include "Misc/FileHelper.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "RuleRangerLogging.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    constexpr int32 CheckpointVersion{ 2 };
+
+    void ReadCounters(const FJsonObject& Object, FRuleRangerScanCounters& OutCounters)
+    {
+        Object.TryGetNumberField(TEXT("Errors"), OutCounters.Errors);
+        Object.TryGetNumberField(TEXT("Warnings"), OutCounters.Warnings);
+        Object.TryGetNumberField(TEXT("Fatals"), OutCounters.Fatals);
+        Object.TryGetNumberField(TEXT("AssetsScanned"), OutCounters.AssetsScanned);
+        Object.TryGetNumberField(TEXT("PackagesSaved"), OutCounters.PackagesSaved);
+        Object.TryGetNumberField(TEXT("PackagesFailedToSave"), OutCounters.PackagesFailedToSave);
+    }
+
+    TSharedRef<FJsonObject> WriteCounters(const FRuleRangerScanCounters& Counters)
+    {
+        const auto Object = MakeShared<FJsonObject>();
+        Object->SetNumberField(TEXT("Errors"), Counters.Errors);
+        Object->SetNumberField(TEXT("Warnings"), Counters.Warnings);
+        Object->SetNumberField(TEXT("Fatals"), Counters.Fatals);
+        Object->SetNumberField(TEXT("AssetsScanned"), Counters.AssetsScanned);
+        Object->SetNumberField(TEXT("PackagesSaved"), Counters.PackagesSaved);
+        Object->SetNumberField(TEXT("PackagesFailedToSave"), Counters.PackagesFailedToSave);
+        return Object;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ToJson(const TArray<FName>& PackageNames)
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        for (const auto& PackageName : PackageNames)
+        {
+            Values.Add(MakeShared<FJsonValueString>(PackageName.ToString()));
+        }
+        return Values;
+    }
+
+    bool AppendLines(const FString& Lines, const FString& FilePath)
+    {
+        return FFileHelper::SaveStringToFile(Lines,
+                                             *FilePath,
+                                             FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+                                             &IFileManager::Get(),
+                                             FILEWRITE_Append);
+    }
+
+    int64 GetFileSize(const FString& FilePath)
+    {
+        return FMath::Max<int64>(0, IFileManager::Get().FileSize(*FilePath));
+    }
+
+    // Read the lines of a file that the scan appends to, discarding anything appended after the last save
+    bool LoadAppendedLines(const FString& FilePath, const int64 Size, TArray<FString>& OutLines)
+    {
+        TArray<uint8> Bytes;
+        if (Size > 0)
+        {
+            if (!FFileHelper::LoadFileToArray(Bytes, *FilePath) || Bytes.Num() < Size)
+            {
+                UE_LOGFMT(LogRuleRanger, Error, "Unable to read the scan checkpoint data {Path}", FilePath);
+                return false;
+            }
+            else if (Bytes.Num() > Size)
+            {
+                // Discard the lines appended after the last checkpoint as those packages are scanned again
+                Bytes.SetNum(Size);
+                FFileHelper::SaveArrayToFile(Bytes, *FilePath);
+            }
+        }
+        else
+        {
+            IFileManager::Get().Delete(*FilePath, false, false, true);
+        }
+
+        const FUTF8ToTCHAR Text(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+        FString(Text.Length(), Text.Get()).ParseIntoArrayLines(OutLines);
+        return true;
+    }
+} // namespace
+
+FRuleRangerScanCheckpoint::FRuleRangerScanCheckpoint(const FString& InPath)
+    : Path(InPath), ResultsPath(InPath + TEXT(".results")), CompletedPath(InPath + TEXT(".completed")),
+      MarkerPath(InPath + TEXT(".current"))
+{
+}
+
+bool FRuleRangerScanCheckpoint::Load(const bool bResume,
+                                     FRuleRangerScanCounters& OutCounters,
+                                     TArray<TSharedPtr<FJsonValue>>& OutResults)
+{
+    auto& FileManager = IFileManager::Get();
+    if (FileManager.FileExists(*Path))
+    {
+        FString Content;
+        TSharedPtr<FJsonObject> Root;
+        if (!FFileHelper::LoadFileToString(Content, *Path)
+            || !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Content), Root) || !Root.IsValid())
+        {
+            UE_LOGFMT(LogRuleRanger, Error, "Unable to read the scan checkpoint {Path}", Path);
+            return false;
+        }
+
+        const TArray<TSharedPtr<FJsonValue>>* Quarantined{ nullptr };
+        if (Root->TryGetArrayField(TEXT("QuarantinedPackages"), Quarantined))
+        {
+            for (const auto& Value : *Quarantined)
+            {
+                QuarantinedPackages.AddUnique(FName(Value->AsString()));
+            }
+        }
+
+        if (bResume)
+        {
+            const TSharedPtr<FJsonObject>* Counters{ nullptr };
+            if (Root->TryGetObjectField(TEXT("Counters"), Counters))
+            {
+                ReadCounters(**Counters, SavedCounters);
+            }
+            Root->TryGetNumberField(TEXT("ResultsSize"), ResultsSize);
+            Root->TryGetNumberField(TEXT("CompletedSize"), CompletedSize);
+            if (!LoadResults(OutResults) || !LoadCompletedPackages())
+            {
+                return false;
+            }
+            OutCounters = SavedCounters;
+            UE_LOGFMT(LogRuleRanger,
+                      Display,
+                      "RuleRanger resuming scan from checkpoint {Path} with {Count} package(s) completed",
+                      Path,
+                      CompletedPackages.Num());
+        }
+    }
+    if (!bResume)
+    {
+        FileManager.Delete(*ResultsPath, false, false, true);
+        FileManager.Delete(*CompletedPath, false, false, true);
+    }
+
+    FString CurrentPackage;
+    const auto bHasMarker = FFileHelper::LoadFileToString(CurrentPackage, *MarkerPath);
+    CurrentPackage.TrimStartAndEndInline();
+    if (!CurrentPackage.IsEmpty())
+    {
+        UE_LOGFMT(LogRuleRanger,
+                  Error,
+                  "RuleRanger quarantined package {Package} as the previous scan stopped while processing it",
+                  CurrentPackage);
+        QuarantinedPackages.AddUnique(FName(CurrentPackage));
+    }
+
+    // The checkpoint is rewritten before the marker is removed so that a quarantined package is never forgotten
+    // and so that the progress of a previous scan can not be resumed once a new scan starts
+    if ((bHasMarker || !bResume) && !WriteCheckpoint())
+    {
+        return false;
+    }
+    else
+    {
+        FileManager.Delete(*MarkerPath, false, false, true);
+        return true;
+    }
+}
+
+bool FRuleRangerScanCheckpoint::Save(const FRuleRangerScanCounters& Counters,
+                                     const TConstArrayView<TSharedPtr<FJsonValue>> NewResults)
+{
+    if (!NewResults.IsEmpty())
+    {
+        FString Lines;
+        for (const auto& Result : NewResults)
+        {
+            if (Result.IsValid() && Result->AsObject().IsValid())
+            {
+                const auto Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Lines);
+                FJsonSerializer::Serialize(Result->AsObject().ToSharedRef(), Writer);
+                Lines.AppendChar(TEXT('\n'));
+            }
+        }
+        if (!AppendLines(Lines, ResultsPath))
+        {
+            UE_LOGFMT(LogRuleRanger, Error, "Unable to write the scan results to {Path}", ResultsPath);
+            return false;
+        }
+    }
+    if (!UnsavedPackages.IsEmpty())
+    {
+        FString Lines;
+        for (const auto& PackageName : UnsavedPackages)
+        {
+            Lines.Append(PackageName.ToString());
+            Lines.AppendChar(TEXT('\n'));
+        }
+        if (!AppendLines(Lines, CompletedPath))
+        {
+            UE_LOGFMT(LogRuleRanger, Error, "Unable to write the completed packages to {Path}", CompletedPath);
+            return false;
+        }
+    }
+
+    // Anything appended after these sizes is discarded when resuming as the packages are not yet completed
+    ResultsSize = GetFileSize(ResultsPath);
+    CompletedSize = GetFileSize(CompletedPath);
+    SavedCounters = Counters;
+    UnsavedPackages.Reset();
+    return WriteCheckpoint();
+}
+
+void FRuleRangerScanCheckpoint::Complete()
+{
+    auto& FileManager = IFileManager::Get();
+    CompletedPackages.Reset();
+    UnsavedPackages.Reset();
+    SavedCounters = FRuleRangerScanCounters();
+    ResultsSize = 0;
+    CompletedSize = 0;
+    FileManager.Delete(*ResultsPath, false, false, true);
+    FileManager.Delete(*CompletedPath, false, false, true);
+    FileManager.Delete(*MarkerPath, false, false, true);
+    if (QuarantinedPackages.IsEmpty())
+    {
+        FileManager.Delete(*Path, false, false, true);
+    }
+    else
+    {
+        WriteCheckpoint();
+    }
+}
+
+void FRuleRangerScanCheckpoint::BeginPackage(const FName PackageName)
+{
+    FFileHelper::SaveStringToFile(PackageName.ToString(), *MarkerPath);
+}
+
+void FRuleRangerScanCheckpoint::EndPackage(const FName PackageName)
+{
+    IFileManager::Get().Delete(*MarkerPath, false, false, true);
+    MarkCompleted(PackageName);
+}
+
+void FRuleRangerScanCheckpoint::MarkCompleted(const FName PackageName)
+{
+    bool bAlreadyCompleted{ false };
+    CompletedPackages.Add(PackageName, &bAlreadyCompleted);
+    if (!bAlreadyCompleted)
+    {
+        UnsavedPackages.Add(PackageName);
+    }
+}
+
+bool FRuleRangerScanCheckpoint::LoadResults(TArray<TSharedPtr<FJsonValue>>& OutResults) const
+{
+    TArray<FString> Lines;
+    if (!LoadAppendedLines(ResultsPath, ResultsSize, Lines))
+    {
+        return false;
+    }
+    else
+    {
+        for (const auto& Line : Lines)
+        {
+            TSharedPtr<FJsonObject> Result;
+            if (FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Line), Result) && Result.IsValid())
+            {
+                OutResults.Add(MakeShared<FJsonValueObject>(Result));
+            }
+        }
+        return true;
+    }
+}
+
+bool FRuleRangerScanCheckpoint::LoadCompletedPackages()
+{
+    TArray<FString> Lines;
+    if (!LoadAppendedLines(CompletedPath, CompletedSize, Lines))
+    {
+        return false;
+    }
+    else
+    {
+        CompletedPackages.Reserve(Lines.Num());
+        for (const auto& Line : Lines)
+        {
+            CompletedPackages.Add(FName(Line));
+        }
+        return true;
+    }
+}
+
+bool FRuleRangerScanCheckpoint::WriteCheckpoint() const
+{
+    const auto Root = MakeShared<FJsonObject>();
+    Root->SetNumberField(TEXT("Version"), CheckpointVersion);
+    Root->SetObjectField(TEXT("Counters"), WriteCounters(SavedCounters));
+    Root->SetNumberField(TEXT("ResultsSize"), ResultsSize);
+    Root->SetNumberField(TEXT("CompletedSize"), CompletedSize);
+    Root->SetArrayField(TEXT("QuarantinedPackages"), ToJson(QuarantinedPackages));
+
+    FString Content;
+    const auto Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Content);
+    FJsonSerializer::Serialize(Root, Writer);
+
+    // Write to a temporary file and then replace the checkpoint so that a crash never leaves a partial checkpoint
+    const auto TempPath = Path + TEXT(".tmp");
+    if (FFileHelper::SaveStringToFile(Content, *TempPath) && IFileManager::Get().Move(*Path, *TempPath, true))
+    {
+        return true;
+    }
+    else
+    {
+        UE_LOGFMT(LogRuleRanger, Error, "Unable to write the scan checkpoint {Path}", Path);
+        return false;
+    }
+}
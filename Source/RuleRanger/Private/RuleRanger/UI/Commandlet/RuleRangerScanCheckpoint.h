@@ -0,0 +1,110 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonValue;
+
+/**
+ * The counters accumulated by a commandlet scan that are restored when the scan is resumed.
+ */
+struct FRuleRangerScanCounters
+{
+    int32 Errors{ 0 };
+    int32 Warnings{ 0 };
+    int32 Fatals{ 0 };
+    int32 AssetsScanned{ 0 };
+    int32 PackagesSaved{ 0 };
+    int32 PackagesFailedToSave{ 0 };
+};
+
+/**
+ * The persisted progress of a commandlet scan so that a scan that dies part way through can be resumed.
+ *
+ * The checkpoint is a JSON file that records the counters accumulated and the lengths of the results and
+ * completed packages files as of the last save. Results (one JSON object per line) and the names of completed
+ * packages (one per line) are appended to their files so that saving a checkpoint does not rewrite the progress
+ * made earlier in the scan. Anything appended after the last save is discarded when the scan is resumed as the
+ * packages involved are scanned again.
+ *
+ * The package being processed is recorded in a marker file before it is loaded and the marker is removed
+ * once the package completes. If the marker exists when the checkpoint is loaded then the process died while
+ * processing the package (typically an engine assert triggered by a bad asset) and the package is
+ * quarantined. Quarantined packages are skipped and reported by every later scan using the checkpoint,
+ * including scans that are not resumed, so that a single bad asset does not prevent a scan from completing.
+ */
+class FRuleRangerScanCheckpoint
+{
+public:
+    explicit FRuleRangerScanCheckpoint(const FString& InPath);
+
+    UE_NONCOPYABLE(FRuleRangerScanCheckpoint);
+
+    /**
+     * Load the checkpoint, quarantining the package that was being processed if the previous scan died.
+     *
+     * @param bResume true to restore the progress of the previous scan, false to start a new scan.
+     * @param OutCounters the counters of the previous scan. Unchanged unless resuming.
+     * @param OutResults the array to add the results of the previous scan to. Unchanged unless resuming.
+     * @return false if the checkpoint exists but could not be read.
+     */
+    bool Load(bool bResume, FRuleRangerScanCounters& OutCounters, TArray<TSharedPtr<FJsonValue>>& OutResults);
+
+    /**
+     * Persist the progress of the scan.
+     *
+     * @param Counters the counters accumulated so far.
+     * @param NewResults the results produced since the last save.
+     * @return true if the checkpoint was written.
+     */
+    bool Save(const FRuleRangerScanCounters& Counters, TConstArrayView<TSharedPtr<FJsonValue>> NewResults);
+
+    /** Discard the progress of the completed scan, retaining the quarantined packages. */
+    void Complete();
+
+    /** Record the package that is about to be processed. */
+    void BeginPackage(FName PackageName);
+
+    /** Record that the package has been processed. */
+    void EndPackage(FName PackageName);
+
+    /** Record that the package needs no further processing. i.e. it was skipped as it is quarantined. */
+    void MarkCompleted(FName PackageName);
+
+    FORCEINLINE bool IsCompleted(const FName PackageName) const { return CompletedPackages.Contains(PackageName); }
+    FORCEINLINE bool IsQuarantined(const FName PackageName) const { return QuarantinedPackages.Contains(PackageName); }
+    FORCEINLINE const TArray<FName>& GetQuarantinedPackages() const { return QuarantinedPackages; }
+
+    /** Return the number of packages completed since the last save. */
+    FORCEINLINE int32 GetUnsavedCount() const { return UnsavedPackages.Num(); }
+
+private:
+    FString Path;
+    FString ResultsPath;
+    FString CompletedPath;
+    FString MarkerPath;
+
+    TSet<FName> CompletedPackages;
+    /** The packages completed since the last save, in the order they were completed. */
+    TArray<FName> UnsavedPackages;
+    TArray<FName> QuarantinedPackages;
+    FRuleRangerScanCounters SavedCounters;
+    int64 ResultsSize{ 0 };
+    int64 CompletedSize{ 0 };
+
+    bool LoadResults(TArray<TSharedPtr<FJsonValue>>& OutResults) const;
+    bool LoadCompletedPackages();
+    bool WriteCheckpoint() const;
+};
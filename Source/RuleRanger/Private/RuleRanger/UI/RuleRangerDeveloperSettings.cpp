@@ -22,6 +22,7 @@ void URuleRangerDeveloperSettings::PostEditChangeProperty(FPropertyChangedEvent&
         if (const auto Subsystem = GEditor->GetEditorSubsystem<URuleRangerEditorSubsystem>())
         {
             Subsystem->MarkRuleSetConfigCacheDirty();
+            Subsystem->UpdateWatchForChanges();
         }
     }
 }
@@ -40,5 +40,49 @@ public:
     UPROPERTY(Config, EditAnywhere, Category = "Rule Ranger", meta = (DisplayThumbnail = "false"))
     TArray<TSoftObjectPtr<URuleRangerConfig>> Configs;
 
+    /** Should content scans started from the Tool tab run in the background rather than blocking the editor? */
+    UPROPERTY(Config, EditAnywhere, Category = "Rule Ranger|Tool Tab")
+    bool bScanContentInBackground{ true };
+
+    /** The time in milliseconds that a background scan may spend scanning assets each editor tick. */
+    UPROPERTY(Config,
+              EditAnywhere,
+              Category = "Rule Ranger|Tool Tab",
+              meta = (ClampMin = "1", UIMin = "1", UIMax = "50", EditCondition = "bScanContentInBackground"))
+    float BackgroundScanBudgetMs{ 8.f };
+
+    /**
+     * Should the Tool tab keep a live run that is updated as assets are added, modified, renamed or saved?
+     * Only the changed assets are scanned, in the background, so results stay current without a full scan.
+     */
+    UPROPERTY(Config, EditAnywhere, Category = "Rule Ranger|Tool Tab")
+    bool bWatchForChanges{ false };
+
+    /** The time in seconds that changes must settle for before the changed assets are scanned. */
+    UPROPERTY(Config,
+              EditAnywhere,
+              Category = "Rule Ranger|Tool Tab",
+              meta = (ClampMin = "0", UIMin = "0", UIMax = "10", EditCondition = "bWatchForChanges"))
+    float WatchDebounceSeconds{ 1.f };
+
+    /**
+     * Should the cost and selectivity of matchers be measured during scans and used to evaluate the matchers that
+     * are cheap and most likely to decide whether a rule applies first? Measurements are kept between sessions and
+     * a rule or logical matcher can pin the authored order.
+     */
+    UPROPERTY(Config, EditAnywhere, Category = "Rule Ranger|Matchers")
+    bool bReorderMatchersByCost{ true };
+
+    /** Should the redirectors left behind by renames applied during a fix be fixed up once the fix completes? */
+    UPROPERTY(Config, EditAnywhere, Category = "Rule Ranger|Renames")
+    bool bFixupRedirectorsAfterRenames{ false };
+
+    /**
+     * The estimated size in megabytes of the packages renamed together when a fix completes.
+     * Larger values load fewer referencers overall while smaller values bound the memory used by each chunk.
+     */
+    UPROPERTY(Config, EditAnywhere, Category = "Rule Ranger|Renames", meta = (ClampMin = "1", UIMin = "1"))
+    int32 RenameChunkBudgetMb{ 512 };
+
     virtual void PostEditChangeProperty(FPropertyChangedEvent& Event) override;
 };
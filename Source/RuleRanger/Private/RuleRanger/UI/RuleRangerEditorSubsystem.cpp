@@ -14,11 +14,15 @@
 #include "RuleRanger/UI/RuleRangerEditorSubsystem.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Editor.h"
+#include "Engine/Blueprint.h"
 #include "Logging/StructuredLog.h"
 #include "Misc/ScopedSlowTask.h"
 #include "RuleRanger/ProjectRuleTraversal.h"
+#include "RuleRanger/RuleRangerExplainTrace.h"
+#include "RuleRanger/RuleRangerRenameBatch.h"
 #include "RuleRanger/RuleRangerUtilities.h"
 #include "RuleRanger/UI/RuleRangerTools.h"
+#include "RuleRangerAction.h"
 #include "RuleRangerActionContext.h"
 #include "RuleRangerConfig.h"
 #include "RuleRangerDefaultProjectResultHandler.h"
@@ -33,8 +37,8 @@
 #include "RuleRangerRule.h"
 #include "RuleRangerRuleExclusion.h"
 #include "RuleRangerRuleSet.h"
-#include "Subsystems/EditorAssetSubsystem.h"
 #include "Subsystems/ImportSubsystem.h"
+#include "UObject/ObjectSaveContext.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(RuleRangerEditorSubsystem)
 #include UE_INLINE_GENERATED_CPP_BY_NAME(RuleRangerTextureConvention)
@@ -43,6 +47,28 @@
 
 const static FString ImportMarkerValue = FString(TEXT("True"));
 
+namespace
+{
+    void NoteExclusion(const FRuleRangerRuleExclusion& Exclusion)
+    {
+        if (FRuleRangerExplainTrace::IsActive())
+        {
+            TArray<FString> Excluded;
+            for (const auto RuleSet : Exclusion.RuleSets)
+            {
+                Excluded.Add(GetPathNameSafe(RuleSet));
+            }
+            for (const auto Rule : Exclusion.Rules)
+            {
+                Excluded.Add(GetPathNameSafe(Rule));
+            }
+            FRuleRangerExplainTrace::Note(TEXT("Exclusion"),
+                                          Exclusion.Description.ToString(),
+                                          TEXT("Excludes ") + FString::Join(Excluded, TEXT(", ")));
+        }
+    }
+} // namespace
+
 void URuleRangerEditorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     // Register delegate for OnAssetPostImport callback
@@ -54,6 +80,7 @@ void URuleRangerEditorSubsystem::Initialize(FSubsystemCollectionBase& Collection
         NewObject<URuleRangerDefaultResultHandler>(this, URuleRangerDefaultResultHandler::StaticClass());
     DefaultProjectResultHandler =
         NewObject<URuleRangerDefaultProjectResultHandler>(this, URuleRangerDefaultProjectResultHandler::StaticClass());
+    UpdateWatchForChanges();
 }
 
 void URuleRangerEditorSubsystem::Deinitialize()
@@ -67,6 +94,13 @@ void URuleRangerEditorSubsystem::Deinitialize()
         }
     }
     OnAssetPostImportDelegateHandle.Reset();
+    if (PendingImportsTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(PendingImportsTickerHandle);
+        PendingImportsTickerHandle.Reset();
+    }
+    PendingImports.Reset();
+    StopWatchingForChanges();
 }
 
 void URuleRangerEditorSubsystem::ScanObject(UObject* InObject, IRuleRangerResultHandler* InResultHandler)
@@ -85,53 +119,76 @@ void URuleRangerEditorSubsystem::ScanAndFixObject(UObject* InObject, IRuleRanger
     });
 }
 
+void URuleRangerEditorSubsystem::ExplainObject(UObject* InObject,
+                                               const bool bFix,
+                                               FRuleRangerExplainTrace& Trace,
+                                               IRuleRangerResultHandler* InResultHandler)
+{
+    const FRuleRangerExplainTrace::FScope TraceScope(Trace);
+    const FRuleRangerExplainTrace::FNodeScope ObjectNode(TEXT("Object"), InObject);
+    if (bFix)
+    {
+        ScanAndFixObject(InObject, InResultHandler);
+    }
+    else
+    {
+        ScanObject(InObject, InResultHandler);
+    }
+}
+
 void URuleRangerEditorSubsystem::ValidateObject(UObject* InObject,
                                                 bool bIsSave,
                                                 IRuleRangerResultHandler* InResultHandler)
 {
     const auto Handler = InResultHandler ? InResultHandler : DefaultResultHandler.GetInterface();
-    ProcessRule(InObject, [this, bIsSave, Handler](auto Config, auto RuleSet, auto Rule, auto InnerInObject) mutable {
-        return ProcessOnAssetValidateRule(Config, RuleSet, Rule, InnerInObject, bIsSave, Handler);
-    });
-    // Ensure any per-object validation caches are cleared even if validator is not in play
-    ClearValidationMatchCache();
+    if (HasValidationPlan(InObject, bIsSave))
+    {
+        ReplayValidationPlan(InObject, bIsSave, Handler);
+    }
+    else
+    {
+        ProcessRule(InObject,
+                    [this, bIsSave, Handler](auto Config, auto RuleSet, auto Rule, auto InnerInObject) mutable {
+                        return ProcessOnAssetValidateRule(Config, RuleSet, Rule, InnerInObject, bIsSave, Handler);
+                    });
+    }
+    // Ensure the plan is discarded even if the validator is not in play
+    ClearValidationPlan();
 }
 
 bool URuleRangerEditorSubsystem::CanValidateObject(UObject* InObject, bool bIsSave)
 {
-    bool Result = false;
-    // Begin caching matches for this object across CanValidate and Validate
-    ResetValidationMatchCache(InObject);
-    ProcessRule(InObject, [this, &Result, bIsSave](auto, auto, auto Rule, auto InnerObject) {
+    ClearValidationPlan();
+
+    // A rule may be referenced by multiple rule sets so the match is only evaluated once per rule. Few rules apply
+    // to an object so the results are kept in a flat array rather than a map.
+    TArray<TPair<const URuleRangerRule*, bool>, TInlineAllocator<16>> Matches;
+    ProcessRule(InObject, [this, &Matches, bIsSave](auto Config, auto RuleSet, auto Rule, auto InnerObject) {
         if (CanValidateObject(Rule, InnerObject, bIsSave))
         {
-            bool bMatches;
-            if (ValidationMatchCacheObject == InnerObject)
-            {
-                const TWeakObjectPtr Key(Rule);
-                if (const auto Cached = ValidationMatchCache.Find(Key))
-                {
-                    bMatches = *Cached;
-                }
-                else
-                {
-                    bMatches = Rule->Match(ActionContext, InnerObject);
-                    ValidationMatchCache.Add(Key, bMatches);
-                }
-            }
-            else
-            {
-                bMatches = Rule->Match(ActionContext, InnerObject);
-            }
-
+            const auto Cached = Matches.FindByPredicate([Rule](const auto& Match) { return Match.Key == Rule; });
+            // ReSharper disable once CppTooWideScopeInitStatement
+            const bool bMatches = Cached
+                ? Cached->Value
+                : Matches.Emplace_GetRef(Rule, Rule->Match(ActionContext, InnerObject)).Value;
             if (bMatches)
             {
-                Result = true;
+                ValidationPlan.Add({ Config, RuleSet, Rule });
             }
         }
         return true;
     });
-    return Result;
+
+    if (ValidationPlan.IsEmpty())
+    {
+        return false;
+    }
+    else
+    {
+        ValidationPlanObject = InObject;
+        bValidationPlanIsSave = bIsSave;
+        return true;
+    }
 }
 
 // ReSharper disable once CppMemberFunctionMayBeStatic
@@ -198,6 +255,8 @@ void URuleRangerEditorSubsystem::MarkRuleSetConfigCacheDirty()
     {
         CachedRuleSetConfigs.Reset();
         bRuleSetConfigCacheDirty = true;
+        // The rules captured for a pending validation may no longer be applicable
+        ClearValidationPlan();
         UE_LOGFMT(LogRuleRanger, Verbose, "Clearing the RuleSetConfig cache");
     }
 }
@@ -215,26 +274,268 @@ void URuleRangerEditorSubsystem::OnAssetPostImport([[maybe_unused]] UFactory* Fa
         MarkRuleSetConfigCacheDirty();
     }
 
-    const auto Subsystem = GEditor->GetEditorSubsystem<UEditorAssetSubsystem>();
+    // Importing a single file or dropping many files onto the content browser produces a callback per
+    // asset, so the rules are applied once the importer has returned control to the editor. Commandlets
+    // may never tick the core ticker so imported objects are processed immediately.
+    PendingImports.Add(Object);
+    if (IsRunningCommandlet())
+    {
+        ProcessPendingImports();
+    }
+    else if (!PendingImportsTickerHandle.IsValid())
+    {
+        PendingImportsTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this, &URuleRangerEditorSubsystem::OnPendingImportsTick));
+    }
+}
+
+bool URuleRangerEditorSubsystem::OnPendingImportsTick([[maybe_unused]] float DeltaTime)
+{
+    PendingImportsTickerHandle.Reset();
+    ProcessPendingImports();
+    return false;
+}
+
+void URuleRangerEditorSubsystem::UpdateWatchForChanges()
+{
+    // ReSharper disable once CppTooWideScopeInitStatement
+    const bool bWatch = GetDefault<URuleRangerDeveloperSettings>()->bWatchForChanges && !IsRunningCommandlet();
+    if (bWatch && !bWatchingForChanges)
+    {
+        auto& AssetRegistry =
+            FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+        OnAssetAddedDelegateHandle = AssetRegistry.OnAssetAdded().AddUObject(this, &ThisClass::OnWatchedAssetChanged);
+        OnAssetUpdatedDelegateHandle =
+            AssetRegistry.OnAssetUpdated().AddUObject(this, &ThisClass::OnWatchedAssetChanged);
+        OnAssetRenamedDelegateHandle =
+            AssetRegistry.OnAssetRenamed().AddUObject(this, &ThisClass::OnWatchedAssetRenamed);
+        OnPackageSavedDelegateHandle =
+            UPackage::PackageSavedWithContextEvent.AddUObject(this, &ThisClass::OnWatchedPackageSaved);
+        OnObjectModifiedDelegateHandle =
+            FCoreUObjectDelegates::OnObjectModified.AddUObject(this, &ThisClass::OnWatchedObjectModified);
+        bWatchingForChanges = true;
+    }
+    else if (!bWatch && bWatchingForChanges)
+    {
+        StopWatchingForChanges();
+    }
+
+    if (bWatchingForChanges)
+    {
+        // The settings may have changed the configs so the dependencies of the rules are indexed again
+        RuleImpact.Build(GetCachedRuleSetConfigs());
+    }
+}
+
+void URuleRangerEditorSubsystem::StopWatchingForChanges()
+{
+    if (bWatchingForChanges)
+    {
+        // The asset registry may already have been shut down when the editor exits
+        if (const auto Module = FModuleManager::GetModulePtr<FAssetRegistryModule>(AssetRegistryConstants::ModuleName))
+        {
+            auto& AssetRegistry = Module->Get();
+            AssetRegistry.OnAssetAdded().Remove(OnAssetAddedDelegateHandle);
+            AssetRegistry.OnAssetUpdated().Remove(OnAssetUpdatedDelegateHandle);
+            AssetRegistry.OnAssetRenamed().Remove(OnAssetRenamedDelegateHandle);
+        }
+        UPackage::PackageSavedWithContextEvent.Remove(OnPackageSavedDelegateHandle);
+        FCoreUObjectDelegates::OnObjectModified.Remove(OnObjectModifiedDelegateHandle);
+        bWatchingForChanges = false;
+    }
+    OnAssetAddedDelegateHandle.Reset();
+    OnAssetUpdatedDelegateHandle.Reset();
+    OnAssetRenamedDelegateHandle.Reset();
+    OnPackageSavedDelegateHandle.Reset();
+    OnObjectModifiedDelegateHandle.Reset();
+    RuleImpact.Reset();
+    PendingChangedDependencies.Reset();
+    if (PendingChangesTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(PendingChangesTickerHandle);
+        PendingChangesTickerHandle.Reset();
+    }
+    PendingChangedAssets.Reset();
+}
+
+void URuleRangerEditorSubsystem::OnWatchedAssetChanged(const FAssetData& AssetData)
+{
+    // ReSharper disable once CppTooWideScopeInitStatement
+    const auto& AssetRegistry =
+        FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+    // Assets discovered by the initial scan of the asset registry are not changes
+    if (AssetData.IsValid() && !AssetRegistry.IsLoadingAssets() && !AssetData.IsRedirector())
+    {
+        PendingChangedAssets.Add(AssetData.GetSoftObjectPath(), AssetData);
+        if (RuleImpact.IsDependency(AssetData.PackageName))
+        {
+            PendingChangedDependencies.Add(AssetData.PackageName);
+        }
+        QueueWatchedChange();
+    }
+}
+
+void URuleRangerEditorSubsystem::OnWatchedObjectModified(UObject* Object)
+{
+    // Edits to rules and DataTables are picked up before they are saved. Other edits are picked up when the
+    // asset registry reports the asset as updated.
+    // ReSharper disable once CppTooWideScopeInitStatement
+    const auto Package = IsValid(Object) ? Object->GetPackage() : nullptr;
+    if (Package && RuleImpact.IsDependency(Package->GetFName()))
+    {
+        PendingChangedDependencies.Add(Package->GetFName());
+        QueueWatchedChange();
+    }
+}
+
+void URuleRangerEditorSubsystem::QueueWatchedChange()
+{
+    LastAssetChangeTime = FPlatformTime::Seconds();
+    if (!PendingChangesTickerHandle.IsValid())
+    {
+        PendingChangesTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this, &URuleRangerEditorSubsystem::OnPendingChangesTick));
+    }
+}
+
+void URuleRangerEditorSubsystem::CollectAssetsImpactedByRuleChanges(TArray<FAssetData>& OutAssets)
+{
+    if (!PendingChangedDependencies.IsEmpty())
+    {
+        const auto ChangedPackages = MoveTemp(PendingChangedDependencies);
+        PendingChangedDependencies.Reset();
+
+        // The rules that depended upon the changed packages before the change may have been edited or removed,
+        // and the rules that depend upon them after the change may have been added, so both are considered
+        auto RuleCount = RuleImpact.CollectImpactedAssets(ChangedPackages, OutAssets);
+        MarkRuleSetConfigCacheDirty();
+        RuleImpact.Build(GetCachedRuleSetConfigs());
+        RuleCount += RuleImpact.CollectImpactedAssets(ChangedPackages, OutAssets);
+
+        UE_LOGFMT(LogRuleRanger,
+                  Verbose,
+                  "WatchForChanges: {PackageCount} changed package(s) impacted {RuleCount} rule(s) "
+                  "and {AssetCount} asset(s).",
+                  ChangedPackages.Num(),
+                  RuleCount,
+                  OutAssets.Num());
+    }
+}
+
+void URuleRangerEditorSubsystem::OnWatchedAssetRenamed(const FAssetData& AssetData,
+                                                       [[maybe_unused]] const FString& OldObjectPath)
+{
+    // Messages are associated with the asset object rather than the path so the old path needs no handling
+    OnWatchedAssetChanged(AssetData);
+}
+
+void URuleRangerEditorSubsystem::OnWatchedPackageSaved([[maybe_unused]] const FString& PackageFileName,
+                                                       UPackage* Package,
+                                                       // ReSharper disable once CppPassValueParameterByConstReference
+                                                       [[maybe_unused]] FObjectPostSaveContext Context)
+{
+    if (Package)
+    {
+        TArray<FAssetData> Assets;
+        FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName)
+            .Get()
+            .GetAssetsByPackageName(Package->GetFName(), Assets, true);
+        for (const auto& AssetData : Assets)
+        {
+            OnWatchedAssetChanged(AssetData);
+        }
+    }
+}
+
+bool URuleRangerEditorSubsystem::OnPendingChangesTick([[maybe_unused]] float DeltaTime)
+{
+    // Saving or editing an asset typically produces several events in quick succession, so the changed assets
+    // are only broadcast once the changes have settled
+    // ReSharper disable once CppTooWideScopeInitStatement
+    const auto DebounceSeconds = FMath::Max(0.f, GetDefault<URuleRangerDeveloperSettings>()->WatchDebounceSeconds);
+    if (FPlatformTime::Seconds() - LastAssetChangeTime < DebounceSeconds)
+    {
+        return true;
+    }
+    else
+    {
+        PendingChangesTickerHandle.Reset();
+        ProcessPendingChanges();
+        return false;
+    }
+}
+
+void URuleRangerEditorSubsystem::ProcessPendingChanges()
+{
+    TArray<FAssetData> ImpactedAssets;
+    CollectAssetsImpactedByRuleChanges(ImpactedAssets);
+    for (const auto& AssetData : ImpactedAssets)
+    {
+        PendingChangedAssets.Add(AssetData.GetSoftObjectPath(), AssetData);
+    }
+
+    TArray<FAssetData> Assets;
+    PendingChangedAssets.GenerateValueArray(Assets);
+    PendingChangedAssets.Reset();
+    if (!Assets.IsEmpty())
+    {
+        UE_LOGFMT(LogRuleRanger, Verbose, "WatchForChanges: Broadcasting {Count} changed asset(s).", Assets.Num());
+        OnWatchedAssetsChanged.Broadcast(Assets);
+    }
+}
+
+void URuleRangerEditorSubsystem::ProcessPendingImports()
+{
+    const auto Objects = MoveTemp(PendingImports);
+    PendingImports.Reset();
+
+    UE_LOGFMT(LogRuleRanger, Verbose, "OnAssetPostImport: Processing {Count} imported object(s).", Objects.Num());
 
     const static FName NAME_ImportMarkerKey = FName(TEXT("RuleRanger.ImportProcessed"));
-    // Use a metadata tag when we have imported an asset so that when we try to reimport asset, we can
-    // identify this through the presence of tag.
-    const bool bIsReimport = Subsystem && Subsystem->GetMetadataTag(Object, NAME_ImportMarkerKey) == ImportMarkerValue;
-
-    ProcessRule(Object, [this, bIsReimport](auto Config, auto RuleSet, auto Rule, auto InObject) {
-        return ProcessOnAssetPostImportRule(Config,
-                                            RuleSet,
-                                            Rule,
-                                            bIsReimport,
-                                            InObject,
-                                            DefaultResultHandler.GetInterface());
-    });
 
-    // Mark asset as having been processed by RuleRanger during import so we can detect reimports later
-    if (Subsystem && !bIsReimport)
+    // Renames requested for the imported objects are performed together once the imports have been processed
+    FRuleRangerRenameBatch RenameBatch;
+    TSet<const UObject*> Processed;
+    TSet<UPackage*> MarkedPackages;
+    for (const auto& ObjectPtr : Objects)
+    {
+        // An object may be reported multiple times within a batch but is only processed once
+        // ReSharper disable once CppTooWideScopeInitStatement
+        const auto Object = ObjectPtr.Get();
+        if (IsValid(Object) && !Processed.Contains(Object))
+        {
+            Processed.Add(Object);
+
+            // Use a metadata tag when we have imported an asset so that when we try to reimport asset, we can
+            // identify this through the presence of tag.
+            const auto& MetaData = Object->GetPackage()->GetMetaData();
+            const bool bIsReimport = MetaData.GetValue(Object, NAME_ImportMarkerKey) == ImportMarkerValue;
+
+            ProcessRule(Object, [this, bIsReimport](auto Config, auto RuleSet, auto Rule, auto InObject) {
+                return ProcessOnAssetPostImportRule(Config,
+                                                    RuleSet,
+                                                    Rule,
+                                                    bIsReimport,
+                                                    InObject,
+                                                    DefaultResultHandler.GetInterface());
+            });
+
+            // Mark asset as having been processed by RuleRanger during import so we can detect reimports later.
+            // The package is looked up again as a rule may have moved the asset. Renames are deferred to the
+            // batch and the marker is carried to the new package with the rest of the package metadata.
+            if (!bIsReimport && IsValid(Object))
+            {
+                const auto Package = Object->GetPackage();
+                Package->GetMetaData().SetValue(Object, NAME_ImportMarkerKey, *ImportMarkerValue);
+                MarkedPackages.Add(Package);
+            }
+        }
+    }
+
+    // Packages are only marked dirty once regardless of how many objects within the package were imported
+    for (const auto Package : MarkedPackages)
     {
-        Subsystem->SetMetadataTag(Object, NAME_ImportMarkerKey, ImportMarkerValue);
+        Package->MarkPackageDirty();
     }
 }
 
@@ -251,12 +552,14 @@ bool URuleRangerEditorSubsystem::ProcessRuleSetForObject(URuleRangerConfig* cons
               RuleSet->GetName(),
               Object->GetName());
 
+    const FRuleRangerExplainTrace::FNodeScope RuleSetNode(TEXT("RuleSet"), RuleSet);
     if (Visited.Contains(RuleSet))
     {
         UE_LOGFMT(LogRuleRanger,
                   Error,
                   "ProcessRule: Detected cyclic reference involving Rule Set {RuleSet}. Skipping nested traversal.",
                   RuleSet->GetName());
+        FRuleRangerExplainTrace::SetOutcome(TEXT("Skipped: already visited"));
         return true;
     }
     else
@@ -274,6 +577,10 @@ bool URuleRangerEditorSubsystem::ProcessRuleSetForObject(URuleRangerConfig* cons
                           RuleSet->GetName(),
                           Object->GetName(),
                           Exclusion.Description.ToString());
+                if (FRuleRangerExplainTrace::IsActive())
+                {
+                    FRuleRangerExplainTrace::SetOutcome(TEXT("Skipped: excluded. ") + Exclusion.Description.ToString());
+                }
                 return true;
             }
         }
@@ -313,6 +620,7 @@ bool URuleRangerEditorSubsystem::ProcessRuleSetForObject(URuleRangerConfig* cons
             // ReSharper disable once CppTooWideScopeInitStatement
             if (const auto Rule = RulePtr.Get(); IsValid(Rule))
             {
+                const FRuleRangerExplainTrace::FNodeScope RuleNode(TEXT("Rule"), Rule);
                 bool bSkipRule = false;
 
                 for (const auto& Exclusion : Exclusions)
@@ -327,6 +635,11 @@ bool URuleRangerEditorSubsystem::ProcessRuleSetForObject(URuleRangerConfig* cons
                                   RuleSet->GetName(),
                                   Object->GetName(),
                                   Exclusion.Description.ToString());
+                        if (FRuleRangerExplainTrace::IsActive())
+                        {
+                            FRuleRangerExplainTrace::SetOutcome(TEXT("Skipped: excluded. ")
+                                                                + Exclusion.Description.ToString());
+                        }
                         bSkipRule = true;
                     }
                 }
@@ -387,7 +700,12 @@ void URuleRangerEditorSubsystem::ProcessRule(UObject* Object, const FRuleRangerR
         {
             if (const auto Config = ConfigPtr.Get())
             {
-                if (Config->ConfigMatches(Path))
+                const FRuleRangerExplainTrace::FNodeScope ConfigNode(TEXT("Config"), Config);
+                if (!Config->ConfigMatches(Path))
+                {
+                    FRuleRangerExplainTrace::SetOutcome(TEXT("Skipped: object is not in the config directories"));
+                }
+                else
                 {
                     TArray<FRuleRangerRuleExclusion> Exclusions;
                     Exclusions.Reserve(Config->Exclusions.Num());
@@ -396,6 +714,7 @@ void URuleRangerEditorSubsystem::ProcessRule(UObject* Object, const FRuleRangerR
                         if (Exclusion.ExclusionMatches(*Object, Path))
                         {
                             Exclusions.Add(Exclusion);
+                            NoteExclusion(Exclusion);
                         }
                     }
 
@@ -409,6 +728,7 @@ void URuleRangerEditorSubsystem::ProcessRule(UObject* Object, const FRuleRangerR
                                 if (Exclusion.ExclusionMatches(*Object, Path))
                                 {
                                     Exclusions.Add(Exclusion);
+                                    NoteExclusion(Exclusion);
                                 }
                             }
                         }
@@ -425,6 +745,7 @@ void URuleRangerEditorSubsystem::ProcessRule(UObject* Object, const FRuleRangerR
                                                          ProcessRuleFunction,
                                                          Visited))
                             {
+                                ActionContext->InvalidateObjectAnalyses();
                                 return;
                             }
                         }
@@ -456,6 +777,8 @@ void URuleRangerEditorSubsystem::ProcessRule(UObject* Object, const FRuleRangerR
     if (IsValid(ActionContext))
     {
         ActionContext->ClearContext();
+        // Analyses are shared across all the rules applied to the object and are discarded once all rules complete
+        ActionContext->InvalidateObjectAnalyses();
     }
 }
 
@@ -468,25 +791,6 @@ bool URuleRangerEditorSubsystem::ProcessOnAssetValidateRule(URuleRangerConfig* c
 {
     if ((!bIsSave && Rule->bApplyOnValidate) || (bIsSave && Rule->bApplyOnSave))
     {
-        // If we previously determined during CanValidate that this rule does not match this object,
-        // skip invoking Apply/Match a second time.
-        if (ValidationMatchCacheObject == InObject)
-        {
-            const TWeakObjectPtr Key(Rule);
-            if (const auto Cached = ValidationMatchCache.Find(Key))
-            {
-                if (!*Cached)
-                {
-                    UE_LOGFMT(LogRuleRanger,
-                              VeryVerbose,
-                              "OnAssetValidate({Object}) skipped rule {Rule} due to cached non-match.",
-                              InObject->GetName(),
-                              Rule->GetName());
-
-                    return true;
-                }
-            }
-        }
         UE_LOGFMT(LogRuleRanger,
                   VeryVerbose,
                   "OnAssetValidate({Object}) detected applicable rule {Rule}.",
@@ -534,20 +838,54 @@ bool URuleRangerEditorSubsystem::ProcessOnAssetValidateRule(URuleRangerConfig* c
     }
     else
     {
+        FRuleRangerExplainTrace::SetOutcome(bIsSave ? TEXT("Skipped: rule is not applied on save")
+                                                    : TEXT("Skipped: rule is not applied on validate"));
         return true;
     }
 }
 
-void URuleRangerEditorSubsystem::ResetValidationMatchCache(UObject* InObject)
+void URuleRangerEditorSubsystem::ClearValidationPlan()
 {
-    ValidationMatchCacheObject = InObject;
-    ValidationMatchCache.Reset();
+    ValidationPlanObject.Reset();
+    bValidationPlanIsSave = false;
+    ValidationPlan.Reset();
 }
 
-void URuleRangerEditorSubsystem::ClearValidationMatchCache()
+bool URuleRangerEditorSubsystem::HasValidationPlan(const UObject* InObject, const bool bIsSave) const
 {
-    ValidationMatchCacheObject.Reset();
-    ValidationMatchCache.Reset();
+    return InObject && ValidationPlanObject.Get() == InObject && bValidationPlanIsSave == bIsSave;
+}
+
+void URuleRangerEditorSubsystem::ReplayValidationPlan(UObject* InObject,
+                                                      const bool bIsSave,
+                                                      IRuleRangerResultHandler* InResultHandler)
+{
+    UE_LOGFMT(LogRuleRanger,
+              VeryVerbose,
+              "OnAssetValidate({Object}) replaying {Count} rule(s) matched during CanValidate.",
+              InObject->GetName(),
+              ValidationPlan.Num());
+    for (const auto& Entry : ValidationPlan)
+    {
+        const auto Config = Entry.Config.Get();
+        const auto RuleSet = Entry.RuleSet.Get();
+        // ReSharper disable once CppTooWideScopeInitStatement
+        const auto Rule = Entry.Rule.Get();
+        if (Config && RuleSet && Rule && IsValid(InObject))
+        {
+            if (!ProcessOnAssetValidateRule(Config, RuleSet, Rule, InObject, bIsSave, InResultHandler))
+            {
+                break;
+            }
+        }
+    }
+
+    // Mirror the cleanup that ProcessRule performs once all rules have been applied
+    if (IsValid(ActionContext))
+    {
+        ActionContext->ClearContext();
+        ActionContext->InvalidateObjectAnalyses();
+    }
 }
 
 bool URuleRangerEditorSubsystem::ProcessOnAssetPostImportRule(URuleRangerConfig* const Config,
@@ -611,6 +949,8 @@ bool URuleRangerEditorSubsystem::ProcessOnAssetPostImportRule(URuleRangerConfig*
                   InObject->GetName(),
                   Rule->GetName(),
                   bIsReimport ? TEXT("reimport") : TEXT("import"));
+        FRuleRangerExplainTrace::SetOutcome(bIsReimport ? TEXT("Skipped: rule is not applied on reimport")
+                                                        : TEXT("Skipped: rule is not applied on import"));
         return true;
     }
 }
@@ -672,6 +1012,7 @@ bool URuleRangerEditorSubsystem::ProcessDemandScan(URuleRangerConfig* const Conf
                   "rule does not enable rule on demand.",
                   InObject->GetName(),
                   Rule->GetName());
+        FRuleRangerExplainTrace::SetOutcome(TEXT("Skipped: rule is not applied on demand"));
         return true;
     }
 }
@@ -734,6 +1075,7 @@ bool URuleRangerEditorSubsystem::ProcessDemandScanAndFix(URuleRangerConfig* cons
                   "rule does not enable rule on demand.",
                   InObject->GetName(),
                   Rule->GetName());
+        FRuleRangerExplainTrace::SetOutcome(TEXT("Skipped: rule is not applied on demand"));
         return true;
     }
 }
@@ -757,51 +1099,38 @@ void URuleRangerEditorSubsystem::ProcessProjectRules(const FRuleRangerProjectRul
     }
 }
 
-bool URuleRangerEditorSubsystem::ProcessProjectDemandScan(URuleRangerConfig* const Config,
-                                                          URuleRangerRuleSet* const RuleSet,
-                                                          URuleRangerProjectRule* Rule,
-                                                          IRuleRangerProjectResultHandler* Handler) const
+void URuleRangerEditorSubsystem::ReportProjectRules(const FRuleRangerProjectContextFn& OnRuleApplied)
 {
-    check(ProjectActionContext);
-
-    if (Rule->bApplyOnDemand)
+    if (!ProjectActionContext)
     {
-        UE_LOGFMT(LogRuleRanger,
-                  VeryVerbose,
-                  "ProcessProjectDemandScan applying project rule {Rule}.",
-                  Rule->GetName());
-        ProjectActionContext->ResetContext(Config, RuleSet, Rule, ERuleRangerProjectActionTrigger::AT_Report);
-
-        Rule->Apply(ProjectActionContext);
+        UE_LOGFMT(LogRuleRanger, VeryVerbose, "RuleRangerEditorSubsystem: Creating the initial ProjectActionContext");
+        ProjectActionContext =
+            NewObject<URuleRangerProjectActionContext>(this, URuleRangerProjectActionContext::StaticClass());
+    }
 
-        if (const auto EffectiveHandler = Handler ? Handler : DefaultProjectResultHandler.GetInterface())
-        {
-            EffectiveHandler->OnProjectRuleApplied(ProjectActionContext);
-        }
+    const auto Configs = GetCachedRuleSetConfigs();
+    RuleRanger::Traversal::ReportProjectRulesForConfigs(Configs, ProjectActionContext, OnRuleApplied);
+}
 
-        const auto State = ProjectActionContext->GetState();
-        ProjectActionContext->ClearContext();
+bool URuleRangerEditorSubsystem::OnProjectRuleReported(URuleRangerProjectActionContext* ActionContext,
+                                                       IRuleRangerProjectResultHandler* Handler) const
+{
+    if (const auto EffectiveHandler = Handler ? Handler : DefaultProjectResultHandler.GetInterface())
+    {
+        EffectiveHandler->OnProjectRuleApplied(ActionContext);
+    }
 
-        if (ERuleRangerActionState::AS_Fatal == State)
-        {
-            UE_LOGFMT(
-                LogRuleRanger,
-                VeryVerbose,
-                "ProcessProjectDemandScan applied project rule {Rule} which resulted in fatal error. Processing rules will not continue.",
-                Rule->GetName());
-            return false;
-        }
-        else
-        {
-            return true;
-        }
+    if (ERuleRangerActionState::AS_Fatal == ActionContext->GetState())
+    {
+        UE_LOGFMT(
+            LogRuleRanger,
+            VeryVerbose,
+            "OnProjectRuleReported applied project rule {Rule} which resulted in fatal error. Processing rules will not continue.",
+            ActionContext->GetRule()->GetName());
+        return false;
     }
     else
     {
-        UE_LOGFMT(LogRuleRanger,
-                  VeryVerbose,
-                  "ProcessProjectDemandScan skipped project rule {Rule} as rule is not enabled on demand.",
-                  Rule->GetName());
         return true;
     }
 }
@@ -866,28 +1195,42 @@ bool URuleRangerEditorSubsystem::ProcessProjectDemandScanAndFix(URuleRangerConfi
 
 void URuleRangerEditorSubsystem::RunProjectScan(const bool bFix, IRuleRangerProjectResultHandler* ProjectHandler)
 {
-    ProcessProjectRules([&](auto Config, auto RuleSet, auto Rule) {
-        return bFix ? ProcessProjectDemandScanAndFix(Config, RuleSet, Rule, ProjectHandler)
-                    : ProcessProjectDemandScan(Config, RuleSet, Rule, ProjectHandler);
-    });
+    if (bFix)
+    {
+        ProcessProjectRules([&](auto Config, auto RuleSet, auto Rule) {
+            return ProcessProjectDemandScanAndFix(Config, RuleSet, Rule, ProjectHandler);
+        });
+    }
+    else
+    {
+        ReportProjectRules([&](auto ActionContext) { return OnProjectRuleReported(ActionContext, ProjectHandler); });
+    }
 }
 
 void URuleRangerEditorSubsystem::RunProjectScanCancellable(const bool bFix,
                                                            IRuleRangerProjectResultHandler* ProjectHandler,
                                                            const TFunctionRef<bool()>& ShouldContinue)
 {
-    ProcessProjectRules([&](auto Config, auto RuleSet, auto Rule) {
-        if (ShouldContinue())
-        {
-            const bool bContinue = bFix ? ProcessProjectDemandScanAndFix(Config, RuleSet, Rule, ProjectHandler)
-                                        : ProcessProjectDemandScan(Config, RuleSet, Rule, ProjectHandler);
-            return bContinue && ShouldContinue();
-        }
-        else
-        {
-            return false;
-        }
-    });
+    if (bFix)
+    {
+        ProcessProjectRules([&](auto Config, auto RuleSet, auto Rule) {
+            if (ShouldContinue())
+            {
+                return ProcessProjectDemandScanAndFix(Config, RuleSet, Rule, ProjectHandler) && ShouldContinue();
+            }
+            else
+            {
+                return false;
+            }
+        });
+    }
+    else
+    {
+        // Concurrent rules may already have been applied when cancelled but their results are discarded
+        ReportProjectRules([&](auto ActionContext) {
+            return ShouldContinue() && OnProjectRuleReported(ActionContext, ProjectHandler) && ShouldContinue();
+        });
+    }
 }
 
 // (Removed) Duplicated project rule counting moved to RuleRanger::Traversal helpers
@@ -905,6 +1248,20 @@ static void TickTask(FScopedSlowTask& SlowTask)
     SlowTask.TickProgress();
 }
 
+static void ExecuteRenameBatch(FRuleRangerRenameBatch& RenameBatch, FMessageLog& MessageLog)
+{
+    // ReSharper disable once CppTooWideScopeInitStatement
+    const auto FailedCount = RenameBatch.Execute();
+    if (FailedCount > 0)
+    {
+        MessageLog.Error()->AddToken(FTextToken::Create(
+            FText::Format(NSLOCTEXT("RuleRanger",
+                                    "BatchedRenamesFailed",
+                                    "{0} asset rename(s) failed. See the output log for details."),
+                          FText::AsNumber(FailedCount))));
+    }
+}
+
 void URuleRangerEditorSubsystem::ProcessAssetsCommon(const TArray<FAssetData>& Assets,
                                                      const FText& SlowTaskText,
                                                      const FText& StartAtText,
@@ -922,12 +1279,20 @@ void URuleRangerEditorSubsystem::ProcessAssetsCommon(const TArray<FAssetData>& A
     FMessageLog MessageLog(FRuleRangerMessageLog::GetMessageLogName());
     MessageLog.Info()->AddToken(FTextToken::Create(FText::Format(StartAtText, FText::AsDateTime(FDateTime::UtcNow()))));
 
+    if (bFix)
+    {
+        PrepareAssetsForFix(Assets);
+    }
+
+    // Renames requested by fixes are performed together once the assets have been processed
+    FRuleRangerRenameBatch RenameBatch;
     TSet<FSoftObjectPath> Seen;
 
     for (const auto& Asset : Assets)
     {
         if (SlowTask.ShouldCancel())
         {
+            ExecuteRenameBatch(RenameBatch, MessageLog);
             MessageLog.Info()->AddToken(
                 FTextToken::Create(FText::Format(CancelText, FText::AsDateTime(FDateTime::UtcNow()))));
             MaybeOpenMessageLog(MessageLog);
@@ -954,6 +1319,7 @@ void URuleRangerEditorSubsystem::ProcessAssetsCommon(const TArray<FAssetData>& A
         }
         TickTask(SlowTask);
     }
+    ExecuteRenameBatch(RenameBatch, MessageLog);
 
     MessageLog.Info()->AddToken(
         FTextToken::Create(FText::Format(CompletedText, FText::AsDateTime(FDateTime::UtcNow()))));
@@ -993,6 +1359,205 @@ void URuleRangerEditorSubsystem::OnFixSelectedAssets(const TArray<FAssetData>& A
         true);
 }
 
+void URuleRangerEditorSubsystem::CollectOnDemandActions(UObject* InObject,
+                                                        const TSubclassOf<URuleRangerAction> ActionType,
+                                                        const bool bFix,
+                                                        TArray<URuleRangerAction*>& OutActions)
+{
+    const auto Trigger = bFix ? ERuleRangerActionTrigger::AT_Fix : ERuleRangerActionTrigger::AT_Report;
+    ProcessRule(InObject,
+                [this, ActionType, Trigger, &OutActions](auto Config, auto RuleSet, auto Rule, auto Object) {
+                    // ReSharper disable once CppTooWideScopeInitStatement
+                    const auto bHasActionOfType = Rule->Actions.ContainsByPredicate(
+                        [ActionType](const auto& Action) { return IsValid(Action) && Action->IsA(ActionType); });
+                    if (Rule->bApplyOnDemand && bHasActionOfType)
+                    {
+                        ActionContext->ResetContext(Config, RuleSet, Rule, Object, Trigger);
+                        if (Rule->Match(ActionContext, Object))
+                        {
+                            for (const auto Action : Rule->Actions)
+                            {
+                                if (IsValid(Action) && Action->IsA(ActionType))
+                                {
+                                    OutActions.AddUnique(Action);
+                                }
+                            }
+                        }
+                    }
+                    return true;
+                });
+}
+
+static bool IsAssetPotentiallyOfType(const FAssetData& Asset, const UClass* Class)
+{
+    if (Asset.IsInstanceOf(Class))
+    {
+        return true;
+    }
+    else if (Asset.IsInstanceOf(UBlueprint::StaticClass()))
+    {
+        // Actions may be applied to the default object of a Blueprint so check the native parent class
+        // of the Blueprint and assume that the Blueprint is a candidate if the parent class can not be resolved
+        FString NativeParentClassPath;
+        if (Asset.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParentClassPath))
+        {
+            const auto ObjectPath = FPackageName::ExportTextPathToObjectPath(NativeParentClassPath);
+            const auto NativeParentClass = FindObject<UClass>(nullptr, *ObjectPath);
+            return !NativeParentClass || NativeParentClass->IsChildOf(Class);
+        }
+        else
+        {
+            return true;
+        }
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void URuleRangerEditorSubsystem::CollectRuleSetOnDemandActions(
+    URuleRangerRuleSet* const RuleSet,
+    const TFunctionRef<bool(const URuleRangerAction&)>& ActionFilter,
+    TSet<const URuleRangerRuleSet*>& Visited,
+    TSet<URuleRangerAction*>& OutActions) const
+{
+    if (!Visited.Contains(RuleSet))
+    {
+        Visited.Add(RuleSet);
+        for (const auto& NestedRuleSetPtr : RuleSet->RuleSets)
+        {
+            if (const auto NestedRuleSet = NestedRuleSetPtr.Get())
+            {
+                CollectRuleSetOnDemandActions(NestedRuleSet, ActionFilter, Visited, OutActions);
+            }
+        }
+        for (const auto Rule : RuleSet->Rules)
+        {
+            if (IsValid(Rule) && Rule->bApplyOnDemand)
+            {
+                for (const auto Action : Rule->Actions)
+                {
+                    if (IsValid(Action) && ActionFilter(*Action))
+                    {
+                        OutActions.Add(Action);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void URuleRangerEditorSubsystem::FilterAssetsForOnDemandActions(
+    const TFunctionRef<bool(const URuleRangerAction&)>& ActionFilter,
+    TArray<FAssetData>& InOutAssets) const
+{
+    struct FConfigActionTypes
+    {
+        const URuleRangerConfig* Config{ nullptr };
+        TArray<const UClass*> ExpectedTypes;
+    };
+
+    // The actions are collected per config as an asset is only checked by the rules of the configs that match it
+    TArray<FConfigActionTypes> ConfigActionTypes;
+    for (const auto ConfigPtr : GetCachedRuleSetConfigs())
+    {
+        if (const auto Config = ConfigPtr.Get())
+        {
+            TSet<URuleRangerAction*> Actions;
+            TSet<const URuleRangerRuleSet*> Visited;
+            for (const auto& RuleSetPtr : Config->RuleSets)
+            {
+                if (const auto RuleSet = RuleSetPtr.Get())
+                {
+                    CollectRuleSetOnDemandActions(RuleSet, ActionFilter, Visited, Actions);
+                }
+            }
+            if (!Actions.IsEmpty())
+            {
+                auto& Entry = ConfigActionTypes.AddDefaulted_GetRef();
+                Entry.Config = Config;
+                for (const auto Action : Actions)
+                {
+                    Entry.ExpectedTypes.AddUnique(Action->GetExpectedType());
+                }
+            }
+        }
+    }
+
+    if (ConfigActionTypes.IsEmpty())
+    {
+        InOutAssets.Reset();
+    }
+    else
+    {
+        InOutAssets.RemoveAll([&ConfigActionTypes](const FAssetData& Asset) {
+            const auto Path = Asset.GetObjectPathString();
+            for (const auto& Entry : ConfigActionTypes)
+            {
+                if (Entry.Config->ConfigMatches(Path))
+                {
+                    for (const auto ExpectedType : Entry.ExpectedTypes)
+                    {
+                        if (IsAssetPotentiallyOfType(Asset, ExpectedType))
+                        {
+                            return false;
+                        }
+                    }
+                }
+            }
+            return true;
+        });
+    }
+}
+
+void URuleRangerEditorSubsystem::PrepareAssetsForFix(const TArray<FAssetData>& Assets)
+{
+    // Avoid loading assets that none of the actions can be applied to
+    auto Candidates{ Assets };
+    FilterAssetsForOnDemandActions([](const auto& Action) { return Action.ShouldPrepareForFix(); }, Candidates);
+    if (!Candidates.IsEmpty())
+    {
+        TMap<URuleRangerAction*, TArray<UObject*>> ObjectsByAction;
+        TSet<UObject*> SeenObjects;
+        for (const auto& Asset : Candidates)
+        {
+            // The same asset may be listed more than once, so each object is only given to an action once
+            bool bAlreadySeen{ false };
+            const auto Object = Asset.GetAsset();
+            if (Object)
+            {
+                SeenObjects.Add(Object, &bAlreadySeen);
+            }
+            if (Object && !bAlreadySeen)
+            {
+                TArray<URuleRangerAction*> Actions;
+                CollectOnDemandActions(Object, URuleRangerAction::StaticClass(), true, Actions);
+                for (const auto Action : Actions)
+                {
+                    // A rule may contain actions that expect different types so, as when the rule is applied,
+                    // an action is only given the objects that are of the type it expects
+                    if (Action->ShouldPrepareForFix()
+                        && FRuleRangerUtilities::ToObject<UObject>(Object, Action->GetExpectedType()))
+                    {
+                        ObjectsByAction.FindOrAdd(Action).Add(Object);
+                    }
+                }
+            }
+        }
+
+        for (const auto& Pair : ObjectsByAction)
+        {
+            UE_LOGFMT(LogRuleRanger,
+                      Verbose,
+                      "PrepareAssetsForFix: Action {Action} preparing {Count} object(s) before applying rules",
+                      Pair.Key->GetName(),
+                      Pair.Value.Num());
+            Pair.Key->PrepareForFix(Pair.Value);
+        }
+    }
+}
+
 // ReSharper disable once CppMemberFunctionMayBeStatic
 void URuleRangerEditorSubsystem::CollectAssetsFromPaths(const TArray<FString>& AssetPaths, TArray<FAssetData>& Assets)
 {
@@ -1171,7 +1736,7 @@ void URuleRangerEditorSubsystem::OnScanProject()
         NSLOCTEXT("RuleRanger", "ScanProjectStartingAt", "Rule Ranger has started scanning the project at {0}"),
         FText::AsDateTime(FDateTime::UtcNow()))));
 
-    ProcessProjectRules([&](auto Config, auto RuleSet, auto Rule) {
+    ReportProjectRules([&](auto ActionContext) {
         if (SlowTask.ShouldCancel())
         {
             MessageLog.Info()->AddToken(FTextToken::Create(
@@ -1183,7 +1748,7 @@ void URuleRangerEditorSubsystem::OnScanProject()
             return false;
         }
 
-        const bool bContinue = ProcessProjectDemandScan(Config, RuleSet, Rule);
+        const bool bContinue = OnProjectRuleReported(ActionContext);
         TickTask(SlowTask);
         return bContinue;
     });
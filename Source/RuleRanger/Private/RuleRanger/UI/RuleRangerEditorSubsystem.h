@@ -13,16 +13,21 @@
  */
 #pragma once
 
+#include "AssetRegistry/AssetData.h"
+#include "Containers/Ticker.h"
 #include "CoreMinimal.h"
 #include "EditorSubsystem.h"
+#include "RuleRanger/RuleRangerChangeImpact.h"
 #include "Templates/Function.h"
 #include "RuleRangerEditorSubsystem.generated.h"
 
 struct FRuleRangerRuleExclusion;
-struct FAssetData;
+class FObjectPostSaveContext;
+class FRuleRangerExplainTrace;
 class IRuleRangerResultHandler;
 class UFactory;
 class URuleRangerRule;
+class URuleRangerAction;
 class URuleRangerActionContext;
 class URuleRangerEditorValidator;
 class URuleRangerConfig;
@@ -41,6 +46,20 @@ using FRuleRangerRuleFn = TFunctionRef<
 using FRuleRangerProjectRuleFn = TFunctionRef<
     bool(URuleRangerConfig* const Config, URuleRangerRuleSet* const RuleSet, URuleRangerProjectRule* Rule)>;
 
+// Shape of function called with the context of a project rule once it has been applied in report mode.
+using FRuleRangerProjectContextFn = TFunctionRef<bool(URuleRangerProjectActionContext* ActionContext)>;
+
+// Broadcast with the assets that changed once changes have settled while watching for changes
+DECLARE_MULTICAST_DELEGATE_OneParam(FRuleRangerWatchedAssetsChanged, const TArray<FAssetData>& /* Assets */);
+
+// A rule that matched an object during the CanValidate stage of validation
+struct FRuleRangerValidationPlanEntry
+{
+    TWeakObjectPtr<URuleRangerConfig> Config;
+    TWeakObjectPtr<URuleRangerRuleSet> RuleSet;
+    TWeakObjectPtr<URuleRangerRule> Rule;
+};
+
 /**
  * The subsystem responsible for managing callbacks to other subsystems such as ImportSubsystem callbacks.
  */
@@ -66,6 +85,19 @@ public:
 
     void ScanAndFixObject(UObject* InObject, IRuleRangerResultHandler* InResultHandler = nullptr);
 
+    /**
+     * Scan (or scan and fix) the object while recording each decision made in selecting and applying rules.
+     *
+     * @param InObject the object to explain.
+     * @param bFix true to apply fixes as ScanAndFixObject does, false to only scan.
+     * @param Trace the trace to add the decisions to, beneath a node for the object.
+     * @param InResultHandler the handler for the results of the rules or nullptr to use the default handler.
+     */
+    void ExplainObject(UObject* InObject,
+                       bool bFix,
+                       FRuleRangerExplainTrace& Trace,
+                       IRuleRangerResultHandler* InResultHandler = nullptr);
+
     void ValidateObject(UObject* InObject, bool bIsSave, IRuleRangerResultHandler* InResultHandler = nullptr);
 
     bool CanValidateObject(UObject* InObject, bool bIsSave);
@@ -84,6 +116,40 @@ public:
 
     void CollectAssetsFromPaths(const TArray<FString>& AssetPaths, TArray<FAssetData>& Assets);
 
+    /**
+     * Give the actions that will be applied to the supplied assets the chance to prepare the assets before they
+     * are scanned and fixed. See URuleRangerAction::PrepareForFix().
+     *
+     * @param Assets the assets that are about to be scanned and fixed.
+     */
+    void PrepareAssetsForFix(const TArray<FAssetData>& Assets);
+
+    /**
+     * Collect the actions of the specified type that would be applied to the object by an on-demand scan.
+     * The actions are collected from the rules that are applied on demand and that match the object.
+     *
+     * @param InObject the object.
+     * @param ActionType the type of action to collect.
+     * @param bFix true if the object will be scanned and fixed, false if it will only be scanned.
+     * @param OutActions the array to add the actions to.
+     */
+    void CollectOnDemandActions(UObject* InObject,
+                                TSubclassOf<URuleRangerAction> ActionType,
+                                bool bFix,
+                                TArray<URuleRangerAction*>& OutActions);
+
+    /**
+     * Remove the assets that can not be matched by an on-demand rule containing an action accepted by the filter.
+     * The assets are not loaded. An asset is retained if it is in the directories of a config that contains such
+     * a rule and it is potentially of the type expected by the action. i.e. this allows a caller to avoid loading
+     * assets that no rule will check.
+     *
+     * @param ActionFilter the function that returns true for the actions of interest.
+     * @param InOutAssets the assets to filter.
+     */
+    void FilterAssetsForOnDemandActions(const TFunctionRef<bool(const URuleRangerAction&)>& ActionFilter,
+                                        TArray<FAssetData>& InOutAssets) const;
+
     void OnFixSelectedPaths(const TArray<FString>& Paths);
 
     void OnScanContent();
@@ -113,6 +179,19 @@ public:
      */
     bool HasAnyConfiguredDirs() const;
 
+    /** Start or stop watching for asset changes to match the bWatchForChanges developer setting. */
+    void UpdateWatchForChanges();
+
+    FORCEINLINE bool IsWatchingForChanges() const { return bWatchingForChanges; }
+
+    /**
+     * Delegate broadcast while watching for changes. Changes to assets are collected until no change has been
+     * observed for WatchDebounceSeconds and the changed assets are then broadcast together. When a rule, rule
+     * set, config, exclusion set or DataTable that rules depend upon changes, the assets whose results may
+     * change are broadcast as well.
+     */
+    FRuleRangerWatchedAssetsChanged OnWatchedAssetsChanged;
+
 private:
     UPROPERTY(Transient)
     TScriptInterface<IRuleRangerResultHandler> DefaultResultHandler{ nullptr };
@@ -131,16 +210,64 @@ private:
     UPROPERTY(Transient)
     URuleRangerProjectActionContext* ProjectActionContext{ nullptr };
 
-    // Cached results of Rule->Match(Object) calculated during CanValidate stage
+    // The rules that matched the object during the CanValidate stage in traversal order. The Validate stage
+    // replays the plan rather than traversing the configs and re-matching every rule a second time.
     UPROPERTY(Transient)
-    TWeakObjectPtr<UObject> ValidationMatchCacheObject{ nullptr };
-    TMap<TWeakObjectPtr<URuleRangerRule>, bool> ValidationMatchCache;
+    TWeakObjectPtr<UObject> ValidationPlanObject{ nullptr };
+    bool bValidationPlanIsSave{ false };
+    TArray<FRuleRangerValidationPlanEntry> ValidationPlan;
 
     FDelegateHandle OnAssetPostImportDelegateHandle;
 
-    void ClearValidationMatchCache();
+    // Objects imported during the current import batch. The objects are processed together once the
+    // batch completes rather than one at a time while the importer is still creating assets.
+    TArray<TWeakObjectPtr<UObject>> PendingImports;
+    FTSTicker::FDelegateHandle PendingImportsTickerHandle;
+
+    bool OnPendingImportsTick(float DeltaTime);
+
+    bool bWatchingForChanges{ false };
+    FDelegateHandle OnAssetAddedDelegateHandle;
+    FDelegateHandle OnAssetUpdatedDelegateHandle;
+    FDelegateHandle OnAssetRenamedDelegateHandle;
+    FDelegateHandle OnPackageSavedDelegateHandle;
+    FDelegateHandle OnObjectModifiedDelegateHandle;
+
+    // The packages that rules depend upon as of the last change to them. The index from before a change is
+    // retained until the change is processed so that the assets affected by a removed rule are also rescanned.
+    FRuleRangerChangeImpact RuleImpact;
+    TSet<FName> PendingChangedDependencies;
+
+    // Assets changed since changes were last broadcast, indexed by object path so repeated changes coalesce
+    TMap<FSoftObjectPath, FAssetData> PendingChangedAssets;
+    double LastAssetChangeTime{ 0 };
+    FTSTicker::FDelegateHandle PendingChangesTickerHandle;
+
+    void StopWatchingForChanges();
+
+    void OnWatchedAssetChanged(const FAssetData& AssetData);
+
+    void OnWatchedAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
 
-    void ResetValidationMatchCache(UObject* InObject);
+    void OnWatchedPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext Context);
+
+    void OnWatchedObjectModified(UObject* Object);
+
+    void QueueWatchedChange();
+
+    void CollectAssetsImpactedByRuleChanges(TArray<FAssetData>& OutAssets);
+
+    bool OnPendingChangesTick(float DeltaTime);
+
+    void ProcessPendingChanges();
+
+    void ProcessPendingImports();
+
+    void ClearValidationPlan();
+
+    bool HasValidationPlan(const UObject* InObject, bool bIsSave) const;
+
+    void ReplayValidationPlan(UObject* InObject, bool bIsSave, IRuleRangerResultHandler* InResultHandler);
 
     void ProcessRule(UObject* Object, const FRuleRangerRuleFn& ProcessRuleFunction);
 
@@ -155,6 +282,11 @@ private:
 
     bool CanValidateObject(const URuleRangerRule* Rule, const UObject* InObject, const bool bIsSave) const;
 
+    void CollectRuleSetOnDemandActions(URuleRangerRuleSet* const RuleSet,
+                                       const TFunctionRef<bool(const URuleRangerAction&)>& ActionFilter,
+                                       TSet<const URuleRangerRuleSet*>& Visited,
+                                       TSet<URuleRangerAction*>& OutActions) const;
+
     /**
      * Function invoked when each rule is applied to an object.
      *
@@ -226,10 +358,10 @@ private:
     // Project rule traversal and execution helpers
     void ProcessProjectRules(const FRuleRangerProjectRuleFn& ProcessRuleFunction);
 
-    bool ProcessProjectDemandScan(URuleRangerConfig* const Config,
-                                  URuleRangerRuleSet* const RuleSet,
-                                  URuleRangerProjectRule* Rule,
-                                  IRuleRangerProjectResultHandler* Handler = nullptr) const;
+    void ReportProjectRules(const FRuleRangerProjectContextFn& OnRuleApplied);
+
+    bool OnProjectRuleReported(URuleRangerProjectActionContext* ActionContext,
+                               IRuleRangerProjectResultHandler* Handler = nullptr) const;
 
     bool ProcessProjectDemandScanAndFix(URuleRangerConfig* const Config,
                                         URuleRangerRuleSet* const RuleSet,
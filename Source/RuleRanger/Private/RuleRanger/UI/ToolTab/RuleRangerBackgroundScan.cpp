@@ -0,0 +1,204 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "RuleRanger/UI/ToolTab/RuleRangerBackgroundScan.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "RuleRanger/UI/RuleRangerEditorSubsystem.h"
+#include "RuleRanger/UI/ToolTab/RuleRangerToolResultHandler.h"
+#include "RuleRanger/UI/ToolTab/SRuleRangerToolPanel.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+FRuleRangerBackgroundScan::FRuleRangerBackgroundScan(const TSharedPtr<FRuleRangerRun>& InRun,
+                                                     TArray<FAssetData> InAssets,
+                                                     const double InBudgetSeconds)
+    : Run(InRun), Assets(MoveTemp(InAssets)), BudgetSeconds(FMath::Max(0.001, InBudgetSeconds))
+{
+}
+
+FRuleRangerBackgroundScan::~FRuleRangerBackgroundScan()
+{
+    Cancel();
+}
+
+void FRuleRangerBackgroundScan::Start(URuleRangerEditorSubsystem* InSubsystem)
+{
+    if (!bRunning && IsValid(InSubsystem))
+    {
+        bRunning = true;
+        Subsystem = InSubsystem;
+        Handler.Reset(NewObject<URuleRangerToolResultHandler>(InSubsystem));
+        Handler->Init(Run);
+        if (const auto CurrentRun = Run.Pin())
+        {
+            ReportedMessageCount = CurrentRun->Messages.Num();
+        }
+
+        if (bShowNotification)
+        {
+            FNotificationInfo Info(NSLOCTEXT("RuleRanger", "BackgroundScanStarted", "Rule Ranger: Scanning assets..."));
+            Info.bFireAndForget = false;
+            Info.bUseThrobber = true;
+            Info.bUseSuccessFailIcons = true;
+            Info.ButtonDetails.Add(
+                FNotificationButtonInfo(NSLOCTEXT("RuleRanger", "BackgroundScanCancel", "Cancel"),
+                                        NSLOCTEXT("RuleRanger", "BackgroundScanCancelToolTip", "Stop scanning assets"),
+                                        FSimpleDelegate::CreateSP(this, &FRuleRangerBackgroundScan::Cancel),
+                                        SNotificationItem::CS_Pending));
+            // ReSharper disable once CppTooWideScopeInitStatement
+            const auto Item = FSlateNotificationManager::Get().AddNotification(Info);
+            if (Item.IsValid())
+            {
+                Item->SetCompletionState(SNotificationItem::CS_Pending);
+                Notification = Item;
+            }
+        }
+
+        TickerHandle =
+            FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FRuleRangerBackgroundScan::Tick));
+    }
+}
+
+void FRuleRangerBackgroundScan::Cancel()
+{
+    if (bRunning)
+    {
+        Finish(true);
+    }
+}
+
+bool FRuleRangerBackgroundScan::Tick(float)
+{
+    if (bRunning)
+    {
+        if (!Run.IsValid() || !Subsystem.IsValid())
+        {
+            // The run was closed or the editor is shutting down
+            Finish(true);
+        }
+        else
+        {
+            const auto EndTime = FPlatformTime::Seconds() + BudgetSeconds;
+            RequestLoads();
+            while (NextIndex < Assets.Num() && FPlatformTime::Seconds() < EndTime)
+            {
+                const auto Handle = LoadHandles.FindRef(NextIndex);
+                if (Handle.IsValid() && Handle->IsLoadingInProgress())
+                {
+                    // Yield rather than block on the load. The asset will be ready on a later tick.
+                    break;
+                }
+                else
+                {
+                    // Assets without a load request are loaded synchronously.
+                    // ReSharper disable once CppTooWideScopeInitStatement
+                    const auto Object = Handle.IsValid() ? Handle->GetLoadedAsset() : Assets[NextIndex].GetAsset();
+                    if (Object)
+                    {
+                        Subsystem->ScanObject(Object, Handler.Get());
+                    }
+                    if (Handle.IsValid())
+                    {
+                        Handle->ReleaseHandle();
+                    }
+                    LoadHandles.Remove(NextIndex);
+                    NextIndex++;
+                    RequestLoads();
+                }
+            }
+
+            if (NextIndex >= Assets.Num())
+            {
+                Finish(false);
+            }
+            else
+            {
+                ReportProgress(false);
+            }
+        }
+    }
+    return bRunning;
+}
+
+void FRuleRangerBackgroundScan::RequestLoads()
+{
+    while (NextLoadIndex < Assets.Num() && NextLoadIndex < NextIndex + LoadAheadCount)
+    {
+        // ReSharper disable once CppTooWideScopeInitStatement
+        const auto Handle = StreamableManager.RequestAsyncLoad(Assets[NextLoadIndex].GetSoftObjectPath());
+        if (Handle.IsValid())
+        {
+            LoadHandles.Add(NextLoadIndex, Handle);
+        }
+        NextLoadIndex++;
+    }
+}
+
+void FRuleRangerBackgroundScan::ReportProgress(const bool bForce)
+{
+    const auto Now = FPlatformTime::Seconds();
+    if (bForce || Now - LastProgressTime >= ProgressInterval)
+    {
+        LastProgressTime = Now;
+        if (const auto Item = Notification.Pin())
+        {
+            Item->SetText(FText::Format(
+                NSLOCTEXT("RuleRanger", "BackgroundScanProgress", "Rule Ranger: Scanned {0} of {1} assets"),
+                FText::AsNumber(NextIndex),
+                FText::AsNumber(Assets.Num())));
+        }
+        // ReSharper disable once CppTooWideScopeInitStatement
+        const auto CurrentRun = Run.Pin();
+        if (CurrentRun.IsValid() && CurrentRun->Messages.Num() != ReportedMessageCount)
+        {
+            ReportedMessageCount = CurrentRun->Messages.Num();
+            OnProgress.ExecuteIfBound();
+        }
+    }
+}
+
+void FRuleRangerBackgroundScan::Finish(const bool bCancelled)
+{
+    bRunning = false;
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    TickerHandle.Reset();
+
+    for (const auto& LoadHandle : LoadHandles)
+    {
+        if (LoadHandle.Value.IsValid())
+        {
+            LoadHandle.Value->CancelHandle();
+        }
+    }
+    LoadHandles.Reset();
+
+    ReportProgress(true);
+    if (const auto Item = Notification.Pin())
+    {
+        Item->SetText(bCancelled
+                          ? FText::Format(NSLOCTEXT("RuleRanger",
+                                                    "BackgroundScanCancelled",
+                                                    "Rule Ranger: Scan cancelled after {0} of {1} assets"),
+                                          FText::AsNumber(NextIndex),
+                                          FText::AsNumber(Assets.Num()))
+                          : FText::Format(NSLOCTEXT("RuleRanger",
+                                                    "BackgroundScanCompleted",
+                                                    "Rule Ranger: Scanned {0} assets"),
+                                          FText::AsNumber(Assets.Num())));
+        Item->SetCompletionState(bCancelled ? SNotificationItem::CS_Fail : SNotificationItem::CS_Success);
+        Item->ExpireAndFadeout();
+    }
+    Notification.Reset();
+    Handler.Reset();
+
+    OnFinished.ExecuteIfBound();
+}
@@ -0,0 +1,103 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "AssetRegistry/AssetData.h"
+#include "Containers/Ticker.h"
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+#include "UObject/StrongObjectPtr.h"
+
+class SNotificationItem;
+class URuleRangerEditorSubsystem;
+class URuleRangerToolResultHandler;
+struct FRuleRangerRun;
+
+/**
+ * Scans a set of assets without blocking the editor.
+ *
+ * The scan is driven by the core ticker and each tick scans assets until the time budget is spent. The assets
+ * that are about to be scanned are loaded asynchronously so that a tick rarely waits on a load. Results are
+ * appended to the run as they are produced and progress is reported via a non-modal notification that allows
+ * the user to cancel the scan. The scan is report-only as fixes must not race with edits made by the user.
+ */
+class FRuleRangerBackgroundScan final : public TSharedFromThis<FRuleRangerBackgroundScan>
+{
+public:
+    FRuleRangerBackgroundScan(const TSharedPtr<FRuleRangerRun>& InRun,
+                              TArray<FAssetData> InAssets,
+                              double InBudgetSeconds);
+    ~FRuleRangerBackgroundScan();
+
+    /** Invoked when messages have been added to the run. Invocations are throttled. */
+    FSimpleDelegate OnProgress;
+
+    /** Invoked once when the scan completes or is cancelled. */
+    FSimpleDelegate OnFinished;
+
+    /** Should progress be reported via a notification? Must be set before the scan is started. */
+    FORCEINLINE void SetShowNotification(const bool bInShowNotification) { bShowNotification = bInShowNotification; }
+
+    /** Start scanning on subsequent ticks. */
+    void Start(URuleRangerEditorSubsystem* InSubsystem);
+
+    /** Stop scanning. Results produced so far are retained in the run. */
+    void Cancel();
+
+    FORCEINLINE bool IsRunning() const { return bRunning; }
+    FORCEINLINE int32 GetScannedCount() const { return NextIndex; }
+    FORCEINLINE int32 GetTotalCount() const { return Assets.Num(); }
+
+    /**
+     * Scan assets until the time budget is spent.
+     *
+     * @return true if the scan should continue to be ticked.
+     */
+    bool Tick(float DeltaTime);
+
+private:
+    /** The number of assets ahead of the current asset that have an outstanding load request. */
+    static constexpr int32 LoadAheadCount{ 32 };
+
+    /** The minimum time between progress notifications. */
+    static constexpr double ProgressInterval{ 0.25 };
+
+    TWeakPtr<FRuleRangerRun> Run;
+    TArray<FAssetData> Assets;
+    double BudgetSeconds{ 0.008 };
+
+    /** The index of the next asset to scan. */
+    int32 NextIndex{ 0 };
+
+    /** The index of the next asset to request a load for. */
+    int32 NextLoadIndex{ 0 };
+
+    /** Outstanding load requests indexed by asset index. The handle keeps the asset alive until scanned. */
+    TMap<int32, TSharedPtr<FStreamableHandle>> LoadHandles;
+    FStreamableManager StreamableManager;
+
+    TWeakObjectPtr<URuleRangerEditorSubsystem> Subsystem;
+    TStrongObjectPtr<URuleRangerToolResultHandler> Handler;
+    FTSTicker::FDelegateHandle TickerHandle;
+    TWeakPtr<SNotificationItem> Notification;
+
+    int32 ReportedMessageCount{ 0 };
+    double LastProgressTime{ 0.0 };
+    bool bRunning{ false };
+    bool bShowNotification{ true };
+
+    void RequestLoads();
+    void ReportProgress(bool bForce);
+    void Finish(bool bCancelled);
+};
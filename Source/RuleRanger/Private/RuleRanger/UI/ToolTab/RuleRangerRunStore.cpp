@@ -0,0 +1,247 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "RuleRanger/UI/ToolTab/RuleRangerRunStore.h"
+#include "RuleRanger/UI/ToolTab/SRuleRangerToolPanel.h"
+#include "RuleRangerProjectRule.h"
+#include "RuleRangerRule.h"
+#include "RuleRangerRuleSet.h"
+
+namespace
+{
+    // Short names are likely to occur within a message by chance so they are not replaced
+    constexpr int32 MinAssetNameLengthForPlaceholder{ 3 };
+} // namespace
+
+void FRuleRangerRunStore::Add(const UObject* Asset,
+                              const URuleRangerRuleSet* RuleSet,
+                              const URuleRangerRule* Rule,
+                              const URuleRangerProjectRule* ProjectRule,
+                              const ERuleRangerToolSeverity Severity,
+                              const FText& Text)
+{
+    const auto AssetId = InternObject(Asset);
+    const auto RuleId = InternObject(Rule ? static_cast<const UObject*>(Rule) : ProjectRule);
+    const auto TemplateId = InternTemplate(Text.ToString(), Objects[AssetId].Name);
+
+    const TPair<int32, int32> GroupKey{ RuleId, TemplateId };
+    auto GroupId{ INDEX_NONE };
+    if (const auto ExistingGroupId = GroupIndex.Find(GroupKey))
+    {
+        GroupId = *ExistingGroupId;
+    }
+    else
+    {
+        GroupId = Groups.Add({ RuleId, TemplateId, 0 });
+        GroupIndex.Add(GroupKey, GroupId);
+    }
+    Groups[GroupId].Count++;
+
+    AssetIds.Add(AssetId);
+    RuleSetIds.Add(InternObject(RuleSet));
+    RuleIds.Add(RuleId);
+    TemplateIds.Add(TemplateId);
+    GroupIds.Add(GroupId);
+    Severities.Add(Severity);
+
+    // ReSharper disable once CppTooWideScopeInitStatement
+    const auto SeverityIndex = static_cast<int32>(Severity);
+    if (SeverityIndex >= 0 && SeverityIndex < SeverityCount)
+    {
+        SeverityCounts[SeverityIndex]++;
+    }
+}
+
+void FRuleRangerRunStore::Add(const FRuleRangerMessageRow& Row)
+{
+    Add(Row.Asset.Get(), Row.RuleSet.Get(), Row.Rule.Get(), Row.ProjectRule.Get(), Row.Severity, Row.Text);
+}
+
+void FRuleRangerRunStore::Reset()
+{
+    Objects.Reset();
+    Objects.AddDefaulted();
+    ObjectIndex.Reset();
+    Templates.Reset();
+    TemplateIndex.Reset();
+    Groups.Reset();
+    GroupIndex.Reset();
+    AssetIds.Reset();
+    RuleSetIds.Reset();
+    RuleIds.Reset();
+    TemplateIds.Reset();
+    GroupIds.Reset();
+    Severities.Reset();
+    for (auto& Count : SeverityCounts)
+    {
+        Count = 0;
+    }
+}
+
+int32 FRuleRangerRunStore::RemoveAssets(const TSet<FSoftObjectPath>& AssetPaths)
+{
+    TSet<int32> AssetIdsToRemove;
+    for (auto Id = 1; Id < Objects.Num(); ++Id)
+    {
+        const auto& Entry = Objects[Id];
+        const auto Object = Entry.Object.Get();
+        if (AssetPaths.Contains(Entry.Path) || (Object && AssetPaths.Contains(FSoftObjectPath(Object))))
+        {
+            AssetIdsToRemove.Add(Id);
+        }
+    }
+
+    auto Removed{ 0 };
+    if (!AssetIdsToRemove.IsEmpty())
+    {
+        // Compact the columns in place, retaining the relative order of the remaining messages
+        auto Target{ 0 };
+        for (auto Index = 0; Index < Num(); ++Index)
+        {
+            if (AssetIdsToRemove.Contains(AssetIds[Index]))
+            {
+                Groups[GroupIds[Index]].Count--;
+                // ReSharper disable once CppTooWideScopeInitStatement
+                const auto SeverityIndex = static_cast<int32>(Severities[Index]);
+                if (SeverityIndex >= 0 && SeverityIndex < SeverityCount)
+                {
+                    SeverityCounts[SeverityIndex]--;
+                }
+                Removed++;
+            }
+            else
+            {
+                if (Target != Index)
+                {
+                    AssetIds[Target] = AssetIds[Index];
+                    RuleSetIds[Target] = RuleSetIds[Index];
+                    RuleIds[Target] = RuleIds[Index];
+                    TemplateIds[Target] = TemplateIds[Index];
+                    GroupIds[Target] = GroupIds[Index];
+                    Severities[Target] = Severities[Index];
+                }
+                Target++;
+            }
+        }
+
+        if (Removed > 0)
+        {
+            AssetIds.SetNum(Target);
+            RuleSetIds.SetNum(Target);
+            RuleIds.SetNum(Target);
+            TemplateIds.SetNum(Target);
+            GroupIds.SetNum(Target);
+            Severities.SetNum(Target);
+            RemovalRevision++;
+        }
+    }
+    return Removed;
+}
+
+int32 FRuleRangerRunStore::GetSeverityCount(const ERuleRangerToolSeverity Severity) const
+{
+    const auto SeverityIndex = static_cast<int32>(Severity);
+    return SeverityIndex >= 0 && SeverityIndex < SeverityCount ? SeverityCounts[SeverityIndex] : 0;
+}
+
+FString FRuleRangerRunStore::GetMessage(const int32 Index) const
+{
+    const auto& Template = Templates[TemplateIds[Index]];
+    if (Template.bHasAssetPlaceholder)
+    {
+        const TCHAR Placeholder[]{ AssetPlaceholder, TEXT('\0') };
+        return Template.Text.Replace(Placeholder, *GetAssetName(Index), ESearchCase::CaseSensitive);
+    }
+    else
+    {
+        return Template.Text;
+    }
+}
+
+TSharedPtr<FRuleRangerMessageRow> FRuleRangerRunStore::GetRow(const int32 Index) const
+{
+    const auto Rule = Objects[RuleIds[Index]].Object.Get();
+
+    auto Row = MakeShared<FRuleRangerMessageRow>();
+    Row->Asset = Objects[AssetIds[Index]].Object;
+    Row->RuleSet = Cast<URuleRangerRuleSet>(Objects[RuleSetIds[Index]].Object.Get());
+    Row->Rule = Cast<URuleRangerRule>(Rule);
+    Row->ProjectRule = Cast<URuleRangerProjectRule>(Rule);
+    Row->Severity = Severities[Index];
+    Row->Text = FText::FromString(GetMessage(Index));
+    return Row;
+}
+
+FString FRuleRangerRunStore::GetGroupLabel(const int32 GroupId) const
+{
+    const auto& Template = Templates[Groups[GroupId].TemplateId];
+    if (Template.bHasAssetPlaceholder)
+    {
+        const TCHAR Placeholder[]{ AssetPlaceholder, TEXT('\0') };
+        return Template.Text.Replace(Placeholder, TEXT("<Asset>"), ESearchCase::CaseSensitive);
+    }
+    else
+    {
+        return Template.Text;
+    }
+}
+
+int32 FRuleRangerRunStore::InternObject(const UObject* Object)
+{
+    if (!Object)
+    {
+        return 0;
+    }
+    else if (const auto ExistingId = ObjectIndex.Find(FObjectKey(Object)))
+    {
+        return *ExistingId;
+    }
+    else
+    {
+        const auto Id = Objects.Add({ Object, Object->GetName(), FSoftObjectPath(Object) });
+        ObjectIndex.Add(FObjectKey(Object), Id);
+        return Id;
+    }
+}
+
+int32 FRuleRangerRunStore::InternTemplate(const FString& Text, const FString& AssetName)
+{
+    FTemplateEntry Template;
+    const TCHAR Placeholder[]{ AssetPlaceholder, TEXT('\0') };
+    if (AssetName.Len() >= MinAssetNameLengthForPlaceholder && !Text.Contains(Placeholder)
+        && Text.Contains(AssetName, ESearchCase::CaseSensitive))
+    {
+        Template.Text = Text.Replace(*AssetName, Placeholder, ESearchCase::CaseSensitive);
+        Template.bHasAssetPlaceholder = true;
+    }
+    else
+    {
+        Template.Text = Text;
+    }
+
+    if (!Template.bHasAssetPlaceholder && Text.Contains(Placeholder))
+    {
+        // The text already contains the placeholder so it must not share a template with a text that uses it
+        return Templates.Add(Template);
+    }
+    else if (const auto ExistingId = TemplateIndex.Find(Template.Text))
+    {
+        return *ExistingId;
+    }
+    else
+    {
+        const auto Id = Templates.Add(Template);
+        TemplateIndex.Add(Template.Text, Id);
+        return Id;
+    }
+}
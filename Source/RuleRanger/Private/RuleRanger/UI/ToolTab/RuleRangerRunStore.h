@@ -0,0 +1,183 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/SoftObjectPath.h"
+
+class URuleRangerProjectRule;
+class URuleRangerRule;
+class URuleRangerRuleSet;
+enum class ERuleRangerToolSeverity : uint8;
+struct FRuleRangerMessageRow;
+
+/**
+ * Compact storage for the messages produced by a run.
+ *
+ * Messages are stored in columns rather than as individual rows. The assets, rules and rule sets referenced by
+ * messages are interned, as is the message text. The name of the asset is replaced by a placeholder before the
+ * text is interned so that the same message reported against many assets shares a single template. Messages
+ * are also grouped by (rule, template) so that a view can present one entry per distinct problem.
+ *
+ * Rows are only materialized when requested via GetRow().
+ */
+class FRuleRangerRunStore
+{
+public:
+    /** Add a message to the store. */
+    void Add(const UObject* Asset,
+             const URuleRangerRuleSet* RuleSet,
+             const URuleRangerRule* Rule,
+             const URuleRangerProjectRule* ProjectRule,
+             ERuleRangerToolSeverity Severity,
+             const FText& Text);
+
+    /** Add a message described by a row to the store. */
+    void Add(const FRuleRangerMessageRow& Row);
+
+    void Reset();
+
+    /**
+     * Remove the messages reported against the specified assets.
+     * An asset matches if the path it had when first reported, or the path of the asset if it is still loaded,
+     * is one of the specified paths. This matches assets that have since been unloaded or renamed.
+     * Interned ids and group ids are retained so that a view can keep its keys and expanded groups.
+     *
+     * @param AssetPaths the paths of the assets whose messages are removed.
+     * @return the number of messages removed.
+     */
+    int32 RemoveAssets(const TSet<FSoftObjectPath>& AssetPaths);
+
+    /** Return a value that changes whenever messages are removed, so that views know to rebuild their indexes. */
+    FORCEINLINE uint32 GetRemovalRevision() const { return RemovalRevision; }
+
+    FORCEINLINE int32 Num() const { return Severities.Num(); }
+    FORCEINLINE bool IsEmpty() const { return Severities.IsEmpty(); }
+
+    FORCEINLINE ERuleRangerToolSeverity GetSeverity(const int32 Index) const { return Severities[Index]; }
+
+    /** Return the number of messages with the specified severity. */
+    int32 GetSeverityCount(ERuleRangerToolSeverity Severity) const;
+
+    /** The character that stands in for the asset name within a template. */
+    static constexpr TCHAR AssetPlaceholder{ 0xE000 };
+
+    /**
+     * Return the ids of the interned objects and template referenced by the message.
+     * Ids are stable for the lifetime of the store and the id 0 represents no object.
+     */
+    FORCEINLINE int32 GetAssetId(const int32 Index) const { return AssetIds[Index]; }
+    FORCEINLINE int32 GetRuleId(const int32 Index) const { return RuleIds[Index]; }
+    FORCEINLINE int32 GetRuleSetId(const int32 Index) const { return RuleSetIds[Index]; }
+    FORCEINLINE int32 GetTemplateId(const int32 Index) const { return TemplateIds[Index]; }
+
+    FORCEINLINE int32 GetObjectCount() const { return Objects.Num(); }
+    FORCEINLINE const FString& GetObjectName(const int32 ObjectId) const { return Objects[ObjectId].Name; }
+
+    FORCEINLINE int32 GetTemplateCount() const { return Templates.Num(); }
+    FORCEINLINE const FString& GetTemplateText(const int32 TemplateId) const { return Templates[TemplateId].Text; }
+
+    /** Return true if the asset name was replaced by AssetPlaceholder within the template. */
+    FORCEINLINE bool HasAssetPlaceholder(const int32 TemplateId) const
+    {
+        return Templates[TemplateId].bHasAssetPlaceholder;
+    }
+
+    /** Return the names of the objects referenced by the message, as captured when the message was added. */
+    FORCEINLINE const FString& GetAssetName(const int32 Index) const { return Objects[AssetIds[Index]].Name; }
+    FORCEINLINE const FString& GetRuleName(const int32 Index) const { return Objects[RuleIds[Index]].Name; }
+    FORCEINLINE const FString& GetRuleSetName(const int32 Index) const { return Objects[RuleSetIds[Index]].Name; }
+
+    /** Return the text of the message. */
+    FString GetMessage(int32 Index) const;
+
+    /** Materialize the message as a row. */
+    TSharedPtr<FRuleRangerMessageRow> GetRow(int32 Index) const;
+
+    /** Return the id of the (rule, template) group that the message belongs to. */
+    FORCEINLINE int32 GetGroupId(const int32 Index) const { return GroupIds[Index]; }
+    FORCEINLINE int32 GetGroupCount() const { return Groups.Num(); }
+
+    /** Return the number of messages in the group. */
+    FORCEINLINE int32 GetGroupSize(const int32 GroupId) const { return Groups[GroupId].Count; }
+
+    /** Return the name of the rule that produced the messages in the group. */
+    FORCEINLINE const FString& GetGroupRuleName(const int32 GroupId) const
+    {
+        return Objects[Groups[GroupId].RuleId].Name;
+    }
+
+    /** Return the message template of the group with the asset name replaced by a readable placeholder. */
+    FString GetGroupLabel(int32 GroupId) const;
+
+private:
+    struct FObjectEntry
+    {
+        TWeakObjectPtr<const UObject> Object;
+        FString Name;
+        FSoftObjectPath Path;
+    };
+
+    struct FTemplateEntry
+    {
+        FString Text;
+
+        /** True if the asset name was replaced by the placeholder. */
+        bool bHasAssetPlaceholder{ false };
+    };
+
+    struct FGroupEntry
+    {
+        int32 RuleId{ 0 };
+        int32 TemplateId{ 0 };
+        int32 Count{ 0 };
+    };
+
+    /** Interned objects. The entry at index 0 represents no object. */
+    TArray<FObjectEntry> Objects{ FObjectEntry() };
+    TMap<FObjectKey, int32> ObjectIndex;
+
+    /** Templates are matched case-sensitively as the default FString key functions ignore case. */
+    struct FTemplateKeyFuncs : TDefaultMapKeyFuncs<FString, int32, false>
+    {
+        static FORCEINLINE bool Matches(KeyInitType A, KeyInitType B)
+        {
+            return A.Equals(B, ESearchCase::CaseSensitive);
+        }
+        static FORCEINLINE uint32 GetKeyHash(KeyInitType Key) { return FCrc::StrCrc32(*Key); }
+    };
+
+    TArray<FTemplateEntry> Templates;
+    TMap<FString, int32, FDefaultSetAllocator, FTemplateKeyFuncs> TemplateIndex;
+
+    TArray<FGroupEntry> Groups;
+    TMap<TPair<int32, int32>, int32> GroupIndex;
+
+    // One element per message
+    TArray<int32> AssetIds;
+    TArray<int32> RuleSetIds;
+    TArray<int32> RuleIds;
+    TArray<int32> TemplateIds;
+    TArray<int32> GroupIds;
+    TArray<ERuleRangerToolSeverity> Severities;
+
+    static constexpr int32 SeverityCount{ 3 };
+    int32 SeverityCounts[SeverityCount]{ 0, 0, 0 };
+
+    uint32 RemovalRevision{ 0 };
+
+    int32 InternObject(const UObject* Object);
+    int32 InternTemplate(const FString& Text, const FString& AssetName);
+};
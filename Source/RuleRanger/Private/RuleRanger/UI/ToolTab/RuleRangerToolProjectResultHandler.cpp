@@ -32,14 +32,7 @@ static void AppendMessages(const TSharedPtr<FRuleRangerRun>& Run,
 {
     for (const auto& Message : InMessages)
     {
-        auto Row = MakeShared<FRuleRangerMessageRow>();
-        Row->Asset = nullptr;
-        Row->RuleSet = RuleSet;
-        Row->Rule = nullptr;
-        Row->ProjectRule = ProjectRule;
-        Row->Severity = Severity;
-        Row->Text = Message;
-        Run->Messages.Add(Row);
+        Run->Messages.Add(nullptr, RuleSet, nullptr, ProjectRule, Severity, Message);
     }
 }
 
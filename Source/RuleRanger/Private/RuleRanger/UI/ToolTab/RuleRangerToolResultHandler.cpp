@@ -33,14 +33,7 @@ static void AppendMessages(const TSharedPtr<FRuleRangerRun>& Run,
 {
     for (const auto& Message : InMessages)
     {
-        auto Row = MakeShared<FRuleRangerMessageRow>();
-        Row->Asset = Asset;
-        Row->RuleSet = RuleSet;
-        Row->Rule = Rule;
-        Row->ProjectRule = nullptr;
-        Row->Severity = Severity;
-        Row->Text = Message;
-        Run->Messages.Add(Row);
+        Run->Messages.Add(Asset, RuleSet, Rule, nullptr, Severity, Message);
     }
 }
 
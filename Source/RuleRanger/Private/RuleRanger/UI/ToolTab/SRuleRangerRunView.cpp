@@ -12,31 +12,111 @@
  * limitations under the License.
  */
 #include "RuleRanger/UI/ToolTab/SRuleRangerRunView.h"
+#include "Algo/StableSort.h"
 #include "ContentBrowserModule.h"
 #include "Editor.h"
+#include "Framework/Application/SlateApplication.h"
 #include "HAL/PlatformApplicationMisc.h"
 #include "HAL/PlatformMisc.h"
 #include "IContentBrowserSingleton.h"
 #include "Misc/ConfigCacheIni.h"
+#include "Logging/StructuredLog.h"
 #include "Modules/ModuleManager.h"
+#include "RuleRanger/RuleRangerExplainTrace.h"
+#include "RuleRanger/UI/RuleRangerEditorSubsystem.h"
+#include "RuleRanger/UI/ToolTab/RuleRangerToolResultHandler.h"
 #include "RuleRanger/UI/ToolTab/SRuleRangerRunRow.h"
 #include "RuleRanger/UI/ToolTab/SRuleRangerToolPanel.h"
 // ReSharper disable 3 CppUnusedIncludeDirective
 #include "RuleRanger/UI/RuleRangerStyle.h"
 #include "RuleRanger/UI/RuleRangerUIHelpers.h"
+#include "RuleRangerLogging.h"
 #include "RuleRangerProjectRule.h"
 #include "RuleRangerRule.h"
 #include "RuleRangerRuleSet.h"
 #include "Styling/AppStyle.h"
 #include "Subsystems/AssetEditorSubsystem.h"
+#include "Widgets/Images/SImage.h"
+#include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SMultiLineEditableTextBox.h"
 #include "Widgets/Input/SSearchBox.h"
 #include "Widgets/Layout/SBorder.h"
+#include "Widgets/Layout/SWidgetSwitcher.h"
 #include "Widgets/SBoxPanel.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Views/SHeaderRow.h"
 #include "Widgets/Views/SListView.h"
 #include "Widgets/Views/STableRow.h"
+#include "Widgets/Views/STreeView.h"
+
+namespace
+{
+    enum class ESortColumn : uint8
+    {
+        Severity,
+        Asset,
+        Rule,
+        RuleSet,
+        Message
+    };
+
+    constexpr ESortColumn SortColumnTieBreakOrder[] = { ESortColumn::Severity,
+                                                        ESortColumn::Asset,
+                                                        ESortColumn::Rule,
+                                                        ESortColumn::RuleSet,
+                                                        ESortColumn::Message };
+
+    ESortColumn GetSortColumn(const FName& ColumnId)
+    {
+        if (TEXT("Message") == ColumnId)
+        {
+            return ESortColumn::Message;
+        }
+        else if (TEXT("Asset") == ColumnId)
+        {
+            return ESortColumn::Asset;
+        }
+        else if (TEXT("Rule") == ColumnId)
+        {
+            return ESortColumn::Rule;
+        }
+        else if (TEXT("RuleSet") == ColumnId)
+        {
+            return ESortColumn::RuleSet;
+        }
+        else
+        {
+            return ESortColumn::Severity;
+        }
+    }
+
+    int32 GetSeverityRank(const ERuleRangerToolSeverity Severity)
+    {
+        switch (Severity)
+        {
+            case ERuleRangerToolSeverity::Error:
+                return 2;
+            case ERuleRangerToolSeverity::Warning:
+                return 1;
+            default:
+                return 0;
+        }
+    }
+
+    // Compare lowercase names, placing missing names after any name
+    int32 CompareNames(const FString& Left, const FString& Right)
+    {
+        if (Left.IsEmpty() != Right.IsEmpty())
+        {
+            return Left.IsEmpty() ? 1 : -1;
+        }
+        else
+        {
+            return Left.Compare(Right, ESearchCase::CaseSensitive);
+        }
+    }
+} // namespace
 
 void SRuleRangerRunView::Construct(const FArguments& InArgs)
 {
@@ -77,6 +157,13 @@ void SRuleRangerRunView::Construct(const FArguments& InArgs)
                                     .SortMode(this, &SRuleRangerRunView::GetRuleSortMode)
                                     .OnSort(this, &SRuleRangerRunView::OnColumnSortModeChanged));
 
+    GroupView = SNew(STreeView<TSharedPtr<FRuleRangerRunGroupItem>>)
+                    .TreeItemsSource(&GroupItems)
+                    .OnGenerateRow(this, &SRuleRangerRunView::OnGenerateGroupRow)
+                    .OnGetChildren(this, &SRuleRangerRunView::OnGetGroupChildren)
+                    .OnMouseButtonDoubleClick(this, &SRuleRangerRunView::OnGroupDoubleClick)
+                    .OnContextMenuOpening(this, &SRuleRangerRunView::OnContextMenuOpening)
+                    .SelectionMode(ESelectionMode::Multi);
     // Apply initial column visibility
     if (Header.IsValid())
     {
@@ -123,11 +210,23 @@ void SRuleRangerRunView::Construct(const FArguments& InArgs)
                                                     [RuleRangerUI::MakeIconLabelFromBrush(
                                                         FRuleRangerStyle::GetNoteMessageBrush(),
                                                         NSLOCTEXT("RuleRanger", "FilterInfo", "Info"))]]
+                         + SHorizontalBox::Slot()
+                               .AutoWidth()
+                               .VAlign(VAlign_Center)
+                               .Padding(FMargin(12, 0, 12, 0))
+                                   [SNew(SCheckBox)
+                                        .IsChecked(this, &SRuleRangerRunView::GetGroupByRuleState)
+                                        .OnCheckStateChanged(this, &SRuleRangerRunView::OnToggleGroupByRule)
+                                        .ToolTipText(NSLOCTEXT("RuleRanger",
+                                                               "GroupByRuleTooltip",
+                                                               "Group messages by rule and message"))
+                                            [SNew(STextBlock).Text(NSLOCTEXT("RuleRanger", "GroupByRule", "Group"))]]
                          + SHorizontalBox::Slot().FillWidth(1.f).VAlign(VAlign_Center)
                                [SNew(SSearchBox)
                                     .HintText(
                                         NSLOCTEXT("RuleRanger", "SearchHint", "Search message, asset, rule, ruleset"))
-                                    .OnTextChanged(this, &SRuleRangerRunView::OnSearchChanged)]
+                                    .OnTextChanged(this, &SRuleRangerRunView::OnSearchChanged)
+                                    .OnTextCommitted(this, &SRuleRangerRunView::OnSearchCommitted)]
                          + SHorizontalBox::Slot()
                                .AutoWidth()
                                .VAlign(VAlign_Center)
@@ -139,7 +238,10 @@ void SRuleRangerRunView::Construct(const FArguments& InArgs)
                                         .OnGetMenuContent(this, &SRuleRangerRunView::BuildColumnsMenu)
                                         .ButtonContent()[SNew(STextBlock)
                                                              .Text(NSLOCTEXT("RuleRanger", "Columns", "Columns"))]]]
-              + SVerticalBox::Slot().FillHeight(1.f).Padding(FMargin(0, 4, 0, 0))[ListView.ToSharedRef()]]];
+              + SVerticalBox::Slot().FillHeight(1.f).Padding(FMargin(0, 4, 0, 0))
+                    [SNew(SWidgetSwitcher).WidgetIndex_Lambda([this] { return bGroupByRule ? 1 : 0; })
+                     + SWidgetSwitcher::Slot()[ListView.ToSharedRef()]
+                     + SWidgetSwitcher::Slot()[GroupView.ToSharedRef()]]]];
 }
 
 // ReSharper disable once CppMemberFunctionMayBeStatic
@@ -150,109 +252,449 @@ TSharedRef<ITableRow> SRuleRangerRunView::OnGenerateRow(TSharedPtr<FRuleRangerMe
     return SNew(SRuleRangerRunRow, OwnerTable).Item(InItem).ListView(ListView);
 }
 
+void SRuleRangerRunView::IndexNewMessages()
+{
+    if (!Run.IsValid() || Run->Messages.Num() < IndexedCount)
+    {
+        // The messages were replaced so the index must be rebuilt
+        IndexedCount = 0;
+        LowerObjectNames.Reset();
+        LowerTemplates.Reset();
+        for (auto& Indices : SeverityIndices)
+        {
+            Indices.Reset();
+        }
+        MaterializedRows.Reset();
+        MatchedIndexedCount = 0;
+        MatchedIndices.Reset();
+        ExpandedGroupIds.Reset();
+    }
+    else if (Run->Messages.GetRemovalRevision() != IndexedRemovalRevision)
+    {
+        // Messages were removed so message indices moved but interned ids and group ids are unchanged
+        IndexedCount = 0;
+        for (auto& Indices : SeverityIndices)
+        {
+            Indices.Reset();
+        }
+        MaterializedRows.Reset();
+        MatchedIndexedCount = 0;
+        MatchedIndices.Reset();
+    }
+
+    if (Run.IsValid())
+    {
+        IndexedRemovalRevision = Run->Messages.GetRemovalRevision();
+
+        // Keys are computed once per interned entry so that searching and sorting never resolve object names
+        const auto& Messages = Run->Messages;
+        for (auto Id = LowerObjectNames.Num(); Id < Messages.GetObjectCount(); ++Id)
+        {
+            LowerObjectNames.Add(Messages.GetObjectName(Id).ToLower());
+        }
+        for (auto Id = LowerTemplates.Num(); Id < Messages.GetTemplateCount(); ++Id)
+        {
+            LowerTemplates.Add(Messages.GetTemplateText(Id).ToLower());
+        }
+
+        MaterializedRows.SetNum(Messages.Num());
+        for (; IndexedCount < Messages.Num(); ++IndexedCount)
+        {
+            // ReSharper disable once CppTooWideScopeInitStatement
+            const auto SeverityIndex = static_cast<int32>(Messages.GetSeverity(IndexedCount));
+            if (SeverityIndex >= 0 && SeverityIndex < SeverityCount)
+            {
+                SeverityIndices[SeverityIndex].Add(IndexedCount);
+            }
+        }
+    }
+}
+
+bool SRuleRangerRunView::MatchesQuery(const int32 Index, const FString& LowerQuery)
+{
+    const auto& Messages = Run->Messages;
+    if (LowerQuery.IsEmpty())
+    {
+        return true;
+    }
+    else if (LowerObjectNames[Messages.GetAssetId(Index)].Contains(LowerQuery, ESearchCase::CaseSensitive)
+             || LowerObjectNames[Messages.GetRuleId(Index)].Contains(LowerQuery, ESearchCase::CaseSensitive)
+             || LowerObjectNames[Messages.GetRuleSetId(Index)].Contains(LowerQuery, ESearchCase::CaseSensitive))
+    {
+        return true;
+    }
+    else if (const auto TemplateId = Messages.GetTemplateId(Index); !Messages.HasAssetPlaceholder(TemplateId))
+    {
+        return LowerTemplates[TemplateId].Contains(LowerQuery, ESearchCase::CaseSensitive);
+    }
+    else
+    {
+        // The query may span the asset name within the message so the message is reconstructed
+        GetLowerMessage(Index, MessageBuffer);
+        return MessageBuffer.Contains(LowerQuery, ESearchCase::CaseSensitive);
+    }
+}
+
+void SRuleRangerRunView::GetLowerMessage(const int32 Index, FString& OutMessage) const
+{
+    const auto& Messages = Run->Messages;
+    const auto TemplateId = Messages.GetTemplateId(Index);
+    OutMessage = LowerTemplates[TemplateId];
+    if (Messages.HasAssetPlaceholder(TemplateId))
+    {
+        const TCHAR Placeholder[]{ FRuleRangerRunStore::AssetPlaceholder, TEXT('\0') };
+        OutMessage.ReplaceInline(Placeholder,
+                                 *LowerObjectNames[Messages.GetAssetId(Index)],
+                                 ESearchCase::CaseSensitive);
+    }
+}
+
+TSharedPtr<FRuleRangerMessageRow> SRuleRangerRunView::GetRow(const int32 Index)
+{
+    auto& Row = MaterializedRows[Index];
+    if (!Row.IsValid())
+    {
+        Row = Run->Messages.GetRow(Index);
+    }
+    return Row;
+}
+
+uint8 SRuleRangerRunView::GetSeverityMask() const
+{
+    return (bShowInfo ? 1 << static_cast<int32>(ERuleRangerToolSeverity::Info) : 0)
+        | (bShowWarning ? 1 << static_cast<int32>(ERuleRangerToolSeverity::Warning) : 0)
+        | (bShowError ? 1 << static_cast<int32>(ERuleRangerToolSeverity::Error) : 0);
+}
+
 void SRuleRangerRunView::RebuildFiltered()
 {
     FilteredItems.Reset();
+    GroupItems.Reset();
+    IndexNewMessages();
     if (Run.IsValid())
     {
-        const bool bHasQuery = !SearchQuery.IsEmpty();
-        for (const auto& Message : Run->Messages)
+        const auto Query = SearchQuery.ToLower();
+        const auto SeverityMask = GetSeverityMask();
+
+        if (SeverityMask == MatchedSeverityMask && Query.Contains(MatchedQuery, ESearchCase::CaseSensitive)
+            && MatchedIndexedCount > 0)
         {
-            if (ERuleRangerToolSeverity::Error == Message->Severity && bShowError
-                || ERuleRangerToolSeverity::Warning == Message->Severity && bShowWarning
-                || ERuleRangerToolSeverity::Info == Message->Severity && bShowInfo)
+            // The query was extended (or is unchanged) so only the previous matches can match, along with any
+            // messages that arrived since the previous matches were computed
+            if (Query != MatchedQuery)
             {
-                bool bMatches = true;
-                if (bHasQuery)
+                MatchedIndices.RemoveAll([this, &Query](const int32 Index) { return !MatchesQuery(Index, Query); });
+            }
+            for (auto Index = MatchedIndexedCount; Index < IndexedCount; ++Index)
+            {
+                // ReSharper disable once CppTooWideScopeInitStatement
+                const auto SeverityBit = 1 << static_cast<int32>(Run->Messages.GetSeverity(Index));
+                if ((SeverityMask & SeverityBit) && MatchesQuery(Index, Query))
                 {
-                    bMatches = false;
-                    const FString Q = SearchQuery;
-                    const FString Msg = Message->Text.ToString();
-                    const FString AssetName = Message->Asset.IsValid() ? Message->Asset->GetName() : FString();
-                    const FString RuleName = Message->Rule.IsValid()
-                        ? Message->Rule->GetName()
-                        : (Message->ProjectRule.IsValid() ? Message->ProjectRule->GetName() : FString());
-                    const FString RuleSetName = Message->RuleSet.IsValid() ? Message->RuleSet->GetName() : FString();
-
-                    if (Msg.Contains(Q, ESearchCase::IgnoreCase) || AssetName.Contains(Q, ESearchCase::IgnoreCase)
-                        || RuleName.Contains(Q, ESearchCase::IgnoreCase)
-                        || RuleSetName.Contains(Q, ESearchCase::IgnoreCase))
-                    {
-                        bMatches = true;
-                    }
+                    MatchedIndices.Add(Index);
                 }
-
-                if (bMatches)
+            }
+        }
+        else
+        {
+            MatchedIndices.Reset();
+            for (auto SeverityIndex = 0; SeverityIndex < SeverityCount; ++SeverityIndex)
+            {
+                if (SeverityMask & (1 << SeverityIndex))
                 {
-                    FilteredItems.Add(Message);
+                    for (const auto Index : SeverityIndices[SeverityIndex])
+                    {
+                        if (MatchesQuery(Index, Query))
+                        {
+                            MatchedIndices.Add(Index);
+                        }
+                    }
                 }
             }
+            // Restore message order as the matches were collected one severity at a time
+            MatchedIndices.Sort();
         }
+        MatchedQuery = Query;
+        MatchedSeverityMask = SeverityMask;
+        MatchedIndexedCount = IndexedCount;
+
         SortFiltered();
     }
 }
 
-void SRuleRangerRunView::SortFiltered()
+void SRuleRangerRunView::OnSearchChanged(const FText& NewText)
+{
+    // Debounce the search so that the filter is applied once rather than on every keystroke
+    PendingSearchQuery = NewText.ToString();
+    if (SearchTimerHandle.IsValid())
+    {
+        UnRegisterActiveTimer(SearchTimerHandle.ToSharedRef());
+    }
+    SearchTimerHandle =
+        RegisterActiveTimer(0.15f, FWidgetActiveTimerDelegate::CreateSP(this, &SRuleRangerRunView::ApplyPendingSearch));
+}
+
+void SRuleRangerRunView::OnSearchCommitted(const FText& NewText, ETextCommit::Type)
 {
-    auto CmpText = [](const auto& Left, const auto& Right) {
-        return FCString::Stricmp(*Left.ToString(), *Right.ToString()) < 0;
+    if (SearchTimerHandle.IsValid())
+    {
+        UnRegisterActiveTimer(SearchTimerHandle.ToSharedRef());
+    }
+    PendingSearchQuery = NewText.ToString();
+    ApplyPendingSearch(0.0, 0.f);
+}
+
+EActiveTimerReturnType SRuleRangerRunView::ApplyPendingSearch(double, float)
+{
+    SearchTimerHandle.Reset();
+    if (PendingSearchQuery != SearchQuery)
+    {
+        SearchQuery = PendingSearchQuery;
+        RebuildFiltered();
+    }
+    return EActiveTimerReturnType::Stop;
+}
+
+TArray<int32> SRuleRangerRunView::GetSortedMatchedIndices() const
+{
+    const auto& Messages = Run->Messages;
+    const auto Primary = GetSortColumn(SortColumnId);
+    const bool bAscending = EColumnSortMode::Descending != SortMode;
+
+    // Messages share templates so exact message keys are only built when sorting by the message column.
+    // Otherwise, ties are broken by comparing the templates and then the asset names.
+    TMap<int32, FString> MessageKeys;
+    if (ESortColumn::Message == Primary)
+    {
+        MessageKeys.Reserve(MatchedIndices.Num());
+        for (const auto Index : MatchedIndices)
+        {
+            GetLowerMessage(Index, MessageKeys.Add(Index));
+        }
+    }
+
+    const auto CompareColumn = [&](const ESortColumn Column, const int32 Left, const int32 Right) {
+        switch (Column)
+        {
+            case ESortColumn::Asset:
+                return CompareNames(LowerObjectNames[Messages.GetAssetId(Left)],
+                                    LowerObjectNames[Messages.GetAssetId(Right)]);
+            case ESortColumn::Rule:
+                return CompareNames(LowerObjectNames[Messages.GetRuleId(Left)],
+                                    LowerObjectNames[Messages.GetRuleId(Right)]);
+            case ESortColumn::RuleSet:
+                return CompareNames(LowerObjectNames[Messages.GetRuleSetId(Left)],
+                                    LowerObjectNames[Messages.GetRuleSetId(Right)]);
+            case ESortColumn::Message:
+                if (!MessageKeys.IsEmpty())
+                {
+                    return MessageKeys[Left].Compare(MessageKeys[Right], ESearchCase::CaseSensitive);
+                }
+                else if (const auto Result = LowerTemplates[Messages.GetTemplateId(Left)].Compare(
+                             LowerTemplates[Messages.GetTemplateId(Right)],
+                             ESearchCase::CaseSensitive);
+                         0 != Result)
+                {
+                    return Result;
+                }
+                else
+                {
+                    return CompareNames(LowerObjectNames[Messages.GetAssetId(Left)],
+                                        LowerObjectNames[Messages.GetAssetId(Right)]);
+                }
+            case ESortColumn::Severity:
+            default:
+                return GetSeverityRank(Messages.GetSeverity(Left)) - GetSeverityRank(Messages.GetSeverity(Right));
+        }
     };
 
-    FilteredItems.Sort([&](const auto& Left, const auto& Right) {
-        const bool bAsc = EColumnSortMode::Descending != SortMode;
-        const auto SevRank = [](const ERuleRangerToolSeverity S) {
-            switch (S)
+    // Sort the indices of the matched messages using the precomputed keys. The sort is stable and MatchedIndices
+    // is in message order, so rows that compare equal on every key remain in the order that they were reported.
+    auto SortedIndices{ MatchedIndices };
+    Algo::StableSort(SortedIndices, [&](const int32 Left, const int32 Right) {
+        if (const auto Result = CompareColumn(Primary, Left, Right); 0 != Result)
+        {
+            return bAscending ? Result < 0 : Result > 0;
+        }
+        else
+        {
+            for (const auto Column : SortColumnTieBreakOrder)
             {
-                case ERuleRangerToolSeverity::Error:
-                    return 2;
-                case ERuleRangerToolSeverity::Warning:
-                    return 1;
-                default:
-                    return 0;
+                // Ties are broken with the most severe first and then alphabetically
+                // ReSharper disable once CppTooWideScopeInitStatement
+                const auto TieBreak = Column == Primary ? 0 : CompareColumn(Column, Left, Right);
+                if (0 != TieBreak)
+                {
+                    return ESortColumn::Severity == Column ? TieBreak > 0 : TieBreak < 0;
+                }
             }
-        };
-
-        auto Less = [&](const bool Cond) { return bAsc ? Cond : !Cond; };
+            return false;
+        }
+    });
+    return SortedIndices;
+}
 
-        if (TEXT("Severity") == SortColumnId)
+void SRuleRangerRunView::SortFiltered()
+{
+    const auto SortedIndices = Run.IsValid() ? GetSortedMatchedIndices() : TArray<int32>();
+    FilteredItems.Reset();
+    if (bGroupByRule)
+    {
+        RebuildGroups(SortedIndices);
+    }
+    else
+    {
+        // Rows are only materialized for the flat view as the grouped view materializes rows on expansion
+        GroupItems.Reset();
+        FilteredItems.Reserve(SortedIndices.Num());
+        for (const auto Index : SortedIndices)
         {
-            return Less(SevRank(Left->Severity) < SevRank(Right->Severity));
+            FilteredItems.Add(GetRow(Index));
         }
-        else if (TEXT("Message") == SortColumnId)
+    }
+
+    if (ListView.IsValid())
+    {
+        ListView->RequestListRefresh();
+    }
+    if (GroupView.IsValid())
+    {
+        GroupView->RequestTreeRefresh();
+    }
+}
+
+void SRuleRangerRunView::RebuildGroups(const TArray<int32>& SortedIndices)
+{
+    // Groups are ordered by their first message so that the order of groups follows the selected sort
+    GroupItems.Reset();
+    TMap<int32, TSharedPtr<FRuleRangerRunGroupItem>> Groups;
+    for (const auto Index : SortedIndices)
+    {
+        const auto GroupId = Run->Messages.GetGroupId(Index);
+        auto& Group = Groups.FindOrAdd(GroupId);
+        if (!Group.IsValid())
         {
-            return Less(CmpText(Left->Text, Right->Text));
+            Group = MakeShared<FRuleRangerRunGroupItem>();
+            Group->GroupId = GroupId;
+            GroupItems.Add(Group);
         }
-        else if (TEXT("Asset") == SortColumnId)
+        Group->MessageIndices.Add(Index);
+    }
+
+    if (GroupView.IsValid())
+    {
+        for (const auto& Group : GroupItems)
         {
-            const auto LeftName = Left->Asset.IsValid() ? Left->Asset->GetName() : FString("~");
-            const auto RightName = Right->Asset.IsValid() ? Right->Asset->GetName() : FString("~");
-            return Less(FCString::Stricmp(*LeftName, *RightName) < 0);
+            if (ExpandedGroupIds.Contains(Group->GroupId))
+            {
+                GroupView->SetItemExpansion(Group, true);
+            }
         }
-        else if (TEXT("Rule") == SortColumnId)
+    }
+}
+
+void SRuleRangerRunView::OnGetGroupChildren(TSharedPtr<FRuleRangerRunGroupItem> InItem,
+                                            TArray<TSharedPtr<FRuleRangerRunGroupItem>>& OutChildren)
+{
+    // Message entries are only created once a group is expanded. The expander is drawn by the group row
+    // so that a collapsed group does not need its children to be created to show that it can be expanded.
+    if (InItem.IsValid() && INDEX_NONE == InItem->MessageIndex && ExpandedGroupIds.Contains(InItem->GroupId))
+    {
+        if (InItem->Children.IsEmpty())
         {
-            const auto LeftName = Left->Rule.IsValid() ? Left->Rule->GetName()
-                : Left->ProjectRule.IsValid()          ? Left->ProjectRule->GetName()
-                                                       : FString("~");
-            const auto RightName = Right->Rule.IsValid() ? Right->Rule->GetName()
-                : Right->ProjectRule.IsValid()           ? Right->ProjectRule->GetName()
-                                                         : FString("~");
-            return Less(FCString::Stricmp(*LeftName, *RightName) < 0);
+            InItem->Children.Reserve(InItem->MessageIndices.Num());
+            for (const auto Index : InItem->MessageIndices)
+            {
+                const auto Child = MakeShared<FRuleRangerRunGroupItem>();
+                Child->GroupId = InItem->GroupId;
+                Child->MessageIndex = Index;
+                InItem->Children.Add(Child);
+            }
         }
-        else if (TEXT("RuleSet") == SortColumnId)
+        OutChildren = InItem->Children;
+    }
+}
+
+void SRuleRangerRunView::ToggleGroupExpansion(const TSharedPtr<FRuleRangerRunGroupItem>& InItem)
+{
+    if (InItem.IsValid() && INDEX_NONE == InItem->MessageIndex)
+    {
+        const bool bExpand = !ExpandedGroupIds.Contains(InItem->GroupId);
+        if (bExpand)
         {
-            const auto LeftName = Left->RuleSet.IsValid() ? Left->RuleSet->GetName() : FString("~");
-            const auto RightName = Right->RuleSet.IsValid() ? Right->RuleSet->GetName() : FString("~");
-            return Less(FCString::Stricmp(*LeftName, *RightName) < 0);
+            ExpandedGroupIds.Add(InItem->GroupId);
         }
         else
         {
-            return Less(SevRank(Left->Severity) < SevRank(Right->Severity));
+            ExpandedGroupIds.Remove(InItem->GroupId);
         }
-    });
+        if (GroupView.IsValid())
+        {
+            GroupView->SetItemExpansion(InItem, bExpand);
+            GroupView->RequestTreeRefresh();
+        }
+    }
+}
 
-    if (ListView.IsValid())
+void SRuleRangerRunView::OnGroupDoubleClick(const TSharedPtr<FRuleRangerRunGroupItem> InItem)
+{
+    if (InItem.IsValid())
     {
-        ListView->RequestListRefresh();
+        if (INDEX_NONE == InItem->MessageIndex)
+        {
+            ToggleGroupExpansion(InItem);
+        }
+        else if (const auto Row = GetRow(InItem->MessageIndex); Row.IsValid() && Row->Asset.IsValid())
+        {
+            if (const auto Subsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
+            {
+                TArray<UObject*> ToOpen;
+                ToOpen.Add(const_cast<UObject*>(Row->Asset.Get()));
+                Subsystem->OpenEditorForAssets(ToOpen);
+            }
+        }
+    }
+}
+
+// ReSharper disable once CppPassValueParameterByConstReference
+TSharedRef<ITableRow> SRuleRangerRunView::OnGenerateGroupRow(TSharedPtr<FRuleRangerRunGroupItem> InItem,
+                                                             const TSharedRef<STableViewBase>& OwnerTable)
+{
+    const auto& Messages = Run->Messages;
+    if (INDEX_NONE == InItem->MessageIndex)
+    {
+        const auto RuleName = Messages.GetGroupRuleName(InItem->GroupId);
+        const auto Label = FText::Format(NSLOCTEXT("RuleRanger", "GroupLabel", "{0}{1}{2} ({3})"),
+                                         FText::FromString(RuleName),
+                                         RuleName.IsEmpty() ? FText::GetEmpty() : FText::FromString(TEXT(": ")),
+                                         FText::FromString(Messages.GetGroupLabel(InItem->GroupId)),
+                                         FText::AsNumber(InItem->MessageIndices.Num()));
+        return SNew(STableRow<TSharedPtr<FRuleRangerRunGroupItem>>, OwnerTable)
+            .Padding(FMargin(0.f, 2.f))
+                [SNew(SHorizontalBox)
+                 + SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center)
+                       [SNew(SButton)
+                            .ButtonStyle(&FAppStyle::Get().GetWidgetStyle<FButtonStyle>(TEXT("SimpleButton")))
+                            .ContentPadding(FMargin(4.f, 0.f))
+                            .OnClicked_Lambda([this, InItem] {
+                                ToggleGroupExpansion(InItem);
+                                return FReply::Handled();
+                            })[SNew(SImage).Image_Lambda([this, GroupId = InItem->GroupId] {
+                                return FAppStyle::Get().GetBrush(ExpandedGroupIds.Contains(GroupId)
+                                                                     ? TEXT("TreeArrow_Expanded")
+                                                                     : TEXT("TreeArrow_Collapsed"));
+                            })]]
+                 + SHorizontalBox::Slot().FillWidth(1.f).VAlign(VAlign_Center).Padding(FMargin(4.f, 0.f))
+                       [SNew(STextBlock).Text(Label)]];
+    }
+    else
+    {
+        const auto Index = InItem->MessageIndex;
+        const auto& AssetName = Messages.GetAssetName(Index);
+        const auto Message = Messages.GetMessage(Index);
+        const auto Text = AssetName.IsEmpty() ? Message : FString::Printf(TEXT("%s: %s"), *AssetName, *Message);
+        return SNew(STableRow<TSharedPtr<FRuleRangerRunGroupItem>>, OwnerTable)
+            .Padding(FMargin(28.f, 2.f, 0.f, 2.f))[SNew(STextBlock).Text(FText::FromString(Text))];
     }
 }
 
@@ -274,6 +716,11 @@ void SRuleRangerRunView::LoadPreferences()
         bShowError = bValue;
     }
 
+    if (GConfig->GetBool(Section, TEXT("GroupByRule"), bValue, GEditorPerProjectIni))
+    {
+        bGroupByRule = bValue;
+    }
+
     if (GConfig->GetBool(Section, TEXT("ShowAssetColumn"), bValue, GEditorPerProjectIni))
     {
         bShowAssetColumn = bValue;
@@ -311,6 +758,7 @@ void SRuleRangerRunView::SavePreferences() const
     GConfig->SetBool(Section, TEXT("ShowInfo"), bShowInfo, GEditorPerProjectIni);
     GConfig->SetBool(Section, TEXT("ShowWarning"), bShowWarning, GEditorPerProjectIni);
     GConfig->SetBool(Section, TEXT("ShowError"), bShowError, GEditorPerProjectIni);
+    GConfig->SetBool(Section, TEXT("GroupByRule"), bGroupByRule, GEditorPerProjectIni);
     GConfig->SetBool(Section, TEXT("ShowAssetColumn"), bShowAssetColumn, GEditorPerProjectIni);
     GConfig->SetBool(Section, TEXT("ShowRuleColumn"), bShowRuleColumn, GEditorPerProjectIni);
     GConfig->SetBool(Section, TEXT("ShowRuleSetColumn"), bShowRuleSetColumn, GEditorPerProjectIni);
@@ -319,11 +767,58 @@ void SRuleRangerRunView::SavePreferences() const
     GConfig->Flush(false, GEditorPerProjectIni);
 }
 
+#if WITH_DEV_AUTOMATION_TESTS
+void SRuleRangerRunView::SetGroupItemSelectionForTest(const TSharedPtr<FRuleRangerRunGroupItem>& InItem,
+                                                      const bool bSelected)
+{
+    // Defined here as STreeView is only forward declared by the header
+    GroupView->SetItemSelection(InItem, bSelected);
+}
+#endif
+
+TArray<TSharedPtr<FRuleRangerMessageRow>> SRuleRangerRunView::GetSelectedRows() const
+{
+    if (!bGroupByRule)
+    {
+        return ListView.IsValid() ? ListView->GetSelectedItems() : TArray<TSharedPtr<FRuleRangerMessageRow>>();
+    }
+    else
+    {
+        TArray<TSharedPtr<FRuleRangerMessageRow>> Rows;
+        if (GroupView.IsValid())
+        {
+            const auto AddRow = [this, &Rows](const int32 Index) {
+                const auto Row = MaterializedRows.IsValidIndex(Index) ? MaterializedRows[Index] : nullptr;
+                Rows.AddUnique(Row.IsValid() ? Row : Run->Messages.GetRow(Index));
+            };
+            for (const auto& Item : GroupView->GetSelectedItems())
+            {
+                if (Item.IsValid())
+                {
+                    if (INDEX_NONE == Item->MessageIndex)
+                    {
+                        // Selecting a group selects every message in the group
+                        for (const auto Index : Item->MessageIndices)
+                        {
+                            AddRow(Index);
+                        }
+                    }
+                    else
+                    {
+                        AddRow(Item->MessageIndex);
+                    }
+                }
+            }
+        }
+        return Rows;
+    }
+}
+
 TSharedPtr<SWidget> SRuleRangerRunView::OnContextMenuOpening()
 {
     if (ListView.IsValid())
     {
-        auto Selected = ListView->GetSelectedItems();
+        const auto Selected = GetSelectedRows();
         const bool HasAnySelection = Selected.Num() > 0;
 
         bool bHasAsset = false;
@@ -399,6 +894,16 @@ TSharedPtr<SWidget> SRuleRangerRunView::OnContextMenuOpening()
                 FRuleRangerStyle::GetCopyMessageIcon(),
                 FExecuteAction::CreateSP(this, &SRuleRangerRunView::ExecuteCopyMessage),
                 FCanExecuteAction::CreateLambda([HasAnySelection] { return HasAnySelection; }));
+
+            RuleRangerUI::AddMenuEntry(
+                MenuBuilder,
+                NSLOCTEXT("RuleRanger", "Explain", "Explain…"),
+                NSLOCTEXT("RuleRanger",
+                          "Explain_Tooltip",
+                          "Scan the selected asset(s) again and show why each rule was applied or skipped"),
+                FRuleRangerStyle::GetScanIcon(),
+                FExecuteAction::CreateSP(this, &SRuleRangerRunView::ExecuteExplain),
+                FCanExecuteAction::CreateLambda([HasAnySelection, bHasAsset] { return HasAnySelection && bHasAsset; }));
         }
         MenuBuilder.EndSection();
 
@@ -415,7 +920,7 @@ void SRuleRangerRunView::ExecuteOpenSelected() const
     if (ListView.IsValid())
     {
         TArray<UObject*> ToOpen;
-        for (const auto& Row : ListView->GetSelectedItems())
+        for (const auto& Row : GetSelectedRows())
         {
             if (Row.IsValid())
             {
@@ -440,8 +945,9 @@ void SRuleRangerRunView::ExecuteShowInContentBrowser() const
     if (ListView.IsValid())
     {
         TArray<FAssetData> Assets;
-        Assets.Reserve(ListView->GetSelectedItems().Num());
-        for (const auto& Row : ListView->GetSelectedItems())
+        const auto Selected = GetSelectedRows();
+        Assets.Reserve(Selected.Num());
+        for (const auto& Row : Selected)
         {
             if (Row.IsValid())
             {
@@ -465,7 +971,7 @@ void SRuleRangerRunView::ExecuteCopyMessage() const
     {
         FString Message;
         bool bFirst = true;
-        for (const auto& Row : ListView->GetSelectedItems())
+        for (const auto& Row : GetSelectedRows())
         {
             if (Row.IsValid())
             {
@@ -489,7 +995,7 @@ void SRuleRangerRunView::ExecuteOpenRule() const
     if (ListView.IsValid())
     {
         TArray<UObject*> ToOpen;
-        for (const auto& Row : ListView->GetSelectedItems())
+        for (const auto& Row : GetSelectedRows())
         {
             if (Row.IsValid())
             {
@@ -518,7 +1024,7 @@ void SRuleRangerRunView::ExecuteOpenRuleSet() const
     if (ListView.IsValid())
     {
         TArray<UObject*> ToOpen;
-        for (const auto& Row : ListView->GetSelectedItems())
+        for (const auto& Row : GetSelectedRows())
         {
             if (Row.IsValid() && Row->RuleSet.IsValid())
             {
@@ -591,3 +1097,44 @@ void SRuleRangerRunView::ToggleRuleSetColumn(const ECheckBoxState State)
     }
     SavePreferences();
 }
+
+void SRuleRangerRunView::ExecuteExplain() const
+{
+    const auto Subsystem = GEditor ? GEditor->GetEditorSubsystem<URuleRangerEditorSubsystem>() : nullptr;
+    if (ListView.IsValid() && Subsystem)
+    {
+        TArray<UObject*> Objects;
+        for (const auto& Row : GetSelectedRows())
+        {
+            if (Row.IsValid())
+            {
+                if (const auto Object = Row->Asset.IsValid() ? const_cast<UObject*>(Row->Asset.Get()) : nullptr)
+                {
+                    Objects.AddUnique(Object);
+                }
+            }
+        }
+        if (Objects.Num() > 0)
+        {
+            // The handler is not bound to a run so the results of the rules are not added to the view again
+            const TStrongObjectPtr Handler(NewObject<URuleRangerToolResultHandler>(Subsystem));
+            FRuleRangerExplainTrace Trace;
+            for (const auto Object : Objects)
+            {
+                Subsystem->ExplainObject(Object, false, Trace, Handler.Get());
+            }
+
+            const auto Explanation = Trace.ToText();
+            UE_LOGFMT(LogRuleRanger, Display, "RuleRanger explanation:\n{Explanation}", Explanation);
+
+            const auto Window =
+                SNew(SWindow)
+                    .Title(NSLOCTEXT("RuleRanger", "ExplainWindowTitle", "Rule Ranger: Explain"))
+                    .ClientSize(FVector2D(900.f, 600.f))[SNew(SMultiLineEditableTextBox)
+                                                             .Text(FText::FromString(Explanation))
+                                                             .IsReadOnly(true)
+                                                             .AlwaysShowScrollbars(true)];
+            FSlateApplication::Get().AddWindow(Window);
+        }
+    }
+}
@@ -24,6 +24,26 @@ class SHeaderRow;
 class ITableRow;
 template <typename ItemType>
 class SListView;
+template <typename ItemType>
+class STreeView;
+
+/**
+ * An entry in the grouped view of a run.
+ * A group entry represents every matching message with the same (rule, message template) and a message entry
+ * represents a single message. The message entries of a group are only created when the group is expanded.
+ */
+struct FRuleRangerRunGroupItem
+{
+    int32 GroupId{ INDEX_NONE };
+
+    /** The index of the message, or INDEX_NONE for a group entry. */
+    int32 MessageIndex{ INDEX_NONE };
+
+    /** The matching messages in the group in display order. */
+    TArray<int32> MessageIndices;
+
+    TArray<TSharedPtr<FRuleRangerRunGroupItem>> Children;
+};
 
 class SRuleRangerRunView final : public SCompoundWidget
 {
@@ -34,6 +54,9 @@ public:
 
     void Construct(const FArguments& InArgs);
 
+    /** Refresh the view after messages have been added to the run. */
+    void Refresh() { RebuildFiltered(); }
+
 #if WITH_DEV_AUTOMATION_TESTS
     int32 GetFilteredItemCountForTest() const { return FilteredItems.Num(); }
 
@@ -58,6 +81,32 @@ public:
         RebuildFiltered();
     }
 
+    void SetGroupByRuleForTest(const bool bInGroupByRule)
+    {
+        bGroupByRule = bInGroupByRule;
+        RebuildFiltered();
+    }
+
+    int32 GetGroupCountForTest() const { return GroupItems.Num(); }
+
+    TSharedPtr<FRuleRangerRunGroupItem> GetGroupForTest(const int32 Index) const
+    {
+        return GroupItems.IsValidIndex(Index) ? GroupItems[Index] : nullptr;
+    }
+
+    void ToggleGroupExpansionForTest(const TSharedPtr<FRuleRangerRunGroupItem>& InItem)
+    {
+        ToggleGroupExpansion(InItem);
+    }
+
+    TArray<TSharedPtr<FRuleRangerRunGroupItem>>
+    GetGroupChildrenForTest(const TSharedPtr<FRuleRangerRunGroupItem>& InItem)
+    {
+        TArray<TSharedPtr<FRuleRangerRunGroupItem>> Children;
+        OnGetGroupChildren(InItem, Children);
+        return Children;
+    }
+
     void SetSortForTest(const FName& InSortColumnId, const EColumnSortMode::Type InSortMode)
     {
         SortColumnId = InSortColumnId;
@@ -69,6 +118,10 @@ public:
 
     TSharedPtr<SWidget> OpenContextMenuForTest() { return OnContextMenuOpening(); }
 
+    void SetGroupItemSelectionForTest(const TSharedPtr<FRuleRangerRunGroupItem>& InItem, bool bSelected);
+
+    TArray<TSharedPtr<FRuleRangerMessageRow>> GetSelectedRowsForTest() const { return GetSelectedRows(); }
+
     TSharedRef<ITableRow> GenerateRowForTest(TSharedPtr<FRuleRangerMessageRow> InItem,
                                              const TSharedRef<STableViewBase>& OwnerTable) const
     {
@@ -98,19 +151,75 @@ private:
     // Text search filter (case-insensitive substring)
     FString SearchQuery;
 
+    // Search text typed by the user that is applied once typing pauses
+    FString PendingSearchQuery;
+    TSharedPtr<FActiveTimerHandle> SearchTimerHandle;
+
+    // Index over the messages in the run. Messages are usually appended to a run so the index is extended
+    // as messages arrive rather than rebuilt. A live run also removes the messages of changed assets, which
+    // is detected via the removal revision of the run and causes the per-message index to be rebuilt.
+    // The run interns the objects and message templates referenced by messages so the lowercase search and
+    // sort keys are held once per interned entry rather than per message.
+    // SeverityIndices holds the indices of the messages of each severity in message order.
+    int32 IndexedCount{ 0 };
+    uint32 IndexedRemovalRevision{ 0 };
+    TArray<FString> LowerObjectNames;
+    TArray<FString> LowerTemplates;
+    static constexpr int32 SeverityCount{ 3 };
+    TArray<int32> SeverityIndices[SeverityCount];
+
+    // Rows are materialized from the run when first displayed and retained so that selection survives refreshes
+    TArray<TSharedPtr<FRuleRangerMessageRow>> MaterializedRows;
+
+    // Scratch buffer used to reconstruct lowercase messages while searching
+    FString MessageBuffer;
+
+    // The filter that produced MatchedIndices. Used to narrow the previous matches when the query is extended.
+    FString MatchedQuery;
+    uint8 MatchedSeverityMask{ 0 };
+    int32 MatchedIndexedCount{ 0 };
+    TArray<int32> MatchedIndices;
+
+    // Grouped view of the matching messages
+    bool bGroupByRule{ false };
+    TSharedPtr<STreeView<TSharedPtr<FRuleRangerRunGroupItem>>> GroupView;
+    TArray<TSharedPtr<FRuleRangerRunGroupItem>> GroupItems;
+    TSet<int32> ExpandedGroupIds;
+
     FName SortColumnId{ TEXT("Severity") };
     EColumnSortMode::Type SortMode{ EColumnSortMode::Descending };
 
     TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FRuleRangerMessageRow> InItem,
                                         const TSharedRef<STableViewBase>& OwnerTable) const;
 
-    void RebuildFiltered();
-    void SortFiltered();
-    void OnSearchChanged(const FText& NewText)
+    void IndexNewMessages();
+    bool MatchesQuery(int32 Index, const FString& LowerQuery);
+    void GetLowerMessage(int32 Index, FString& OutMessage) const;
+    TSharedPtr<FRuleRangerMessageRow> GetRow(int32 Index);
+    uint8 GetSeverityMask() const;
+    TArray<int32> GetSortedMatchedIndices() const;
+    void RebuildGroups(const TArray<int32>& SortedIndices);
+    TSharedRef<ITableRow> OnGenerateGroupRow(TSharedPtr<FRuleRangerRunGroupItem> InItem,
+                                             const TSharedRef<STableViewBase>& OwnerTable);
+    void OnGetGroupChildren(TSharedPtr<FRuleRangerRunGroupItem> InItem,
+                            TArray<TSharedPtr<FRuleRangerRunGroupItem>>& OutChildren);
+    void ToggleGroupExpansion(const TSharedPtr<FRuleRangerRunGroupItem>& InItem);
+    void OnGroupDoubleClick(TSharedPtr<FRuleRangerRunGroupItem> InItem);
+    ECheckBoxState GetGroupByRuleState() const
     {
-        SearchQuery = NewText.ToString();
+        return bGroupByRule ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+    }
+    void OnToggleGroupByRule(const ECheckBoxState State)
+    {
+        bGroupByRule = ECheckBoxState::Checked == State;
         RebuildFiltered();
+        SavePreferences();
     }
+    void RebuildFiltered();
+    void SortFiltered();
+    void OnSearchChanged(const FText& NewText);
+    void OnSearchCommitted(const FText& NewText, ETextCommit::Type CommitType);
+    EActiveTimerReturnType ApplyPendingSearch(double InCurrentTime, float InDeltaTime);
     TSharedRef<SWidget> BuildColumnsMenu();
     void ToggleAssetColumn(ECheckBoxState State);
     void ToggleRuleColumn(ECheckBoxState State);
@@ -160,10 +269,13 @@ private:
     }
 
     // Context menu support
+    /** Returns the messages selected in the active view. Selecting a group selects each of its messages. */
+    TArray<TSharedPtr<FRuleRangerMessageRow>> GetSelectedRows() const;
     TSharedPtr<SWidget> OnContextMenuOpening();
     void ExecuteOpenSelected() const;
     void ExecuteShowInContentBrowser() const;
     void ExecuteCopyMessage() const;
     void ExecuteOpenRule() const;
     void ExecuteOpenRuleSet() const;
+    void ExecuteExplain() const;
 };
@@ -14,15 +14,18 @@
 
 #include "RuleRanger/UI/ToolTab/SRuleRangerToolPanel.h"
 #include "AssetRegistry/AssetData.h"
+#include "Containers/Ticker.h"
 #include "Editor.h"
 #include "Misc/ScopedSlowTask.h"
 #include "Modules/ModuleManager.h"
 #include "RuleRanger/ProjectRuleTraversal.h"
+#include "RuleRanger/RuleRangerRenameBatch.h"
 #include "RuleRanger/UI/RuleRangerDeveloperSettings.h"
 #include "RuleRanger/UI/RuleRangerEditorSubsystem.h"
 #include "RuleRanger/UI/RuleRangerStyle.h"
 #include "RuleRanger/UI/RuleRangerTools.h"
 #include "RuleRanger/UI/RuleRangerUIHelpers.h"
+#include "RuleRanger/UI/ToolTab/RuleRangerBackgroundScan.h"
 #include "RuleRanger/UI/ToolTab/RuleRangerToolProjectResultHandler.h"
 #include "RuleRanger/UI/ToolTab/RuleRangerToolResultHandler.h"
 #include "RuleRanger/UI/ToolTab/SRuleRangerRunView.h"
@@ -36,12 +39,38 @@
 #include "Widgets/Layout/SWidgetSwitcher.h"
 #include "Widgets/Text/STextBlock.h"
 
+SRuleRangerToolPanel::~SRuleRangerToolPanel()
+{
+    CancelBackgroundScan();
+    if (LiveScan.IsValid())
+    {
+        LiveScan->OnProgress.Unbind();
+        LiveScan->OnFinished.Unbind();
+        LiveScan->Cancel();
+        LiveScan.Reset();
+    }
+    if (GEditor && OnWatchedAssetsChangedHandle.IsValid())
+    {
+        if (const auto Subsystem = GEditor->GetEditorSubsystem<URuleRangerEditorSubsystem>())
+        {
+            Subsystem->OnWatchedAssetsChanged.Remove(OnWatchedAssetsChangedHandle);
+        }
+    }
+}
+
 void SRuleRangerToolPanel::Construct(const FArguments&)
 {
-    const auto ScanAllEnabled = [] { return FRuleRangerTools::CanRunScanAll(); };
-    const auto ScanProjectEnabled = [] { return FRuleRangerTools::CanRunScanProject(); };
-    const auto ScanContentEnabled = [] { return FRuleRangerTools::CanRunScanContent(); };
-    const auto ScanSelectedEnabled = [] { return FRuleRangerTools::CanRunScanSelected(); };
+    // Scans are disabled while a background scan is running so that runs do not interleave
+    const auto ScanAllEnabled = [this] { return !IsBackgroundScanRunning() && FRuleRangerTools::CanRunScanAll(); };
+    const auto ScanProjectEnabled = [this] {
+        return !IsBackgroundScanRunning() && FRuleRangerTools::CanRunScanProject();
+    };
+    const auto ScanContentEnabled = [this] {
+        return !IsBackgroundScanRunning() && FRuleRangerTools::CanRunScanContent();
+    };
+    const auto ScanSelectedEnabled = [this] {
+        return !IsBackgroundScanRunning() && FRuleRangerTools::CanRunScanSelected();
+    };
 
     const auto OnScanAll = [this] {
         StartRun(NSLOCTEXT("RuleRanger", "Run_ScanAll", "Scan All"));
@@ -256,6 +285,12 @@ void SRuleRangerToolPanel::Construct(const FArguments&)
 
     RebuildRunsUI();
     RebuildRunContents();
+
+    if (const auto Subsystem = GEditor->GetEditorSubsystem<URuleRangerEditorSubsystem>())
+    {
+        OnWatchedAssetsChangedHandle =
+            Subsystem->OnWatchedAssetsChanged.AddSP(this, &SRuleRangerToolPanel::OnWatchedAssetsChanged);
+    }
 }
 
 void SRuleRangerToolPanel::StartRun(const FText& Title)
@@ -268,6 +303,40 @@ void SRuleRangerToolPanel::StartRun(const FText& Title)
     RebuildRunContents();
 }
 
+FText SRuleRangerToolPanel::GetRunLabel(const TWeakPtr<FRuleRangerRun>& WeakRun)
+{
+    if (const auto Run = WeakRun.Pin())
+    {
+        const auto& Messages = Run->Messages;
+        const auto ErrorCount = Messages.GetSeverityCount(ERuleRangerToolSeverity::Error);
+        const auto WarningCount = Messages.GetSeverityCount(ERuleRangerToolSeverity::Warning);
+        const auto InfoCount = Messages.GetSeverityCount(ERuleRangerToolSeverity::Info);
+        auto LabelStr = Run->Title.ToString();
+        if (ErrorCount + WarningCount + InfoCount > 0)
+        {
+            TArray<FString> Parts;
+            if (ErrorCount > 0)
+            {
+                Parts.Add(FString::Printf(TEXT("E%d"), ErrorCount));
+            }
+            if (WarningCount > 0)
+            {
+                Parts.Add(FString::Printf(TEXT("W%d"), WarningCount));
+            }
+            if (InfoCount > 0)
+            {
+                Parts.Add(FString::Printf(TEXT("I%d"), InfoCount));
+            }
+            LabelStr += TEXT(" (") + FString::Join(Parts, TEXT(" ")) + TEXT(")");
+        }
+        return FText::FromString(LabelStr);
+    }
+    else
+    {
+        return FText::GetEmpty();
+    }
+}
+
 void SRuleRangerToolPanel::RebuildRunsUI()
 {
     if (RunTabBar.IsValid())
@@ -276,45 +345,8 @@ void SRuleRangerToolPanel::RebuildRunsUI()
         for (auto Index = 0; Index < Runs.Num(); ++Index)
         {
             const auto bActive = ActiveRunIndex == Index;
-            const auto Title = Runs[Index]->Title;
-            auto ErrorCount{ 0 };
-            auto WarningCount{ 0 };
-            auto InfoCount{ 0 };
-            for (const auto& Row : Runs[Index]->Messages)
-            {
-                switch (Row->Severity)
-                {
-                    case ERuleRangerToolSeverity::Error:
-                        ++ErrorCount;
-                        break;
-                    case ERuleRangerToolSeverity::Warning:
-                        ++WarningCount;
-                        break;
-                    case ERuleRangerToolSeverity::Info:
-                    default:
-                        ++InfoCount;
-                        break;
-                }
-            }
-            auto LabelStr = Title.ToString();
-            if (ErrorCount + WarningCount + InfoCount > 0)
-            {
-                TArray<FString> Parts;
-                if (ErrorCount > 0)
-                {
-                    Parts.Add(FString::Printf(TEXT("E%d"), ErrorCount));
-                }
-                if (WarningCount > 0)
-                {
-                    Parts.Add(FString::Printf(TEXT("W%d"), WarningCount));
-                }
-                if (InfoCount > 0)
-                {
-                    Parts.Add(FString::Printf(TEXT("I%d"), InfoCount));
-                }
-                LabelStr += TEXT(" (") + FString::Join(Parts, TEXT(" ")) + TEXT(")");
-            }
-            const auto Label = FText::FromString(LabelStr);
+            // The label is bound rather than copied so that scan progress updates the counts without a rebuild
+            const TWeakPtr<FRuleRangerRun> WeakRun{ Runs[Index] };
             RunTabBar->AddSlot().AutoWidth().Padding(FMargin(0.f, 0.f, 8.f, 0.f))
                 [SNew(SHorizontalBox)
                  + SHorizontalBox::Slot().AutoWidth()[SNew(SButton)
@@ -329,7 +361,9 @@ void SRuleRangerToolPanel::RebuildRunsUI()
                                                               }
                                                               RebuildRunsUI();
                                                               return FReply::Handled();
-                                                          })[SNew(STextBlock).Text(Label)]]
+                                                          })[SNew(STextBlock).Text_Lambda([WeakRun] {
+                                                              return GetRunLabel(WeakRun);
+                                                          })]]
                  + SHorizontalBox::Slot()
                        .AutoWidth()
                        .Padding(FMargin(4.f, 0.f, 0.f, 0.f))
@@ -358,7 +392,7 @@ void SRuleRangerToolPanel::RebuildRunContents()
         RunPageWidgets.Reset();
         for (auto Index = 0; Index < Runs.Num(); ++Index)
         {
-            const TSharedRef<SWidget> Page = SNew(SRuleRangerRunView).Run(Runs[Index]);
+            const TSharedRef<SRuleRangerRunView> Page = SNew(SRuleRangerRunView).Run(Runs[Index]);
             RunContentSwitcher->AddSlot()[Page];
             RunPageWidgets.Add(Page);
         }
@@ -469,44 +503,184 @@ void SRuleRangerToolPanel::RunSelectedScan(const TSharedPtr<FRuleRangerRun>& Run
     }
 }
 
-// ReSharper disable once CppMemberFunctionMayBeStatic
 void SRuleRangerToolPanel::RunAssetScan(const TSharedPtr<FRuleRangerRun>& Run,
                                         const bool bFix,
                                         TArray<FAssetData> Assets)
 {
     if (const auto Subsystem = GEditor->GetEditorSubsystem<URuleRangerEditorSubsystem>())
     {
-        FScopedSlowTask SlowTask(Assets.Num(),
-                                 bFix ? NSLOCTEXT("RuleRanger", "ToolFixAssets", "Rule Ranger: Scan & Fix Assets")
-                                      : NSLOCTEXT("RuleRanger", "ToolScanAssets", "Rule Ranger: Scan Assets"));
-        SlowTask.MakeDialogDelayed(.5f, true);
+        const auto DevSettings = GetDefault<URuleRangerDeveloperSettings>();
+        if (!bFix && DevSettings && DevSettings->bScanContentInBackground)
+        {
+            // Fixes modify assets so they are only applied in the blocking scan below
+            CancelBackgroundScan();
+            const auto BudgetSeconds = DevSettings->BackgroundScanBudgetMs / 1000.0;
+            BackgroundScan = MakeShared<FRuleRangerBackgroundScan>(Run, MoveTemp(Assets), BudgetSeconds);
+            const TWeakPtr<FRuleRangerRun> WeakRun{ Run };
+            BackgroundScan->OnProgress.BindSP(this, &SRuleRangerToolPanel::OnBackgroundScanProgress, WeakRun);
+            BackgroundScan->OnFinished.BindSP(this, &SRuleRangerToolPanel::OnBackgroundScanFinished, WeakRun);
+            BackgroundScan->Start(Subsystem);
+        }
+        else
+        {
+            FScopedSlowTask SlowTask(Assets.Num(),
+                                     bFix ? NSLOCTEXT("RuleRanger", "ToolFixAssets", "Rule Ranger: Scan & Fix Assets")
+                                          : NSLOCTEXT("RuleRanger", "ToolScanAssets", "Rule Ranger: Scan Assets"));
+            SlowTask.MakeDialogDelayed(.5f, true);
 
-        // Use TStrongObjectPtr to avoid GC collecting handler during the run
-        const TStrongObjectPtr Handler(NewObject<URuleRangerToolResultHandler>(Subsystem));
-        Handler->Init(Run);
+            // Use TStrongObjectPtr to avoid GC collecting handler during the run
+            const TStrongObjectPtr Handler(NewObject<URuleRangerToolResultHandler>(Subsystem));
+            Handler->Init(Run);
 
-        for (const auto& Asset : Assets)
-        {
-            if (SlowTask.ShouldCancel())
+            if (bFix)
             {
-                break;
+                // Allow actions to prepare all the assets at once (i.e. batch compile) rather than one at a time
+                Subsystem->PrepareAssetsForFix(Assets);
             }
-            else
+
+            // Renames requested by fixes are performed together when the batch goes out of scope
+            FRuleRangerRenameBatch RenameBatch;
+            for (const auto& Asset : Assets)
             {
-                if (const auto Object = Asset.GetAsset())
+                if (SlowTask.ShouldCancel())
                 {
-                    if (bFix)
-                    {
-                        Subsystem->ScanAndFixObject(Object, Handler.Get());
-                    }
-                    else
+                    break;
+                }
+                else
+                {
+                    if (const auto Object = Asset.GetAsset())
                     {
-                        Subsystem->ScanObject(Object, Handler.Get());
+                        if (bFix)
+                        {
+                            Subsystem->ScanAndFixObject(Object, Handler.Get());
+                        }
+                        else
+                        {
+                            Subsystem->ScanObject(Object, Handler.Get());
+                        }
                     }
+                    SlowTask.EnterProgressFrame();
+                    SlowTask.TickProgress();
                 }
-                SlowTask.EnterProgressFrame();
-                SlowTask.TickProgress();
             }
         }
     }
 }
+
+bool SRuleRangerToolPanel::IsBackgroundScanRunning() const
+{
+    return BackgroundScan.IsValid() && BackgroundScan->IsRunning();
+}
+
+void SRuleRangerToolPanel::CancelBackgroundScan()
+{
+    if (BackgroundScan.IsValid())
+    {
+        BackgroundScan->OnProgress.Unbind();
+        BackgroundScan->OnFinished.Unbind();
+        BackgroundScan->Cancel();
+        BackgroundScan.Reset();
+    }
+}
+
+void SRuleRangerToolPanel::OnBackgroundScanProgress(const TWeakPtr<FRuleRangerRun> Run)
+{
+    // Only the page of the scanned run is refreshed. The run tabs bind their labels to the run so they are
+    // only rebuilt when a run starts or finishes.
+    // ReSharper disable once CppTooWideScopeInitStatement
+    const auto Index = Runs.IndexOfByKey(Run.Pin());
+    if (RunPageWidgets.IsValidIndex(Index))
+    {
+        RunPageWidgets[Index]->Refresh();
+    }
+}
+
+void SRuleRangerToolPanel::OnBackgroundScanFinished(const TWeakPtr<FRuleRangerRun> Run)
+{
+    // The scan is still executing so it is released when the next background scan starts or the panel is destroyed
+    OnBackgroundScanProgress(Run);
+    RebuildRunsUI();
+}
+
+void SRuleRangerToolPanel::OnWatchedAssetsChanged(const TArray<FAssetData>& Assets)
+{
+    // Changes that arrive while a live scan is running are scanned once it completes, so that the messages of
+    // an asset are never removed while the asset is still being scanned
+    PendingLiveAssets.Append(Assets);
+    if (!LiveScan.IsValid() || !LiveScan->IsRunning())
+    {
+        StartLiveScan();
+    }
+}
+
+void SRuleRangerToolPanel::StartLiveScan()
+{
+    const auto Subsystem = GEditor->GetEditorSubsystem<URuleRangerEditorSubsystem>();
+    if (Subsystem && !PendingLiveAssets.IsEmpty())
+    {
+        if (!LiveRun.IsValid() || !Runs.Contains(LiveRun))
+        {
+            // The live run is recreated if the user closed it. It does not take focus from the active run.
+            LiveRun = MakeShared<FRuleRangerRun>();
+            LiveRun->Title = NSLOCTEXT("RuleRanger", "Run_Live", "Live");
+            Runs.Add(LiveRun);
+            if (INDEX_NONE == ActiveRunIndex)
+            {
+                ActiveRunIndex = Runs.Num() - 1;
+            }
+            RebuildRunContents();
+            RebuildRunsUI();
+        }
+
+        TArray<FAssetData> Assets;
+        TSet<FSoftObjectPath> AssetPaths;
+        for (const auto& Asset : PendingLiveAssets)
+        {
+            // ReSharper disable once CppTooWideScopeInitStatement
+            const auto AssetPath = Asset.GetSoftObjectPath();
+            if (!AssetPaths.Contains(AssetPath))
+            {
+                AssetPaths.Add(AssetPath);
+                Assets.Add(Asset);
+            }
+        }
+        PendingLiveAssets.Reset();
+
+        // Only the messages of the changed assets are replaced. Assets that no longer match any rule, or that
+        // were deleted, simply have their messages removed.
+        LiveRun->Messages.RemoveAssets(AssetPaths);
+
+        const auto DevSettings = GetDefault<URuleRangerDeveloperSettings>();
+        const auto BudgetSeconds = DevSettings ? DevSettings->BackgroundScanBudgetMs / 1000.0 : 0.008;
+        LiveScan = MakeShared<FRuleRangerBackgroundScan>(LiveRun, MoveTemp(Assets), BudgetSeconds);
+        LiveScan->SetShowNotification(false);
+        const TWeakPtr<FRuleRangerRun> WeakRun{ LiveRun };
+        LiveScan->OnProgress.BindSP(this, &SRuleRangerToolPanel::OnBackgroundScanProgress, WeakRun);
+        LiveScan->OnFinished.BindSP(this, &SRuleRangerToolPanel::OnLiveScanFinished);
+        LiveScan->Start(Subsystem);
+
+        // Refresh immediately so that the removed messages disappear even if the rescan produces no messages
+        OnBackgroundScanProgress(WeakRun);
+    }
+}
+
+void SRuleRangerToolPanel::OnLiveScanFinished()
+{
+    OnBackgroundScanProgress(LiveRun);
+    RebuildRunsUI();
+    if (!PendingLiveAssets.IsEmpty())
+    {
+        // The finished scan is still executing so it is released by starting the next scan on a later tick
+        const TWeakPtr<SRuleRangerToolPanel> WeakPanel{ SharedThis(this) };
+        FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakPanel](float) {
+            if (const auto Panel = WeakPanel.Pin())
+            {
+                if (!Panel->LiveScan.IsValid() || !Panel->LiveScan->IsRunning())
+                {
+                    Panel->StartLiveScan();
+                }
+            }
+            return false;
+        }));
+    }
+}
@@ -14,8 +14,12 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "RuleRanger/UI/ToolTab/RuleRangerRunStore.h"
 #include "Widgets/SCompoundWidget.h"
 
+class FRuleRangerBackgroundScan;
+struct FAssetData;
+class SRuleRangerRunView;
 class URuleRangerEditorSubsystem;
 class URuleRangerRule;
 class URuleRangerProjectRule;
@@ -42,7 +46,7 @@ struct FRuleRangerRun
 {
     FText Title;
     FDateTime StartedAt{ FDateTime::Now() };
-    TArray<TSharedPtr<FRuleRangerMessageRow>> Messages;
+    FRuleRangerRunStore Messages;
 };
 
 /**
@@ -54,6 +58,8 @@ public:
     SLATE_BEGIN_ARGS(SRuleRangerToolPanel) {}
     SLATE_END_ARGS()
 
+    virtual ~SRuleRangerToolPanel() override;
+
     /** Constructs the widget. */
     void Construct(const FArguments& InArgs);
 
@@ -71,11 +77,17 @@ public:
 
     void RebuildRunsUIForTest() { RebuildRunsUI(); }
 
+    static FText GetRunLabelForTest(const TSharedPtr<FRuleRangerRun>& Run) { return GetRunLabel(Run); }
+
     void RebuildRunContentsForTest() { RebuildRunContents(); }
 
     void CloseRunAtForTest(const int32 Index) { CloseRunAt(Index); }
 
     void ClearAllRunsForTest() { ClearAllRuns(); }
+
+    TSharedPtr<FRuleRangerRun> GetLiveRunForTest() const { return LiveRun; }
+
+    void OnWatchedAssetsChangedForTest(const TArray<FAssetData>& Assets) { OnWatchedAssetsChanged(Assets); }
 #endif
 
 private:
@@ -84,9 +96,24 @@ private:
 
     TSharedPtr<SHorizontalBox> RunTabBar;
     TSharedPtr<SWidgetSwitcher> RunContentSwitcher;
-    TArray<TSharedRef<SWidget>> RunPageWidgets;
+    TArray<TSharedRef<SRuleRangerRunView>> RunPageWidgets;
+
+    /** The content scan that is running in the background, if any. */
+    TSharedPtr<FRuleRangerBackgroundScan> BackgroundScan;
+
+    /**
+     * The run kept current while the editor subsystem is watching for changes. The messages of changed assets
+     * are removed and the changed assets rescanned in the background, so the run never requires a full scan.
+     */
+    TSharedPtr<FRuleRangerRun> LiveRun;
+    TSharedPtr<FRuleRangerBackgroundScan> LiveScan;
+
+    /** Changed assets that are scanned once the current live scan completes. */
+    TArray<FAssetData> PendingLiveAssets;
+    FDelegateHandle OnWatchedAssetsChangedHandle;
 
     void StartRun(const FText& Title);
+    static FText GetRunLabel(const TWeakPtr<FRuleRangerRun>& WeakRun);
     void RebuildRunsUI();
     void RebuildRunContents();
     void CloseRunAt(int32 Index);
@@ -97,4 +124,13 @@ private:
     void RunSelectedScan(const TSharedPtr<FRuleRangerRun>& Run, bool bFix);
 
     void RunAssetScan(const TSharedPtr<FRuleRangerRun>& Run, const bool bFix, TArray<FAssetData> Assets);
+
+    bool IsBackgroundScanRunning() const;
+    void CancelBackgroundScan();
+    void OnBackgroundScanProgress(TWeakPtr<FRuleRangerRun> Run);
+    void OnBackgroundScanFinished(TWeakPtr<FRuleRangerRun> Run);
+
+    void OnWatchedAssetsChanged(const TArray<FAssetData>& Assets);
+    void StartLiveScan();
+    void OnLiveScanFinished();
 };
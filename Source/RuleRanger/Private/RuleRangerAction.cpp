@@ -33,3 +33,10 @@ UClass* URuleRangerAction::GetExpectedType() const
 {
     return UObject::StaticClass();
 }
+
+bool URuleRangerAction::ShouldPrepareForFix() const
+{
+    return false;
+}
+
+void URuleRangerAction::PrepareForFix(TConstArrayView<UObject*> Objects) {}
@@ -15,7 +15,64 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(RuleRangerMatcher)
 
+namespace
+{
+    void AppendValueStructure(FString& OutStructure, const FProperty* Property, const void* Value)
+    {
+        if (const auto ObjectProperty = CastField<FObjectPropertyBase>(Property))
+        {
+            const auto Object = ObjectProperty->GetObjectPropertyValue(Value);
+            if (const auto Matcher = Cast<URuleRangerMatcher>(Object))
+            {
+                // Child matchers are instanced so they are compared by structure rather than by identity
+                Matcher->AppendStructure(OutStructure);
+            }
+            else
+            {
+                OutStructure.Append(GetPathNameSafe(Object));
+            }
+        }
+        else if (const auto ArrayProperty = CastField<FArrayProperty>(Property))
+        {
+            FScriptArrayHelper Helper(ArrayProperty, Value);
+            OutStructure.AppendChar(TEXT('['));
+            for (int32 i = 0; i < Helper.Num(); i++)
+            {
+                AppendValueStructure(OutStructure, ArrayProperty->Inner, Helper.GetRawPtr(i));
+                OutStructure.AppendChar(TEXT(','));
+            }
+            OutStructure.AppendChar(TEXT(']'));
+        }
+        else
+        {
+            Property->ExportTextItem_Direct(OutStructure, Value, nullptr, nullptr, PPF_None);
+        }
+    }
+} // namespace
+
 bool URuleRangerMatcher::Test(UObject* Object) const
 {
     return false;
 }
+
+void URuleRangerMatcher::AppendStructure(FString& OutStructure) const
+{
+    OutStructure.Append(GetClass()->GetPathName());
+    OutStructure.AppendChar(TEXT('('));
+    for (TFieldIterator<FProperty> It(GetClass()); It; ++It)
+    {
+        // ReSharper disable once CppTooWideScopeInitStatement
+        const auto Property = *It;
+        if (Property->HasAnyPropertyFlags(CPF_Edit) && !Property->HasAnyPropertyFlags(CPF_Transient))
+        {
+            for (int32 i = 0; i < Property->ArrayDim; i++)
+            {
+                OutStructure.Append(Property->GetName());
+                OutStructure.AppendChar(TEXT('='));
+                AppendValueStructure(OutStructure, Property, Property->ContainerPtrToValuePtr<void>(this, i));
+                OutStructure.AppendChar(TEXT(';'));
+            }
+        }
+    }
+    OutStructure.AppendChar(TEXT(')'));
+}
@@ -64,6 +64,24 @@ void URuleRangerProjectRule::Apply(URuleRangerProjectActionContext* ActionContex
     }
 }
 
+bool URuleRangerProjectRule::IsConcurrencySafe() const
+{
+    // Invalid actions are reported via the context so they do not prevent the rule from being applied concurrently
+    bool bHasAction{ false };
+    for (const auto Action : Actions)
+    {
+        if (IsValid(Action))
+        {
+            if (!Action->IsConcurrencySafe())
+            {
+                return false;
+            }
+            bHasAction = true;
+        }
+    }
+    return bHasAction;
+}
+
 void URuleRangerProjectRule::PreSave(const FObjectPreSaveContext SaveContext)
 {
     // Remove invalid entries but preserve author-specified order
@@ -63,6 +63,13 @@ public:
      */
     void Apply(URuleRangerProjectActionContext* ActionContext);
 
+    /**
+     * Return true if every action in the rule can be applied concurrently in report mode.
+     *
+     * @return true if the rule can be applied on a worker thread in report mode.
+     */
+    bool IsConcurrencySafe() const;
+
     // Clean up invalid entries before saving
     virtual void PreSave(FObjectPreSaveContext SaveContext) override;
 
@@ -13,6 +13,9 @@
  */
 #include "RuleRangerRule.h"
 #include "Logging/StructuredLog.h"
+#include "RuleRanger/RuleRangerExplainTrace.h"
+#include "RuleRanger/RuleRangerMatcherResults.h"
+#include "RuleRanger/RuleRangerMatcherStats.h"
 #include "RuleRanger/RuleRangerUtilities.h"
 #include "RuleRangerAction.h"
 #include "RuleRangerActionContext.h"
@@ -25,10 +28,26 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(RuleRangerRule)
 
+namespace
+{
+    bool TestMatcher(const URuleRangerMatcher* Matcher, UObject* Object)
+    {
+        const FRuleRangerExplainTrace::FNodeScope MatcherNode(TEXT("Matcher"), Matcher);
+        const auto bMatched = FRuleRangerMatcherResults::Test(Matcher, Object);
+        FRuleRangerExplainTrace::SetOutcome(bMatched ? TEXT("Matched") : TEXT("Did not match"));
+        return bMatched;
+    }
+} // namespace
+
 void URuleRangerRule::Apply(URuleRangerActionContext* ActionContext, UObject* Object)
 {
     if (IsValid(Object) && Match(ActionContext, Object))
     {
+        if (!ActionContext->IsDryRun())
+        {
+            // The actions may modify the object so the rules applied later must test the object again
+            ActionContext->GetObjectAnalysis<FRuleRangerMatcherResults>(Object).Reset();
+        }
         int32 ActionIndex = 0;
         for (const auto Action : Actions)
         {
@@ -42,6 +61,7 @@ void URuleRangerRule::Apply(URuleRangerActionContext* ActionContext, UObject* Ob
             }
             else
             {
+                const FRuleRangerExplainTrace::FNodeScope ActionNode(TEXT("Action"), Action);
                 if (const auto _ = FRuleRangerUtilities::ToObject<UObject>(Object, Action->GetExpectedType()))
                 {
                     Action->Apply(ActionContext, Object);
@@ -54,6 +74,12 @@ void URuleRangerRule::Apply(URuleRangerActionContext* ActionContext, UObject* Ob
                                                      *Action->GetExpectedType()->GetName()));
                 }
                 const auto State = ActionContext->GetState();
+                if (FRuleRangerExplainTrace::IsActive())
+                {
+                    FRuleRangerExplainTrace::SetOutcome(
+                        StaticEnum<ERuleRangerActionState>()->GetDisplayNameTextByValue(static_cast<int64>(State))
+                            .ToString());
+                }
                 if (ERuleRangerActionState::AS_Fatal == State)
                 {
                     UE_LOGFMT(LogRuleRanger,
@@ -102,6 +128,7 @@ bool URuleRangerRule::Match(URuleRangerActionContext* ActionContext, UObject* Ob
                   "Match({Object}) on rule {Rule} skipped as no actions accept the object type.",
                   GetNameSafe(Object),
                   GetName());
+        FRuleRangerExplainTrace::SetOutcome(TEXT("Skipped: no actions accept the object type"));
         return false;
     }
 
@@ -111,9 +138,16 @@ bool URuleRangerRule::Match(URuleRangerActionContext* ActionContext, UObject* Ob
         return false;
     }
 
-    int32 MatcherIndex = 0;
-    for (const auto Matcher : Matchers)
+    // Matchers are evaluated in the authored order if any matcher is invalid
+    TArray<int32, TInlineAllocator<8>> Order;
+    FRuleRangerMatcherStats::Get().GetEvaluationOrder(this, Matchers, true, bPinMatcherOrder, Order);
+
+    // Structurally equal matchers of the other rules applied to the object share their results
+    const FRuleRangerMatcherResults::FScope ResultsScope(
+        ActionContext->GetObjectAnalysis<FRuleRangerMatcherResults>(Object));
+    for (const auto MatcherIndex : Order)
     {
+        const auto Matcher = Matchers[MatcherIndex];
         if (!IsValid(Matcher))
         {
             ActionContext->Error(
@@ -121,7 +155,7 @@ bool URuleRangerRule::Match(URuleRangerActionContext* ActionContext, UObject* Ob
                               FText::AsNumber(MatcherIndex)));
             return false;
         }
-        else if (!Matcher->Test(Object))
+        else if (!TestMatcher(Matcher, Object))
         {
             UE_LOGFMT(LogRuleRanger,
                       Verbose,
@@ -129,10 +163,17 @@ bool URuleRangerRule::Match(URuleRangerActionContext* ActionContext, UObject* Ob
                       Object->GetName(),
                       GetName(),
                       Matcher->GetName());
+            if (FRuleRangerExplainTrace::IsActive())
+            {
+                FRuleRangerExplainTrace::SetOutcome(
+                    FString::Printf(TEXT("Skipped: matcher %s at index %d did not match"),
+                                    *Matcher->GetName(),
+                                    MatcherIndex));
+            }
             return false;
         }
-        MatcherIndex++;
     }
+    FRuleRangerExplainTrace::SetOutcome(TEXT("Matched"));
     return true;
 }
 
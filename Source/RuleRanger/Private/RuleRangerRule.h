@@ -81,6 +81,13 @@ public:
               meta = (AllowAbstract = "false", ForceShowPluginContent = "true"))
     TArray<TObjectPtr<URuleRangerMatcher>> Matchers;
 
+    /**
+     * Should the matchers always be evaluated in the authored order?
+     * Otherwise the matchers that are cheap and most likely to not match are evaluated first.
+     */
+    UPROPERTY(EditAnywhere, Category = "Rule Ranger")
+    bool bPinMatcherOrder{ false };
+
     /** The actions that will be applied if the object is matched by the rule. */
     UPROPERTY(Instanced,
               EditAnywhere,
@@ -0,0 +1,123 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+    #include "Materials/Material.h"
+    #include "Materials/MaterialExpressionScalarParameter.h"
+    #include "Misc/AutomationTest.h"
+    #include "RuleRanger/Actions/Material/MaterialParameterSnapshot.h"
+    #include "Tests/RuleRanger/RuleRangerAutomationTestHelpers.h"
+
+namespace RuleRangerMaterialParameterSnapshotTests
+{
+    FRuleRangerMaterialParameter MakeParameter(const TCHAR* const Name,
+                                               const TCHAR* const Description,
+                                               const EMaterialParameterAssociation Association = GlobalParameter,
+                                               const int32 Index = INDEX_NONE)
+    {
+        FRuleRangerMaterialParameter Parameter;
+        Parameter.Info = FMaterialParameterInfo(FName(Name), Association, Index);
+        Parameter.Metadata.Description = Description;
+        return Parameter;
+    }
+
+    bool AddScalarParameter(UMaterial* const Material, const TCHAR* const Name)
+    {
+        const auto Expression = NewObject<UMaterialExpressionScalarParameter>(Material);
+        if (Expression)
+        {
+            Expression->Material = Material;
+            Expression->ParameterName = FName(Name);
+            Expression->Desc = FString::Printf(TEXT("%s description"), Name);
+            Material->GetExpressionCollection().AddExpression(Expression);
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+} // namespace RuleRangerMaterialParameterSnapshotTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerMaterialParameterSnapshotRetainsLastDuplicateTest,
+                                 "RuleRanger.Actions.Material.ParameterSnapshot.RetainsLastDuplicate",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerMaterialParameterSnapshotRetainsLastDuplicateTest::RunTest(const FString&)
+{
+    using namespace RuleRangerMaterialParameterSnapshotTests;
+
+    // Parameters are gathered one type at a time so a parameter defined for multiple types appears once per type
+    TArray<FRuleRangerMaterialParameter> Parameters;
+    Parameters.Add(MakeParameter(TEXT("Tint"), TEXT("Scalar")));
+    Parameters.Add(MakeParameter(TEXT("Albedo"), TEXT("Texture")));
+    Parameters.Add(MakeParameter(TEXT("Tint"), TEXT("Layer"), LayerParameter, 0));
+    Parameters.Add(MakeParameter(TEXT("Tint"), TEXT("Vector")));
+    Parameters.Add(MakeParameter(TEXT("Tint"), TEXT("StaticSwitch")));
+    FRuleRangerMaterialParameterSnapshot::SortAndRemoveDuplicates(Parameters);
+
+    if (TestEqual(TEXT("Duplicate parameters should be removed"), Parameters.Num(), 3))
+    {
+        return TestEqual(TEXT("Parameters should be sorted by name"), Parameters[0].Info.Name, FName(TEXT("Albedo")))
+            && TestEqual(TEXT("Parameters with the same name should be sorted by association"),
+                         Parameters[1].Metadata.Description,
+                         FString(TEXT("Layer")))
+            && TestEqual(TEXT("The last duplicate added should be retained"),
+                         Parameters[2].Metadata.Description,
+                         FString(TEXT("StaticSwitch")));
+    }
+    else
+    {
+        return false;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerMaterialParameterSnapshotSortsMaterialParametersTest,
+                                 "RuleRanger.Actions.Material.ParameterSnapshot.SortsMaterialParameters",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerMaterialParameterSnapshotSortsMaterialParametersTest::RunTest(const FString&)
+{
+    using namespace RuleRangerMaterialParameterSnapshotTests;
+
+    const auto Material = RuleRangerTests::NewTransientObject<UMaterial>();
+    if (TestNotNull(TEXT("Material fixture should be created"), Material)
+        && TestTrue(TEXT("Roughness parameter should be created"), AddScalarParameter(Material, TEXT("Roughness")))
+        && TestTrue(TEXT("Albedo parameter should be created"), AddScalarParameter(Material, TEXT("Albedo")))
+        && TestTrue(TEXT("Metallic parameter should be created"), AddScalarParameter(Material, TEXT("Metallic"))))
+    {
+        Material->BuildEditorParameterList();
+        Material->UpdateCachedExpressionData();
+
+        const FRuleRangerMaterialParameterSnapshot Snapshot(Material);
+        const auto Parameters = Snapshot.GetParameters();
+        if (TestEqual(TEXT("Every parameter should be captured"), Parameters.Num(), 3))
+        {
+            return TestEqual(TEXT("First parameter"), Parameters[0].Info.Name, FName(TEXT("Albedo")))
+                && TestEqual(TEXT("Second parameter"), Parameters[1].Info.Name, FName(TEXT("Metallic")))
+                && TestEqual(TEXT("Third parameter"), Parameters[2].Info.Name, FName(TEXT("Roughness")))
+                && TestEqual(TEXT("Parameter metadata should be captured"),
+                             Parameters[0].Metadata.Description,
+                             FString(TEXT("Albedo description")));
+        }
+        else
+        {
+            return false;
+        }
+    }
+    else
+    {
+        return false;
+    }
+}
+
+#endif
@@ -262,6 +262,40 @@ bool FRuleRangerEnsureNoEmptyContentFoldersActionFixDeletesEmptyLeafTest::RunTes
     }
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRuleRangerEnsureNoEmptyContentFoldersActionFixDeletesNestedEmptyFoldersTest,
+    "RuleRanger.ProjectActions.Path.EnsureNoEmptyContentFolders.FixDeletesNestedEmptyFolders",
+    RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerEnsureNoEmptyContentFoldersActionFixDeletesNestedEmptyFoldersTest::RunTest(const FString&)
+{
+    RuleRangerTests::FProjectRuleFixture Fixture;
+    RuleRangerEnsureNoEmptyContentFoldersActionTests::FScopedContentFolderSandbox Sandbox(TEXT("FixNested"));
+    const auto Action = RuleRangerTests::NewTransientObject<UEnsureNoEmptyContentFoldersAction>();
+    const auto ParentDirectory = Sandbox.MakeDirectory(TEXT("Parent"));
+    const auto ChildDirectory = Sandbox.MakeDirectory(TEXT("Parent/Child"));
+
+    if (RuleRangerTests::CreateProjectRuleFixture(*this, Fixture, ERuleRangerProjectActionTrigger::AT_Fix)
+        && TestNotNull(TEXT("EnsureNoEmptyContentFoldersAction should be created"), Action))
+    {
+        RuleRangerEnsureNoEmptyContentFoldersActionTests::ConfigureAction(Action, Sandbox);
+        Action->Apply(Fixture.ActionContext);
+
+        return TestTrue(TEXT("Fix mode should not add errors for deletable empty folders"),
+                        Fixture.ActionContext->GetErrorMessages().IsEmpty())
+            && TestEqual(TEXT("Fix mode should delete the child and then the parent that it left empty"),
+                         Fixture.ActionContext->GetInfoMessages().Num(),
+                         2)
+            && TestFalse(TEXT("Fix mode should delete the empty child directory"),
+                         IFileManager::Get().DirectoryExists(*ChildDirectory))
+            && TestFalse(TEXT("Fix mode should delete the parent directory once it is empty"),
+                         IFileManager::Get().DirectoryExists(*ParentDirectory));
+    }
+    else
+    {
+        return false;
+    }
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
     FRuleRangerEnsureNoEmptyContentFoldersActionFixRejectsFoldersWithFilesTest,
     "RuleRanger.ProjectActions.Path.EnsureNoEmptyContentFolders.FixRejectsFoldersWithFiles",
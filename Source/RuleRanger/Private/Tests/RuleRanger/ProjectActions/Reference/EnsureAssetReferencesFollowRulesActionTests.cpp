@@ -0,0 +1,122 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+    #include "Misc/AutomationTest.h"
+    #include "RuleRanger/ProjectActions/Reference/AssetReferenceRuleMatcher.h"
+    #include "RuleRanger/ProjectActions/Reference/EnsureAssetReferencesFollowRulesAction.h"
+    #include "Tests/RuleRanger/RuleRangerAutomationTestHelpers.h"
+
+namespace RuleRangerEnsureAssetReferencesFollowRulesActionTests
+{
+    FAssetReferenceRule MakeRule(const TCHAR* const Path,
+                                 const TArray<FString>& AllowedReferences,
+                                 const int32 Priority = 0,
+                                 const bool bIncludeSubfolders = true)
+    {
+        FAssetReferenceRule Rule;
+        Rule.Path = Path;
+        Rule.AllowedReferences = AllowedReferences;
+        Rule.Priority = Priority;
+        Rule.bIncludeSubfolders = bIncludeSubfolders;
+        return Rule;
+    }
+} // namespace RuleRangerEnsureAssetReferencesFollowRulesActionTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerEnsureAssetReferencesFollowRulesActionDefaultsTest,
+                                 "RuleRanger.ProjectActions.Reference.EnsureAssetReferencesFollowRules.Defaults",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerEnsureAssetReferencesFollowRulesActionDefaultsTest::RunTest(const FString&)
+{
+    const auto Action = RuleRangerTests::NewTransientObject<UEnsureAssetReferencesFollowRulesAction>();
+    if (TestNotNull(TEXT("EnsureAssetReferencesFollowRulesAction should be created"), Action))
+    {
+        return TestTrue(TEXT("Soft references should be checked by default"), Action->bCheckSoftReferences)
+            && TestTrue(TEXT("Default scan paths should contain /Game"), Action->ScanPaths.Contains(TEXT("/Game")))
+            && TestTrue(TEXT("Default ignored paths should contain /Script"),
+                        Action->IgnoredReferencePaths.Contains(TEXT("/Script")))
+            && TestTrue(TEXT("Default ignored paths should contain /Engine"),
+                        Action->IgnoredReferencePaths.Contains(TEXT("/Engine")));
+    }
+    else
+    {
+        return false;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRuleRangerEnsureAssetReferencesFollowRulesActionMatcherSubstitutesWildcardsTest,
+    "RuleRanger.ProjectActions.Reference.EnsureAssetReferencesFollowRules.MatcherSubstitutesWildcards",
+    RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerEnsureAssetReferencesFollowRulesActionMatcherSubstitutesWildcardsTest::RunTest(const FString&)
+{
+    using namespace RuleRangerEnsureAssetReferencesFollowRulesActionTests;
+
+    FRuleRangerAssetReferenceRuleMatcher Matcher;
+    Matcher.AddRule(MakeRule(TEXT("/Game/Characters/*"), { TEXT("/Game/Characters/$1"), TEXT("/Game/Shared") }));
+
+    const auto Policy = Matcher.FindPolicy(TEXT("/Game/Characters/Bob/Animations"));
+    if (TestNotNull(TEXT("A subfolder of a character should be governed by the rule"), Policy))
+    {
+        return TestTrue(TEXT("A character may reference its own folder"),
+                        FRuleRangerAssetReferenceRuleMatcher::IsReferenceAllowed(*Policy,
+                                                                                 TEXT("/Game/Characters/Bob/Rigs")))
+            && TestTrue(TEXT("A character may reference shared content"),
+                        FRuleRangerAssetReferenceRuleMatcher::IsReferenceAllowed(*Policy, TEXT("/Game/Shared/Fx")))
+            && TestFalse(TEXT("A character may not reference another character"),
+                         FRuleRangerAssetReferenceRuleMatcher::IsReferenceAllowed(*Policy,
+                                                                                  TEXT("/Game/Characters/Alice")))
+            && TestFalse(TEXT("A folder name prefix is not a match"),
+                         FRuleRangerAssetReferenceRuleMatcher::IsReferenceAllowed(*Policy,
+                                                                                  TEXT("/Game/Characters/Bobby")))
+            && TestNull(TEXT("A folder outside of the rule should not be governed"),
+                        Matcher.FindPolicy(TEXT("/Game/Environment")));
+    }
+    else
+    {
+        return false;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRuleRangerEnsureAssetReferencesFollowRulesActionMatcherPrefersHigherPriorityTest,
+    "RuleRanger.ProjectActions.Reference.EnsureAssetReferencesFollowRules.MatcherPrefersHigherPriority",
+    RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerEnsureAssetReferencesFollowRulesActionMatcherPrefersHigherPriorityTest::RunTest(const FString&)
+{
+    using namespace RuleRangerEnsureAssetReferencesFollowRulesActionTests;
+
+    FRuleRangerAssetReferenceRuleMatcher Matcher;
+    Matcher.AddRule(MakeRule(TEXT("/Game/Characters/*/Textures"), { TEXT("/Game/Characters/$1/Textures") }));
+    Matcher.AddRule(MakeRule(TEXT("/Game/Characters"), { TEXT("/Game/Characters") }, 10));
+    Matcher.AddRule(MakeRule(TEXT("/Game/Maps"), { TEXT("/Game") }, 0, false));
+
+    const auto TexturesPolicy = Matcher.FindPolicy(TEXT("/Game/Characters/Bob/Textures"));
+    const auto MapsPolicy = Matcher.FindPolicy(TEXT("/Game/Maps"));
+    if (TestNotNull(TEXT("Character textures should be governed"), TexturesPolicy)
+        && TestNotNull(TEXT("Maps should be governed"), MapsPolicy))
+    {
+        return TestEqual(TEXT("The higher priority rule should govern the folder"),
+                         TexturesPolicy->RulePath,
+                         TEXT("/Game/Characters"))
+            && TestNull(TEXT("A rule that excludes subfolders should not govern subfolders"),
+                        Matcher.FindPolicy(TEXT("/Game/Maps/Arena")));
+    }
+    else
+    {
+        return false;
+    }
+}
+
+#endif
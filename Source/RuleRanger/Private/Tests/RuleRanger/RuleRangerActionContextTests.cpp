@@ -120,4 +120,63 @@ bool FRuleRangerActionContextDryRunSemanticsTest::RunTest(const FString&)
     }
 }
 
+
+namespace RuleRangerActionContextTests
+{
+    class FCountingAnalysis final : public FRuleRangerObjectAnalysis
+    {
+    public:
+        explicit FCountingAnalysis(UObject* Object) : AnalyzedObject(Object) { ++ConstructionCount; }
+
+        static FName GetAnalysisName() { return FName(TEXT("CountingAnalysis")); }
+
+        inline static int32 ConstructionCount{ 0 };
+
+        UObject* AnalyzedObject{ nullptr };
+    };
+} // namespace RuleRangerActionContextTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerActionContextObjectAnalysisSharedTest,
+                                 "RuleRanger.Context.Action.ObjectAnalysisShared",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerActionContextObjectAnalysisSharedTest::RunTest(const FString&)
+{
+    using RuleRangerActionContextTests::FCountingAnalysis;
+
+    RuleRangerTests::FRuleFixture Fixture;
+    if (RuleRangerTests::CreateRuleFixture(*this, Fixture, TEXT("ActionContextAnalysisObject")))
+    {
+        const auto OtherObject =
+            RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("ActionContextOtherObject"));
+        FCountingAnalysis::ConstructionCount = 0;
+
+        const auto First = &Fixture.ActionContext->GetObjectAnalysis<FCountingAnalysis>(Fixture.Object);
+        FRuleRangerActionContextTestAccessor::ClearContext(Fixture.ActionContext);
+        const auto Second = &Fixture.ActionContext->GetObjectAnalysis<FCountingAnalysis>(Fixture.Object);
+        const auto bSharedAcrossClear = TestEqual(TEXT("Analysis should survive clearing the context"), Second, First)
+            && TestEqual(TEXT("Analysis should be computed once"), FCountingAnalysis::ConstructionCount, 1);
+
+        const auto Other = &Fixture.ActionContext->GetObjectAnalysis<FCountingAnalysis>(OtherObject);
+        const auto bRecomputedForOtherObject =
+            TestEqual(TEXT("Analysis should be recomputed for a different object"),
+                      FCountingAnalysis::ConstructionCount,
+                      2)
+            && TestEqual(TEXT("Analysis should analyze the different object"),
+                         Other->AnalyzedObject,
+                         static_cast<UObject*>(OtherObject));
+
+        Fixture.ActionContext->InvalidateObjectAnalyses();
+        Fixture.ActionContext->GetObjectAnalysis<FCountingAnalysis>(OtherObject);
+        const auto bRecomputedAfterInvalidate = TestEqual(TEXT("Analysis should be recomputed after invalidation"),
+                                                          FCountingAnalysis::ConstructionCount,
+                                                          3);
+
+        return bSharedAcrossClear && bRecomputedForOtherObject && bRecomputedAfterInvalidate;
+    }
+    else
+    {
+        return false;
+    }
+}
+
 #endif
@@ -256,6 +256,26 @@ public:
     virtual void Apply(URuleRangerActionContext* ActionContext, UObject* Object) override {}
 };
 
+UCLASS(NotBlueprintable, DisplayName = "Automation Preparing Test Action")
+class URuleRangerAutomationPreparingTestAction final : public URuleRangerAction
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(EditAnywhere)
+    TSubclassOf<UObject> ExpectedType{ UObject::StaticClass() };
+
+    TArray<UObject*> PreparedObjects;
+
+    virtual void Apply(URuleRangerActionContext* ActionContext, UObject* Object) override {}
+
+    virtual UClass* GetExpectedType() const override { return ExpectedType.Get(); }
+
+    virtual bool ShouldPrepareForFix() const override { return true; }
+
+    virtual void PrepareForFix(const TConstArrayView<UObject*> Objects) override { PreparedObjects.Append(Objects); }
+};
+
 UCLASS(NotBlueprintable, DisplayName = "Automation Action Fallback")
 class URuleRangerAutomationActionFallback final : public URuleRangerAction
 {
@@ -280,12 +300,17 @@ public:
     UPROPERTY(EditAnywhere)
     FString Message{ TEXT("Automation test project action message") };
 
+    UPROPERTY(EditAnywhere)
+    bool bConcurrencySafe{ false };
+
     void ResetApplyCount() { ApplyCount = 0; }
 
     int32 GetApplyCount() const { return ApplyCount; }
 
     ERuleRangerProjectActionTrigger GetLastTrigger() const { return LastTrigger; }
 
+    virtual bool IsConcurrencySafe() const override { return bConcurrencySafe; }
+
     virtual void Apply(URuleRangerProjectActionContext* ActionContext) override
     {
         ApplyCount++;
@@ -452,6 +477,9 @@ public:
         return bResult;
     }
 
+    // The call count only observes the evaluation so the matcher can be reordered and share results
+    virtual bool IsSideEffectFree() const override { return true; }
+
 private:
     mutable int32 CallCount{ 0 };
 };
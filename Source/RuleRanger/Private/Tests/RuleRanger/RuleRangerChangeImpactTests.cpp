@@ -0,0 +1,198 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+    #include "Engine/Blueprint.h"
+    #include "Engine/DataTable.h"
+    #include "Engine/Texture.h"
+    #include "Engine/Texture2D.h"
+    #include "Misc/AutomationTest.h"
+    #include "RuleRanger/RuleRangerChangeImpact.h"
+    #include "RuleRangerConfig.h"
+    #include "RuleRangerRule.h"
+    #include "RuleRangerRuleSet.h"
+    #include "Tests/RuleRanger/RuleRangerAutomationTestHelpers.h"
+    #include "Tests/RuleRanger/RuleRangerAutomationTestTypes.h"
+
+namespace RuleRangerChangeImpactTests
+{
+    FDirectoryPath MakeDir(const TCHAR* const Path)
+    {
+        FDirectoryPath Dir;
+        Dir.Path = Path;
+        return Dir;
+    }
+
+    FName GetPackageName(const UObject* Object)
+    {
+        return Object->GetPackage()->GetFName();
+    }
+} // namespace RuleRangerChangeImpactTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerChangeImpactIndexesRuleDependenciesTest,
+                                 "RuleRanger.ChangeImpact.IndexesRuleDependencies",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerChangeImpactIndexesRuleDependenciesTest::RunTest(const FString&)
+{
+    using namespace RuleRangerChangeImpactTests;
+
+    const auto Config = RuleRangerTests::NewPackagedObject<URuleRangerConfig>(
+        TEXT("/Game/Developers/Tests/RuleRanger/ChangeImpact/Config"),
+        TEXT("Config"));
+    const auto RuleSet = RuleRangerTests::NewPackagedObject<URuleRangerRuleSet>(
+        TEXT("/Game/Developers/Tests/RuleRanger/ChangeImpact/RuleSet"),
+        TEXT("RuleSet"));
+    const auto Rule = RuleRangerTests::NewPackagedObject<URuleRangerRule>(
+        TEXT("/Game/Developers/Tests/RuleRanger/ChangeImpact/Rule"),
+        TEXT("Rule"));
+    const auto OtherRule = RuleRangerTests::NewPackagedObject<URuleRangerRule>(
+        TEXT("/Game/Developers/Tests/RuleRanger/ChangeImpact/OtherRule"),
+        TEXT("OtherRule"));
+    const auto DataTable = RuleRangerTests::NewPackagedObject<UDataTable>(
+        TEXT("/Game/Developers/Tests/RuleRanger/ChangeImpact/DataTable"),
+        TEXT("DataTable"));
+    const auto Unrelated = RuleRangerTests::NewPackagedObject<URuleRangerAutomationTestObject>(
+        TEXT("/Game/Developers/Tests/RuleRanger/ChangeImpact/Unrelated"),
+        TEXT("Unrelated"));
+    if (!TestNotNull(TEXT("Config should be created"), Config)
+        || !TestNotNull(TEXT("RuleSet should be created"), RuleSet)
+        || !TestNotNull(TEXT("Rule should be created"), Rule)
+        || !TestNotNull(TEXT("OtherRule should be created"), OtherRule)
+        || !TestNotNull(TEXT("DataTable should be created"), DataTable)
+        || !TestNotNull(TEXT("Unrelated object should be created"), Unrelated))
+    {
+        return false;
+    }
+
+    RuleSet->Rules.Add(Rule);
+    RuleSet->Rules.Add(OtherRule);
+    Config->RuleSets.Add(RuleSet);
+    Config->DataTables.Add(DataTable);
+
+    FRuleRangerChangeImpact Impact;
+    Impact.Build({ TWeakObjectPtr<URuleRangerConfig>(Config) });
+
+    TArray<const URuleRangerRule*> RulesImpactedByTable;
+    Impact.CollectImpactedRules({ GetPackageName(DataTable) }, RulesImpactedByTable);
+    TArray<const URuleRangerRule*> RulesImpactedByRule;
+    Impact.CollectImpactedRules({ GetPackageName(Rule) }, RulesImpactedByRule);
+    TArray<const URuleRangerRule*> RulesImpactedByUnrelated;
+    Impact.CollectImpactedRules({ GetPackageName(Unrelated) }, RulesImpactedByUnrelated);
+
+    return TestEqual(TEXT("Each rule should be indexed"), Impact.Num(), 2)
+        && TestTrue(TEXT("The config should be a dependency"), Impact.IsDependency(GetPackageName(Config)))
+        && TestTrue(TEXT("The rule set should be a dependency"), Impact.IsDependency(GetPackageName(RuleSet)))
+        && TestTrue(TEXT("The rule should be a dependency"), Impact.IsDependency(GetPackageName(Rule)))
+        && TestTrue(TEXT("The DataTable should be a dependency"), Impact.IsDependency(GetPackageName(DataTable)))
+        && TestFalse(TEXT("An unrelated asset should not be a dependency"),
+                     Impact.IsDependency(GetPackageName(Unrelated)))
+        && TestEqual(TEXT("A DataTable of the config should impact every rule"), RulesImpactedByTable.Num(), 2)
+        && TestEqual(TEXT("A rule should only impact itself"), RulesImpactedByRule.Num(), 1)
+        && TestTrue(TEXT("The changed rule should be impacted"), RulesImpactedByRule.Contains(Rule))
+        && TestTrue(TEXT("An unrelated asset should impact no rule"), RulesImpactedByUnrelated.IsEmpty());
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerChangeImpactFiltersAssetsByDirAndExpectedTypeTest,
+                                 "RuleRanger.ChangeImpact.FiltersAssetsByDirAndExpectedType",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerChangeImpactFiltersAssetsByDirAndExpectedTypeTest::RunTest(const FString&)
+{
+    using namespace RuleRangerChangeImpactTests;
+
+    const auto Config = RuleRangerTests::NewTransientObject<URuleRangerConfig>();
+    const auto Rule = RuleRangerTests::NewTransientObject<URuleRangerRule>();
+    const auto Action = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestAction>(Rule);
+    if (!TestNotNull(TEXT("Config should be created"), Config) || !TestNotNull(TEXT("Rule should be created"), Rule)
+        || !TestNotNull(TEXT("Action should be created"), Action))
+    {
+        return false;
+    }
+
+    Config->Dirs.Add(MakeDir(TEXT("/Game/Characters/")));
+
+    FARFilter Filter;
+    const auto bNoActionsFilter = FRuleRangerChangeImpact::BuildAssetFilter(Config, Rule, Filter);
+
+    Rule->Actions.Add(Action);
+    Action->ExpectedType = UTexture::StaticClass();
+    const auto bTypedFilter = FRuleRangerChangeImpact::BuildAssetFilter(Config, Rule, Filter);
+    const auto TypedFilter = Filter;
+
+    Action->ExpectedType = UObject::StaticClass();
+    const auto bUntypedFilter = FRuleRangerChangeImpact::BuildAssetFilter(Config, Rule, Filter);
+
+    return TestFalse(TEXT("A rule without actions can not apply to any asset"), bNoActionsFilter)
+        && TestTrue(TEXT("A rule with a typed action should produce a filter"), bTypedFilter)
+        && TestTrue(TEXT("The filter should select the config directory"),
+                    TypedFilter.PackagePaths.Contains(FName(TEXT("/Game/Characters"))))
+        && TestTrue(TEXT("The filter should include subdirectories"), TypedFilter.bRecursivePaths)
+        && TestTrue(TEXT("The filter should select the expected type"),
+                    TypedFilter.ClassPaths.Contains(UTexture::StaticClass()->GetClassPathName()))
+        && TestTrue(TEXT("The filter should select blueprints"),
+                    TypedFilter.ClassPaths.Contains(UBlueprint::StaticClass()->GetClassPathName()))
+        && TestTrue(TEXT("The filter should include subclasses"), TypedFilter.bRecursiveClasses)
+        && TestTrue(TEXT("A rule with an untyped action should produce a filter"), bUntypedFilter)
+        && TestTrue(TEXT("An untyped action should not restrict the type"), Filter.ClassPaths.IsEmpty());
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerChangeImpactRemovesUntargetedAssetsTest,
+                                 "RuleRanger.ChangeImpact.RemovesUntargetedAssets",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerChangeImpactRemovesUntargetedAssetsTest::RunTest(const FString&)
+{
+    using namespace RuleRangerChangeImpactTests;
+
+    const auto Config = RuleRangerTests::NewTransientObject<URuleRangerConfig>();
+    const auto RuleSet = RuleRangerTests::NewTransientObject<URuleRangerRuleSet>();
+    const auto Rule = RuleRangerTests::NewTransientObject<URuleRangerRule>();
+    const auto Action = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestAction>(Rule);
+    if (!TestNotNull(TEXT("Config should be created"), Config)
+        || !TestNotNull(TEXT("RuleSet should be created"), RuleSet)
+        || !TestNotNull(TEXT("Rule should be created"), Rule)
+        || !TestNotNull(TEXT("Action should be created"), Action))
+    {
+        return false;
+    }
+
+    Action->ExpectedType = UTexture::StaticClass();
+    Rule->Actions.Add(Action);
+    RuleSet->Rules.Add(Rule);
+    Config->RuleSets.Add(RuleSet);
+    Config->Dirs.Add(MakeDir(TEXT("/Game/Characters")));
+
+    FRuleRangerChangeImpact Impact;
+    Impact.Build({ TWeakObjectPtr<URuleRangerConfig>(Config) });
+
+    const FAssetData Texture(TEXT("/Game/Characters/T_Bob"),
+                             TEXT("/Game/Characters"),
+                             TEXT("T_Bob"),
+                             UTexture2D::StaticClass()->GetClassPathName());
+    const FAssetData Table(TEXT("/Game/Characters/DT_Bob"),
+                           TEXT("/Game/Characters"),
+                           TEXT("DT_Bob"),
+                           UDataTable::StaticClass()->GetClassPathName());
+    const FAssetData OtherTexture(TEXT("/Game/Maps/T_Arena"),
+                                  TEXT("/Game/Maps"),
+                                  TEXT("T_Arena"),
+                                  UTexture2D::StaticClass()->GetClassPathName());
+    TArray<FAssetData> Assets{ Texture, Table, OtherTexture };
+    Impact.RemoveUntargetedAssets(Assets);
+
+    return TestEqual(TEXT("Only the asset targeted by the rule should remain"), Assets.Num(), 1)
+        && TestEqual(TEXT("A subclass of the expected type in the config directory should remain"),
+                     Assets[0].PackageName,
+                     Texture.PackageName);
+}
+
+#endif
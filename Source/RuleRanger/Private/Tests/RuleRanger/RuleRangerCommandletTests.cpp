@@ -16,13 +16,19 @@
     #include "AssetRegistry/AssetRegistryModule.h"
     #include "Dom/JsonObject.h"
     #include "Engine/Blueprint.h"
+    #include "IPAddress.h"
+    #include "Interfaces/IPv4/IPv4Address.h"
     #include "Misc/AutomationTest.h"
+    #include "Misc/FileHelper.h"
     #include "Misc/PackageName.h"
     #include "RuleRanger/RuleRangerUtilities.h"
     #include "RuleRanger/UI/Commandlet/RuleRangerCommandlet.h"
+    #include "RuleRanger/UI/Commandlet/RuleRangerCommandletServer.h"
     #include "RuleRangerActionContext.h"
     #include "RuleRangerProjectRule.h"
     #include "RuleRangerRuleSet.h"
+    #include "SocketSubsystem.h"
+    #include "Sockets.h"
     #include "Tests/RuleRanger/RuleRangerAutomationTestHelpers.h"
     #include "UObject/Package.h"
     #include "UObject/SavePackage.h"
@@ -58,6 +64,14 @@ public:
         Commandlet->DeriveAllowlistPackages(Params, AllowlistPackages);
     }
 
+    static bool DeriveChangedPackages(URuleRangerCommandlet* const Commandlet,
+                                      const FString& ChangedSince,
+                                      const TArray<FString>& Roots,
+                                      TArray<FName>& ChangedPackages)
+    {
+        return Commandlet->DeriveChangedPackages(ChangedSince, Roots, ChangedPackages);
+    }
+
     static void SetCurrentAsset(URuleRangerCommandlet* const Commandlet, const FAssetData& Asset)
     {
         Commandlet->CurrentAsset = Asset;
@@ -81,6 +95,35 @@ public:
 
     static void ResetState(URuleRangerCommandlet* const Commandlet) { Commandlet->ResetState(); }
 
+    static void OnPackageMarkedDirty(URuleRangerCommandlet* const Commandlet, UPackage* const Package)
+    {
+        Commandlet->OnPackageMarkedDirty(Package, false);
+    }
+
+    static void SaveDirtyPackages(URuleRangerCommandlet* const Commandlet) { Commandlet->SaveDirtyPackages(); }
+
+    static int32 GetDirtyPackageCount(const URuleRangerCommandlet* const Commandlet)
+    {
+        return Commandlet->DirtyPackages.Num();
+    }
+
+    static int32 GetNumPackagesSaved(const URuleRangerCommandlet* const Commandlet)
+    {
+        return Commandlet->NumPackagesSaved;
+    }
+
+    static int32 GetNumPackagesFailedToSave(const URuleRangerCommandlet* const Commandlet)
+    {
+        return Commandlet->NumPackagesFailedToSave;
+    }
+
+    static bool FindDisallowedServerOption(const URuleRangerCommandlet* const Commandlet,
+                                           const FString& Request,
+                                           FString& OutOption)
+    {
+        return Commandlet->FindDisallowedServerOption(Request, OutOption);
+    }
+
     static void ExecuteProjectRulesForConfigs(URuleRangerCommandlet* const Commandlet,
                                               const TConstArrayView<TWeakObjectPtr<URuleRangerConfig>> Configs,
                                               const bool bFix)
@@ -241,6 +284,43 @@ namespace RuleRangerCommandletTests
         }
         return nullptr;
     }
+
+    static FRuleRangerCommandletServer::EServeResult SendServerRequest(FRuleRangerCommandletServer& Server,
+                                                                       const FString& Request,
+                                                                       FString& OutResponse)
+    {
+        const auto SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+        const auto Address = SocketSubsystem->CreateInternetAddr();
+        Address->SetIp(FIPv4Address(127, 0, 0, 1).Value);
+        Address->SetPort(Server.GetPort());
+
+        auto Result{ FRuleRangerCommandletServer::EServeResult::Idle };
+        if (const auto Client = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("RuleRangerTestClient"), false))
+        {
+            if (Client->Connect(*Address))
+            {
+                // The request and response are small enough to be buffered so a single thread can play both roles
+                const FTCHARToUTF8 Converted(*(Request + TEXT("\n")));
+                int32 BytesSent{ 0 };
+                Client->Send(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length(), BytesSent);
+                Result = Server.ServeNextConnection(FTimespan::FromSeconds(5));
+
+                TArray<uint8> Bytes;
+                uint8 Buffer[1024];
+                int32 BytesRead{ 0 };
+                while (Client->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromSeconds(5))
+                       && Client->Recv(Buffer, sizeof(Buffer), BytesRead) && BytesRead > 0)
+                {
+                    Bytes.Append(Buffer, BytesRead);
+                }
+                const FUTF8ToTCHAR Response(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+                OutResponse = FString(Response.Length(), Response.Get()).TrimEnd();
+            }
+            Client->Close();
+            SocketSubsystem->DestroySocket(Client);
+        }
+        return Result;
+    }
 } // namespace RuleRangerCommandletTests
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerCommandletDerivesAllowlistParametersTest,
@@ -271,6 +351,51 @@ bool FRuleRangerCommandletDerivesAllowlistParametersTest::RunTest(const FString&
         && TestEqual(TEXT("The second package should be preserved"), Packages[1], FString(TEXT("/Game/B")));
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerCommandletDerivesChangedPackagesTest,
+                                 "RuleRanger.Commandlet.Parameters.DerivesChangedPackages",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerCommandletDerivesChangedPackagesTest::RunTest(const FString&)
+{
+    const auto Commandlet = NewObject<URuleRangerCommandlet>();
+    if (!TestNotNull(TEXT("Commandlet should be created"), Commandlet))
+    {
+        return false;
+    }
+
+    const auto Path = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("RuleRanger"), TEXT("Changed.txt"));
+    FFileHelper::SaveStringToFile(TEXT("/Game/Characters/Bob\n"
+                                       "Content/Maps/Arena.umap\n"
+                                       "Source/Game/Game.cpp\n"
+                                       "\n"
+                                       "/Game/Characters/Bob\n"),
+                                  *Path);
+
+    TArray<FName> FromFile;
+    const auto bFromFile =
+        FRuleRangerCommandletTestAccessor::DeriveChangedPackages(Commandlet, Path, { TEXT("/Game") }, FromFile);
+    IFileManager::Get().Delete(*Path);
+
+    TArray<FName> FromFuture;
+    const auto bFromFuture = FRuleRangerCommandletTestAccessor::DeriveChangedPackages(Commandlet,
+                                                                                      TEXT("2999-01-01T00:00:00Z"),
+                                                                                      { TEXT("/Game") },
+                                                                                      FromFuture);
+
+    TArray<FName> FromInvalid;
+    AddExpectedMessage(TEXT("is neither an existing file nor a time"), EAutomationExpectedMessageFlags::Contains, 1);
+    const auto bFromInvalid = FRuleRangerCommandletTestAccessor::DeriveChangedPackages(Commandlet,
+                                                                                       TEXT("NotAFileOrTime"),
+                                                                                       { TEXT("/Game") },
+                                                                                       FromInvalid);
+
+    return TestTrue(TEXT("A file list should be parsed"), bFromFile)
+        && TestTrue(TEXT("Package names and package files should be parsed once each"),
+                    FromFile == TArray<FName>{ TEXT("/Game/Characters/Bob"), TEXT("/Game/Maps/Arena") })
+        && TestTrue(TEXT("A time should be parsed"), bFromFuture)
+        && TestTrue(TEXT("No package should be modified after a future time"), FromFuture.IsEmpty())
+        && TestFalse(TEXT("A value that is neither a file nor a time should fail"), bFromInvalid);
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerCommandletOnRuleAppliedAggregatesJsonResultsTest,
                                  "RuleRanger.Commandlet.Results.OnRuleAppliedAggregatesJson",
                                  RuleRangerTests::AutomationTestFlags)
@@ -423,4 +548,114 @@ bool FRuleRangerCommandletPathAllowlistUsesEditorFacingAssetTest::RunTest(const
         && RuleRangerCommandletTests::VerifyRepresentativeSelection(*this, Fixture, true);
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerCommandletSaveSkipsTransientPackagesTest,
+                                 "RuleRanger.Commandlet.Save.SkipsTransientPackages",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerCommandletSaveSkipsTransientPackagesTest::RunTest(const FString&)
+{
+    const auto Commandlet = NewObject<URuleRangerCommandlet>();
+    const FString PackageName =
+        FString::Printf(TEXT("%s/Commandlet/SaveTransientPackage"), RuleRangerTests::GetRuleRangerTestMountRoot());
+    const auto Object =
+        RuleRangerTests::NewPackagedObject<URuleRangerAutomationTestObject>(*PackageName, TEXT("SaveTransient"));
+    if (!TestNotNull(TEXT("Commandlet should be created"), Commandlet)
+        || !TestNotNull(TEXT("Packaged object should be created"), Object))
+    {
+        return false;
+    }
+
+    const auto Package = Object->GetPackage();
+    Package->SetDirtyFlag(true);
+    FRuleRangerCommandletTestAccessor::OnPackageMarkedDirty(Commandlet, Package);
+    FRuleRangerCommandletTestAccessor::OnPackageMarkedDirty(Commandlet, Package);
+    const auto TrackedCount = FRuleRangerCommandletTestAccessor::GetDirtyPackageCount(Commandlet);
+
+    FRuleRangerCommandletTestAccessor::SaveDirtyPackages(Commandlet);
+
+    return TestEqual(TEXT("A package marked dirty repeatedly should be tracked once"), TrackedCount, 1)
+        && TestEqual(TEXT("Saving should clear the tracked packages"),
+                     FRuleRangerCommandletTestAccessor::GetDirtyPackageCount(Commandlet),
+                     0)
+        && TestEqual(TEXT("Transient packages should not be saved"),
+                     FRuleRangerCommandletTestAccessor::GetNumPackagesSaved(Commandlet),
+                     0)
+        && TestEqual(TEXT("Skipping a transient package should not be a failure"),
+                     FRuleRangerCommandletTestAccessor::GetNumPackagesFailedToSave(Commandlet),
+                     0)
+        && TestEqual(TEXT("Skipping a transient package should not report an error"),
+                     FRuleRangerCommandletTestAccessor::GetNumErrors(Commandlet),
+                     0);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerCommandletServerServesRequestsUntilShutdownTest,
+                                 "RuleRanger.Commandlet.Server.ServesRequestsUntilShutdown",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerCommandletServerServesRequestsUntilShutdownTest::RunTest(const FString&)
+{
+    using EServeResult = FRuleRangerCommandletServer::EServeResult;
+
+    TArray<FString> Requests;
+    FRuleRangerCommandletServer Server(0, [&Requests](const FString& Params) {
+        Requests.Add(Params);
+        return FString(TEXT("{\"ExitCode\":0}"));
+    });
+    if (!TestTrue(TEXT("The server should listen on an ephemeral port"), Server.Start()))
+    {
+        return false;
+    }
+
+    FString ScanResponse;
+    const auto ScanResult =
+        RuleRangerCommandletTests::SendServerRequest(Server, TEXT("-packages=/Game/A -quiet"), ScanResponse);
+    FString ShutdownResponse;
+    const auto ShutdownResult =
+        RuleRangerCommandletTests::SendServerRequest(Server, TEXT("-shutdown"), ShutdownResponse);
+
+    return TestTrue(TEXT("The scan request should be served"), EServeResult::Served == ScanResult)
+        && TestEqual(TEXT("The handler should be invoked once"), Requests.Num(), 1)
+        && TestEqual(TEXT("The handler should receive the request parameters"),
+                     Requests.IsEmpty() ? FString() : Requests[0],
+                     FString(TEXT("-packages=/Game/A -quiet")))
+        && TestEqual(TEXT("The response should be returned to the client"),
+                     ScanResponse,
+                     FString(TEXT("{\"ExitCode\":0}")))
+        && TestTrue(TEXT("The shutdown request should stop the server"), EServeResult::Shutdown == ShutdownResult)
+        && TestEqual(TEXT("The shutdown request should not invoke the handler"), Requests.Num(), 1)
+        && TestEqual(TEXT("The shutdown request should be acknowledged"),
+                     ShutdownResponse,
+                     FString(TEXT("{\"Shutdown\":true}")));
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerCommandletServerRejectsWriteOptionsTest,
+                                 "RuleRanger.Commandlet.Server.RejectsWriteOptions",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerCommandletServerRejectsWriteOptionsTest::RunTest(const FString&)
+{
+    const auto Commandlet = NewObject<URuleRangerCommandlet>();
+    if (!TestNotNull(TEXT("Commandlet should be created"), Commandlet))
+    {
+        return false;
+    }
+
+    FString ScanOption;
+    const auto bScanAllowed = !FRuleRangerCommandletTestAccessor::FindDisallowedServerOption(
+        Commandlet,
+        TEXT("-packages=/Game/A -exitOnWarning -quiet"),
+        ScanOption);
+    FString FixOption;
+    const auto bFixRejected =
+        FRuleRangerCommandletTestAccessor::FindDisallowedServerOption(Commandlet, TEXT("-paths=/Game -fix"), FixOption);
+    FString ReportOption;
+    const auto bReportRejected =
+        FRuleRangerCommandletTestAccessor::FindDisallowedServerOption(Commandlet,
+                                                                      TEXT("-paths=/Game -report=C:/Out.json"),
+                                                                      ReportOption);
+
+    return TestTrue(TEXT("A request that only reports should be allowed"), bScanAllowed)
+        && TestTrue(TEXT("A request with -fix should be rejected"), bFixRejected)
+        && TestEqual(TEXT("The rejected switch should be identified"), FixOption, FString(TEXT("fix")))
+        && TestTrue(TEXT("A request that writes a report file should be rejected"), bReportRejected)
+        && TestEqual(TEXT("The rejected value should be identified"), ReportOption, FString(TEXT("report")));
+}
+
 #endif
@@ -0,0 +1,119 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+    #include "Misc/AutomationTest.h"
+    #include "RuleRanger/RuleRangerExplainTrace.h"
+    #include "RuleRangerRule.h"
+    #include "Tests/RuleRanger/RuleRangerAutomationTestHelpers.h"
+    #include "Tests/RuleRanger/RuleRangerAutomationTestTypes.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerExplainTraceBuildsTreeTest,
+                                 "RuleRanger.ExplainTrace.BuildsTree",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerExplainTraceBuildsTreeTest::RunTest(const FString&)
+{
+    FRuleRangerExplainTrace Trace;
+    {
+        // Decisions made while no trace is active are not recorded
+        const FRuleRangerExplainTrace::FNodeScope IgnoredNode(TEXT("Config"), nullptr);
+        FRuleRangerExplainTrace::Note(TEXT("Exclusion"), TEXT("Ignored"), TEXT("Ignored"));
+    }
+    {
+        const FRuleRangerExplainTrace::FScope TraceScope(Trace);
+        const FRuleRangerExplainTrace::FNodeScope ConfigNode(TEXT("Config"), nullptr);
+        FRuleRangerExplainTrace::Note(TEXT("Exclusion"), TEXT("Legacy assets"), TEXT("Excludes /Game/Rule"));
+        {
+            const FRuleRangerExplainTrace::FNodeScope RuleNode(TEXT("Rule"), nullptr);
+            FRuleRangerExplainTrace::SetOutcome(TEXT("Skipped: excluded"));
+        }
+        FRuleRangerExplainTrace::SetOutcome(TEXT("Done"));
+    }
+
+    const auto& Nodes = Trace.GetNodes();
+    if (TestEqual(TEXT("Only the decisions made while the trace is active should be recorded"), Nodes.Num(), 3)
+        && TestEqual(TEXT("The trace should have a single root"), Trace.GetRoots().Num(), 1))
+    {
+        const auto& Root = Nodes[Trace.GetRoots()[0]];
+        return TestEqual(TEXT("The root should be the config"), Root.Kind, FString(TEXT("Config")))
+            && TestEqual(TEXT("The outcome should be set on the current node"), Root.Outcome, FString(TEXT("Done")))
+            && TestTrue(TEXT("The root should be timed"), Root.Seconds >= 0.0)
+            && TestTrue(TEXT("The notes and nested nodes should be children"), Root.Children == TArray<int32>{ 1, 2 })
+            && TestTrue(TEXT("A note should not be timed"), Nodes[1].Seconds < 0.0)
+            && TestEqual(TEXT("The nested node should have its own outcome"),
+                         Nodes[2].Outcome,
+                         FString(TEXT("Skipped: excluded")))
+            && TestTrue(TEXT("The text should indent children"),
+                        Trace.ToText().Contains(TEXT("\n  Exclusion Legacy assets: Excludes /Game/Rule\n")))
+            && TestEqual(TEXT("The JSON should contain the root"), Trace.ToJson().Num(), 1);
+    }
+    else
+    {
+        return false;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerExplainTraceRecordsFailedMatcherTest,
+                                 "RuleRanger.ExplainTrace.RecordsFailedMatcher",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerExplainTraceRecordsFailedMatcherTest::RunTest(const FString&)
+{
+    RuleRangerTests::FRuleFixture Fixture;
+    if (RuleRangerTests::CreateRuleFixture(*this, Fixture))
+    {
+        const auto Matcher = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(Fixture.Rule);
+        const auto Action = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestAction>(Fixture.Rule);
+        if (TestNotNull(TEXT("Matcher should be created"), Matcher)
+            && TestNotNull(TEXT("Action should be created"), Action))
+        {
+            Matcher->bResult = false;
+            Fixture.Rule->Matchers = { Matcher };
+            Fixture.Rule->Actions = { Action };
+
+            FRuleRangerExplainTrace Trace;
+            {
+                const FRuleRangerExplainTrace::FScope TraceScope(Trace);
+                const FRuleRangerExplainTrace::FNodeScope RuleNode(TEXT("Rule"), Fixture.Rule);
+                Fixture.Rule->Match(Fixture.ActionContext, Fixture.Object);
+            }
+
+            const auto& Nodes = Trace.GetNodes();
+            if (TestEqual(TEXT("The rule and the matcher should be recorded"), Nodes.Num(), 2))
+            {
+                return TestTrue(TEXT("The rule should name the matcher that did not match"),
+                                Nodes[0].Outcome.Contains(Matcher->GetName()))
+                    && TestEqual(TEXT("The matcher should be a child of the rule"),
+                                 Nodes[1].Kind,
+                                 FString(TEXT("Matcher")))
+                    && TestEqual(TEXT("The matcher should record the result"),
+                                 Nodes[1].Outcome,
+                                 FString(TEXT("Did not match")));
+            }
+            else
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+    else
+    {
+        return false;
+    }
+}
+
+#endif
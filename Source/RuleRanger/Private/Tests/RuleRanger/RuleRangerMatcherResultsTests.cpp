@@ -0,0 +1,178 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+    #include "Misc/AutomationTest.h"
+    #include "RuleRanger/Matchers/Logic/AndMatcher.h"
+    #include "RuleRanger/Matchers/Name/NamePrefixMatcher.h"
+    #include "RuleRanger/RuleRangerMatcherResults.h"
+    #include "RuleRangerRule.h"
+    #include "Tests/RuleRanger/RuleRangerAutomationTestHelpers.h"
+    #include "Tests/RuleRanger/RuleRangerAutomationTestTypes.h"
+
+namespace RuleRangerMatcherResultsTests
+{
+    UNamePrefixMatcher* NewNamePrefixMatcher(FAutomationTestBase& Test, const TCHAR* const Prefix)
+    {
+        const auto Matcher = RuleRangerTests::NewTransientObject<UNamePrefixMatcher>();
+        if (Test.TestNotNull(TEXT("Name prefix matcher should be created"), Matcher)
+            && RuleRangerTests::SetPropertyValue(Test, Matcher, TEXT("Prefix"), FString(Prefix)))
+        {
+            return Matcher;
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+} // namespace RuleRangerMatcherResultsTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerMatcherResultsSharesIdsByStructureTest,
+                                 "RuleRanger.MatcherResults.SharesIdsByStructure",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerMatcherResultsSharesIdsByStructureTest::RunTest(const FString&)
+{
+    using namespace RuleRangerMatcherResultsTests;
+
+    const auto Matcher = NewNamePrefixMatcher(*this, TEXT("T_"));
+    const auto EqualMatcher = NewNamePrefixMatcher(*this, TEXT("T_"));
+    const auto OtherCaseMatcher = NewNamePrefixMatcher(*this, TEXT("t_"));
+    const auto Parent = RuleRangerTests::NewTransientObject<UAndMatcher>();
+    const auto EqualParent = RuleRangerTests::NewTransientObject<UAndMatcher>();
+    if (Matcher && EqualMatcher && OtherCaseMatcher && TestNotNull(TEXT("Parent should be created"), Parent)
+        && TestNotNull(TEXT("Equal parent should be created"), EqualParent)
+        && RuleRangerTests::SetPropertyValue(*this,
+                                             Parent,
+                                             TEXT("Matchers"),
+                                             TArray<TObjectPtr<URuleRangerMatcher>>{ Matcher }))
+    {
+        const auto bEqualParentsBeforeChildren = FRuleRangerMatcherResults::GetStructuralId(Parent)
+            == FRuleRangerMatcherResults::GetStructuralId(EqualParent);
+        if (RuleRangerTests::SetPropertyValue(*this,
+                                              EqualParent,
+                                              TEXT("Matchers"),
+                                              TArray<TObjectPtr<URuleRangerMatcher>>{ EqualMatcher }))
+        {
+            // The property was set directly rather than edited so the ids are discarded as an edit would
+            FRuleRangerMatcherResults::ResetStructuralIds();
+            return TestEqual(TEXT("Matchers with the same configuration should share a structural id"),
+                             FRuleRangerMatcherResults::GetStructuralId(Matcher),
+                             FRuleRangerMatcherResults::GetStructuralId(EqualMatcher))
+                && TestNotEqual(TEXT("Configuration that differs by case should not share a structural id"),
+                                FRuleRangerMatcherResults::GetStructuralId(Matcher),
+                                FRuleRangerMatcherResults::GetStructuralId(OtherCaseMatcher))
+                && TestFalse(TEXT("Parents with different children should not share a structural id"),
+                             bEqualParentsBeforeChildren)
+                && TestEqual(TEXT("Parents should be compared by the structure of their children"),
+                             FRuleRangerMatcherResults::GetStructuralId(Parent),
+                             FRuleRangerMatcherResults::GetStructuralId(EqualParent));
+        }
+        else
+        {
+            return false;
+        }
+    }
+    else
+    {
+        return false;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerMatcherResultsDiscardsResultsWithStructuralIdsTest,
+                                 "RuleRanger.MatcherResults.DiscardsResultsWithStructuralIds",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerMatcherResultsDiscardsResultsWithStructuralIdsTest::RunTest(const FString&)
+{
+    const auto Matcher = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>();
+    const auto OtherMatcher = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>();
+    const auto Object =
+        RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("MatcherResultsObject"));
+    if (TestNotNull(TEXT("Matcher should be created"), Matcher)
+        && TestNotNull(TEXT("Other matcher should be created"), OtherMatcher)
+        && TestNotNull(TEXT("Object should be created"), Object)
+        && RuleRangerTests::SetPropertyValue(*this, OtherMatcher, TEXT("bResult"), false))
+    {
+        FRuleRangerMatcherResults Results(Object);
+        const FRuleRangerMatcherResults::FScope Scope(Results);
+        FRuleRangerMatcherResults::ResetStructuralIds();
+        const auto bMatched = FRuleRangerMatcherResults::Test(Matcher, Object);
+
+        // Ids are reassigned once discarded so the other matcher may be given the id of the first matcher
+        FRuleRangerMatcherResults::ResetStructuralIds();
+        const auto bOtherMatched = FRuleRangerMatcherResults::Test(OtherMatcher, Object);
+
+        return TestTrue(TEXT("The matcher should match"), bMatched)
+            && TestFalse(TEXT("The other matcher should not reuse a result recorded against a discarded id"),
+                         bOtherMatched)
+            && TestEqual(TEXT("The other matcher should be evaluated"), OtherMatcher->GetCallCount(), 1)
+            && TestEqual(TEXT("Only the result of the other matcher should be retained"), Results.Num(), 1);
+    }
+    else
+    {
+        return false;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerMatcherResultsSharesResultsAcrossRulesTest,
+                                 "RuleRanger.MatcherResults.SharesResultsAcrossRules",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerMatcherResultsSharesResultsAcrossRulesTest::RunTest(const FString&)
+{
+    RuleRangerTests::FRuleFixture Fixture;
+    if (RuleRangerTests::CreateRuleFixture(*this, Fixture))
+    {
+        const auto OtherRule = RuleRangerTests::NewTransientObject<URuleRangerRule>();
+        const auto Matcher = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(Fixture.Rule);
+        const auto OtherMatcher = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(OtherRule);
+        const auto Action = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestAction>(Fixture.Rule);
+        const auto OtherAction = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestAction>(OtherRule);
+        if (TestNotNull(TEXT("Other rule should be created"), OtherRule)
+            && TestNotNull(TEXT("Matcher should be created"), Matcher)
+            && TestNotNull(TEXT("Other matcher should be created"), OtherMatcher)
+            && TestNotNull(TEXT("Action should be created"), Action)
+            && TestNotNull(TEXT("Other action should be created"), OtherAction))
+        {
+            Fixture.Rule->Matchers = { Matcher };
+            Fixture.Rule->Actions = { Action };
+            OtherRule->Matchers = { OtherMatcher };
+            OtherRule->Actions = { OtherAction };
+
+            const auto bMatched = Fixture.Rule->Match(Fixture.ActionContext, Fixture.Object);
+            const auto bOtherMatched = OtherRule->Match(Fixture.ActionContext, Fixture.Object);
+            const auto OtherCallCountWhileShared = OtherMatcher->GetCallCount();
+
+            // The results are discarded with the other analyses of the object
+            Fixture.ActionContext->InvalidateObjectAnalyses();
+            OtherRule->Match(Fixture.ActionContext, Fixture.Object);
+
+            return TestTrue(TEXT("The rule should match"), bMatched)
+                && TestTrue(TEXT("The other rule should match"), bOtherMatched)
+                && TestEqual(TEXT("The matcher should be evaluated once"), Matcher->GetCallCount(), 1)
+                && TestEqual(TEXT("The equal matcher should reuse the result"), OtherCallCountWhileShared, 0)
+                && TestEqual(TEXT("The equal matcher should be evaluated once the results are discarded"),
+                             OtherMatcher->GetCallCount(),
+                             1);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    else
+    {
+        return false;
+    }
+}
+
+#endif
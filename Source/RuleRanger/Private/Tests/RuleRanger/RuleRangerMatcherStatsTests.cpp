@@ -0,0 +1,266 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+    #include "Misc/AutomationTest.h"
+    #include "RuleRanger/Matchers/Logic/AndMatcher.h"
+    #include "RuleRanger/Matchers/Logic/OrMatcher.h"
+    #include "RuleRanger/RuleRangerMatcherResults.h"
+    #include "RuleRanger/RuleRangerMatcherStats.h"
+    #include "RuleRanger/UI/RuleRangerDeveloperSettings.h"
+    #include "Tests/RuleRanger/RuleRangerAutomationTestHelpers.h"
+    #include "Tests/RuleRanger/RuleRangerAutomationTestTypes.h"
+
+namespace RuleRangerMatcherStatsTests
+{
+    struct FScopedReorderMatchersOverride
+    {
+        URuleRangerDeveloperSettings* Settings{ GetMutableDefault<URuleRangerDeveloperSettings>() };
+        bool bOriginalReorderMatchersByCost{ false };
+
+        explicit FScopedReorderMatchersOverride(const bool bReorderMatchersByCost)
+        {
+            bOriginalReorderMatchersByCost = Settings->bReorderMatchersByCost;
+            Settings->bReorderMatchersByCost = bReorderMatchersByCost;
+        }
+
+        ~FScopedReorderMatchersOverride() { Settings->bReorderMatchersByCost = bOriginalReorderMatchersByCost; }
+    };
+
+    constexpr int32 SampleCount{ 10 };
+
+    void RecordSamples(const URuleRangerMatcher* Matcher, const int32 MatchCount, const double Microseconds)
+    {
+        for (int32 i = 0; i < SampleCount; i++)
+        {
+            FRuleRangerMatcherStats::Get().Record(Matcher, i < MatchCount, Microseconds / 1000000.0);
+        }
+    }
+
+    TArray<int32> GetOrder(const UObject* Container,
+                           const TArray<TObjectPtr<URuleRangerMatcher>>& Matchers,
+                           const bool bConjunction,
+                           const bool bPinned = false)
+    {
+        TArray<int32, TInlineAllocator<8>> Order;
+        FRuleRangerMatcherStats::Get().GetEvaluationOrder(Container, Matchers, bConjunction, bPinned, Order);
+        return TArray<int32>(Order);
+    }
+} // namespace RuleRangerMatcherStatsTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerMatcherStatsEvaluatesDecisiveMatchersFirstTest,
+                                 "RuleRanger.MatcherStats.EvaluatesDecisiveMatchersFirst",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerMatcherStatsEvaluatesDecisiveMatchersFirstTest::RunTest(const FString&)
+{
+    using namespace RuleRangerMatcherStatsTests;
+
+    const FScopedReorderMatchersOverride Override(true);
+    const auto Container = RuleRangerTests::NewTransientObject<UAndMatcher>();
+    const auto Or = RuleRangerTests::NewTransientObject<UOrMatcher>();
+    const auto Expensive = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(Container);
+    const auto Selective = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(Container);
+    const auto Cheap = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(Container);
+    if (TestNotNull(TEXT("Container should be created"), Container)
+        && TestNotNull(TEXT("Or matcher should be created"), Or)
+        && TestNotNull(TEXT("Expensive matcher should be created"), Expensive)
+        && TestNotNull(TEXT("Selective matcher should be created"), Selective)
+        && TestNotNull(TEXT("Cheap matcher should be created"), Cheap))
+    {
+        const TArray<TObjectPtr<URuleRangerMatcher>> Matchers{ Expensive, Selective, Cheap };
+        RecordSamples(Expensive, 5, 100.0);
+        RecordSamples(Selective, 1, 10.0);
+        RecordSamples(Cheap, 9, 1.0);
+
+        // And ranks: Expensive 200, Selective ~11.1, Cheap 10. Or ranks: Expensive 200, Selective 100, Cheap ~1.1
+        const auto AndOrder = GetOrder(Container, Matchers, true);
+        const auto OrOrder = GetOrder(Or, Matchers, false);
+        return TestTrue(TEXT("A conjunction should evaluate the cheapest matcher per rejection first"),
+                        AndOrder == TArray<int32>{ 2, 1, 0 })
+            && TestTrue(TEXT("A disjunction should evaluate the cheapest matcher per match first"),
+                        OrOrder == TArray<int32>{ 2, 1, 0 })
+            && TestTrue(TEXT("A pinned container should keep the authored order"),
+                        GetOrder(Container, Matchers, true, true) == TArray<int32>{ 0, 1, 2 });
+    }
+    else
+    {
+        return false;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerMatcherStatsRanksUnsampledMatchersNeutrallyTest,
+                                 "RuleRanger.MatcherStats.RanksUnsampledMatchersNeutrally",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerMatcherStatsRanksUnsampledMatchersNeutrallyTest::RunTest(const FString&)
+{
+    using namespace RuleRangerMatcherStatsTests;
+
+    const FScopedReorderMatchersOverride Override(true);
+    const auto Container = RuleRangerTests::NewTransientObject<UAndMatcher>();
+    const auto Expensive = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(Container);
+    const auto Unsampled = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(Container);
+    const auto Median = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(Container);
+    const auto Cheap = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(Container);
+    if (TestNotNull(TEXT("Container should be created"), Container)
+        && TestNotNull(TEXT("Expensive matcher should be created"), Expensive)
+        && TestNotNull(TEXT("Unsampled matcher should be created"), Unsampled)
+        && TestNotNull(TEXT("Median matcher should be created"), Median)
+        && TestNotNull(TEXT("Cheap matcher should be created"), Cheap))
+    {
+        // Ranks: Expensive 100, Median 10, Cheap 1 so the unsampled matcher ranks alongside Median
+        RecordSamples(Expensive, 0, 100.0);
+        RecordSamples(Median, 0, 10.0);
+        RecordSamples(Cheap, 0, 1.0);
+        return TestTrue(TEXT("An unsampled matcher should be given the median rank of the sampled matchers"),
+                        GetOrder(Container, { Expensive, Unsampled, Median, Cheap }, true)
+                            == TArray<int32>{ 3, 1, 2, 0 });
+    }
+    else
+    {
+        return false;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerMatcherStatsKeepsOrderOfMatchersWithSideEffectsTest,
+                                 "RuleRanger.MatcherStats.KeepsOrderOfMatchersWithSideEffects",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerMatcherStatsKeepsOrderOfMatchersWithSideEffectsTest::RunTest(const FString&)
+{
+    using namespace RuleRangerMatcherStatsTests;
+
+    const FScopedReorderMatchersOverride Override(true);
+    const auto Container = RuleRangerTests::NewTransientObject<UAndMatcher>();
+    const auto Expensive = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(Container);
+    // A matcher is not side-effect free unless it opts in
+    const auto Custom = RuleRangerTests::NewTransientObject<URuleRangerAutomationMatcherFallback>(Container);
+    if (TestNotNull(TEXT("Container should be created"), Container)
+        && TestNotNull(TEXT("Expensive matcher should be created"), Expensive)
+        && TestNotNull(TEXT("Custom matcher should be created"), Custom))
+    {
+        RecordSamples(Expensive, SampleCount, 100.0);
+        RecordSamples(Custom, 0, 1.0);
+        return TestFalse(TEXT("A matcher should not be side-effect free by default"), Custom->IsSideEffectFree())
+            && TestTrue(TEXT("A container with a matcher that has side effects should keep the authored order"),
+                        GetOrder(Container, { Expensive, Custom }, true) == TArray<int32>{ 0, 1 });
+    }
+    else
+    {
+        return false;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerMatcherStatsAndMatcherUsesMeasuredOrderTest,
+                                 "RuleRanger.MatcherStats.AndMatcherUsesMeasuredOrder",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerMatcherStatsAndMatcherUsesMeasuredOrderTest::RunTest(const FString&)
+{
+    using namespace RuleRangerMatcherStatsTests;
+
+    const FScopedReorderMatchersOverride Override(true);
+    const auto Matcher = RuleRangerTests::NewTransientObject<UAndMatcher>();
+    const auto FirstMatcher = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(Matcher);
+    const auto SecondMatcher = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(Matcher);
+    const auto Object =
+        RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("MatcherStatsObject"));
+    if (TestNotNull(TEXT("And matcher should be created"), Matcher)
+        && TestNotNull(TEXT("First child matcher should be created"), FirstMatcher)
+        && TestNotNull(TEXT("Second child matcher should be created"), SecondMatcher)
+        && TestNotNull(TEXT("Object should be created"), Object))
+    {
+        const TArray<TObjectPtr<URuleRangerMatcher>> Matchers{ FirstMatcher, SecondMatcher };
+        RecordSamples(FirstMatcher, SampleCount, 5.0);
+        RecordSamples(SecondMatcher, 0, 5.0);
+        if (RuleRangerTests::SetPropertyValue(*this, SecondMatcher, TEXT("bResult"), false)
+            && RuleRangerTests::SetPropertyValue(*this, Matcher, TEXT("Matchers"), Matchers))
+        {
+            return TestFalse(TEXT("The And matcher should not match"), Matcher->Test(Object))
+                && TestEqual(TEXT("The matcher that never matched should run first"), SecondMatcher->GetCallCount(), 1)
+                && TestEqual(TEXT("The matcher that always matched should not run"), FirstMatcher->GetCallCount(), 0);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    else
+    {
+        return false;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerMatcherStatsDisabledKeepsAuthoredOrderTest,
+                                 "RuleRanger.MatcherStats.DisabledKeepsAuthoredOrder",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerMatcherStatsDisabledKeepsAuthoredOrderTest::RunTest(const FString&)
+{
+    using namespace RuleRangerMatcherStatsTests;
+
+    const FScopedReorderMatchersOverride Override(false);
+    const auto Container = RuleRangerTests::NewTransientObject<UAndMatcher>();
+    const auto First = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(Container);
+    const auto Second = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(Container);
+    if (TestNotNull(TEXT("Container should be created"), Container)
+        && TestNotNull(TEXT("First matcher should be created"), First)
+        && TestNotNull(TEXT("Second matcher should be created"), Second))
+    {
+        RecordSamples(First, SampleCount, 100.0);
+        RecordSamples(Second, 0, 1.0);
+        return TestTrue(TEXT("Matchers should be evaluated in the authored order when reordering is disabled"),
+                        GetOrder(Container, { First, Second }, true) == TArray<int32>{ 0, 1 });
+    }
+    else
+    {
+        return false;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerMatcherStatsSamplesReusedResultsTest,
+                                 "RuleRanger.MatcherStats.SamplesReusedResults",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerMatcherStatsSamplesReusedResultsTest::RunTest(const FString&)
+{
+    using namespace RuleRangerMatcherStatsTests;
+
+    const FScopedReorderMatchersOverride Override(true);
+    const auto Object = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestObject>();
+    const auto Container = RuleRangerTests::NewTransientObject<UAndMatcher>();
+    const auto Matcher = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>();
+    const auto Shared = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(Container);
+    const auto Unsampled = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestMatcher>(Container);
+    if (TestNotNull(TEXT("Object should be created"), Object)
+        && TestNotNull(TEXT("Container should be created"), Container)
+        && TestNotNull(TEXT("Matcher should be created"), Matcher)
+        && TestNotNull(TEXT("Shared matcher should be created"), Shared)
+        && TestNotNull(TEXT("Unsampled matcher should be created"), Unsampled))
+    {
+        for (int32 i = 0; i < FRuleRangerMatcherStats::MinSamples; i++)
+        {
+            // The shared matcher always reuses the result of the structurally equal matcher
+            FRuleRangerMatcherResults Results(Object);
+            const FRuleRangerMatcherResults::FScope Scope(Results);
+            FRuleRangerMatcherResults::Test(Matcher, Object);
+            FRuleRangerMatcherResults::Test(Shared, Object);
+        }
+
+        return TestEqual(TEXT("The shared matcher should only reuse results"), Shared->GetCallCount(), 0)
+            && TestTrue(TEXT("Reused results should count as samples so the matcher is reordered"),
+                        GetOrder(Container, { Shared, Unsampled }, true) == TArray<int32>{ 1, 0 });
+    }
+    else
+    {
+        return false;
+    }
+}
+
+#endif
@@ -16,9 +16,11 @@
     #include "Misc/AutomationTest.h"
     #include "RuleRanger/ProjectRuleTraversal.h"
     #include "RuleRangerConfig.h"
+    #include "RuleRangerProjectActionContext.h"
     #include "RuleRangerProjectRule.h"
     #include "RuleRangerRuleSet.h"
     #include "Tests/RuleRanger/RuleRangerAutomationTestHelpers.h"
+    #include "Tests/RuleRanger/RuleRangerAutomationTestTypes.h"
 
 namespace RuleRangerProjectRuleTraversalTests
 {
@@ -266,4 +268,78 @@ bool FRuleRangerProjectRuleTraversalSoftConfigsLoadSynchronouslyTest::RunTest(co
     }
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerProjectRuleTraversalReportMergesConcurrentResultsInOrderTest,
+                                 "RuleRanger.ProjectTraversal.ReportMergesConcurrentResultsInOrder",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerProjectRuleTraversalReportMergesConcurrentResultsInOrderTest::RunTest(const FString&)
+{
+    const auto Config = RuleRangerTests::NewTransientObject<URuleRangerConfig>();
+    const auto RuleSet = RuleRangerTests::NewTransientObject<URuleRangerRuleSet>(Config, TEXT("RuleSet"));
+    const auto SerialRule = RuleRangerTests::NewTransientObject<URuleRangerProjectRule>(RuleSet, TEXT("SerialRule"));
+    const auto ConcurrentRule =
+        RuleRangerTests::NewTransientObject<URuleRangerProjectRule>(RuleSet, TEXT("ConcurrentRule"));
+    const auto SerialAction = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestProjectAction>(SerialRule);
+    const auto ConcurrentAction =
+        RuleRangerTests::NewTransientObject<URuleRangerAutomationTestProjectAction>(ConcurrentRule);
+    const auto ActionContext = RuleRangerTests::NewTransientObject<URuleRangerProjectActionContext>();
+    if (TestNotNull(TEXT("Config should be created"), Config)
+        && TestNotNull(TEXT("Rule set should be created"), RuleSet)
+        && TestNotNull(TEXT("Serial project rule should be created"), SerialRule)
+        && TestNotNull(TEXT("Concurrent project rule should be created"), ConcurrentRule)
+        && TestNotNull(TEXT("Serial project action should be created"), SerialAction)
+        && TestNotNull(TEXT("Concurrent project action should be created"), ConcurrentAction)
+        && TestNotNull(TEXT("Project action context should be created"), ActionContext))
+    {
+        SerialAction->Outcome = ERuleRangerAutomationTestActionOutcome::Warning;
+        ConcurrentAction->Outcome = ERuleRangerAutomationTestActionOutcome::Error;
+        ConcurrentAction->bConcurrencySafe = true;
+        SerialRule->Actions.Add(SerialAction);
+        ConcurrentRule->Actions.Add(ConcurrentAction);
+
+        if (RuleRangerProjectRuleTraversalTests::SetProjectRules(*this, RuleSet, { ConcurrentRule, SerialRule })
+            && RuleRangerProjectRuleTraversalTests::SetRuleSets(*this, Config, { RuleSet }))
+        {
+            TArray<FString> VisitedRules;
+            TArray<ERuleRangerActionState> VisitedStates;
+            const TArray<TWeakObjectPtr<URuleRangerConfig>> Configs{ Config };
+            RuleRanger::Traversal::ReportProjectRulesForConfigs(
+                Configs,
+                ActionContext,
+                [&VisitedRules, &VisitedStates](URuleRangerProjectActionContext* InActionContext) {
+                    VisitedRules.Add(InActionContext->GetRule()->GetName());
+                    VisitedStates.Add(InActionContext->GetState());
+                    return true;
+                });
+
+            return TestTrue(TEXT("Only the concurrent rule should be concurrency-safe"),
+                            ConcurrentRule->IsConcurrencySafe() && !SerialRule->IsConcurrencySafe())
+                && TestEqual(TEXT("Both rules should be visited"), VisitedRules.Num(), 2)
+                && TestEqual(TEXT("The concurrent rule should be visited first as it is declared first"),
+                             VisitedRules[0],
+                             FString(TEXT("ConcurrentRule")))
+                && TestEqual(TEXT("The concurrent rule results should be visited"),
+                             VisitedStates[0],
+                             ERuleRangerActionState::AS_Error)
+                && TestEqual(TEXT("The serial rule should be visited second"),
+                             VisitedRules[1],
+                             FString(TEXT("SerialRule")))
+                && TestEqual(TEXT("The serial rule results should be visited"),
+                             VisitedStates[1],
+                             ERuleRangerActionState::AS_Warning)
+                && TestEqual(TEXT("The concurrent action should be applied in report mode"),
+                             ConcurrentAction->GetLastTrigger(),
+                             ERuleRangerProjectActionTrigger::AT_Report)
+                && TestNull(TEXT("The supplied context should be cleared after traversal"), ActionContext->GetRule());
+        }
+        else
+        {
+            return false;
+        }
+    }
+    else
+    {
+        return false;
+    }
+}
+
 #endif
@@ -0,0 +1,184 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+    #include "HAL/FileManager.h"
+    #include "Misc/AutomationTest.h"
+    #include "Misc/FileHelper.h"
+    #include "Misc/Paths.h"
+    #include "RuleRanger/Matchers/Name/NamePrefixMatcher.h"
+    #include "RuleRanger/RuleRangerRenameBatch.h"
+    #include "RuleRanger/RuleRangerUtilities.h"
+    #include "Tests/RuleRanger/RuleRangerAutomationTestHelpers.h"
+    #include "Tests/RuleRanger/RuleRangerAutomationTestTypes.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerRenameBatchIgnoredWithoutActiveBatchTest,
+                                 "RuleRanger.RenameBatch.IgnoredWithoutActiveBatch",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerRenameBatchIgnoredWithoutActiveBatchTest::RunTest(const FString&)
+{
+    const auto Object = RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("T_Rock"));
+    if (TestNotNull(TEXT("Object should be created"), Object))
+    {
+        FRuleRangerUtilities::RecordPlannedRename(Object, TEXT("T_Rock_D"));
+
+        return TestNull(TEXT("No batch should be active"), FRuleRangerRenameBatch::GetActive())
+            && TestEqual(TEXT("The pending name should be the current name"),
+                         FRuleRangerUtilities::GetPendingAssetName(Object),
+                         FString(TEXT("T_Rock")));
+    }
+    else
+    {
+        return false;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerRenameBatchCoalescesRenamesOfAnObjectTest,
+                                 "RuleRanger.RenameBatch.CoalescesRenamesOfAnObject",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerRenameBatchCoalescesRenamesOfAnObjectTest::RunTest(const FString&)
+{
+    const auto Object = RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("Rock"));
+    if (TestNotNull(TEXT("Object should be created"), Object))
+    {
+        FRuleRangerRenameBatch RenameBatch;
+        FRuleRangerUtilities::RecordPlannedRename(Object, TEXT("T_Rock"));
+        FRuleRangerUtilities::RecordPlannedRename(Object, TEXT("Rock_D"));
+
+        return TestTrue(TEXT("The batch should be active"), RenameBatch.IsActive())
+            && TestEqual(TEXT("The object should only be renamed once"), RenameBatch.Num(), 1)
+            && TestEqual(TEXT("The object should not be renamed until the batch executes"),
+                         Object->GetName(),
+                         FString(TEXT("Rock")));
+    }
+    else
+    {
+        return false;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerRenameBatchPendingNameOnlyIncludesQueuedRenamesTest,
+                                 "RuleRanger.RenameBatch.PendingNameOnlyIncludesQueuedRenames",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerRenameBatchPendingNameOnlyIncludesQueuedRenamesTest::RunTest(const FString&)
+{
+    const auto Queued = RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("Rock"));
+    const auto Planned = RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("Stone"));
+    const auto Matcher = RuleRangerTests::NewTransientObject<UNamePrefixMatcher>();
+    if (TestNotNull(TEXT("Queued object should be created"), Queued)
+        && TestNotNull(TEXT("Planned object should be created"), Planned)
+        && TestNotNull(TEXT("Prefix matcher should be created"), Matcher)
+        && RuleRangerTests::SetPropertyValue(*this, Matcher, TEXT("Prefix"), FString(TEXT("T_"))))
+    {
+        FRuleRangerRenameBatch RenameBatch;
+        FRuleRangerUtilities::RenameAsset(Queued, TEXT("T_Rock"));
+        FRuleRangerUtilities::RecordPlannedRename(Planned, TEXT("T_Stone"));
+
+        // Rules applied later in the batch see the queued name but a dry run never sees a hypothetical name
+        const auto bQueuedNamePending = TestEqual(TEXT("A queued rename should be pending"),
+                                                  FRuleRangerUtilities::GetPendingAssetName(Queued),
+                                                  FString(TEXT("T_Rock")))
+            && TestTrue(TEXT("Name matchers should match the queued name"), Matcher->Test(Queued));
+        const auto bPlannedNameIgnored = TestEqual(TEXT("A planned rename should not be pending"),
+                                                   FRuleRangerUtilities::GetPendingAssetName(Planned),
+                                                   FString(TEXT("Stone")))
+            && TestFalse(TEXT("Name matchers should not match the planned name"), Matcher->Test(Planned));
+
+        // The queued rename fails as the object is no longer valid when the batch executes
+        AddExpectedMessagePlain(TEXT("as the object is no longer valid"),
+                                ELogVerbosity::Error,
+                                EAutomationExpectedMessageFlags::Contains,
+                                1);
+        Queued->MarkAsGarbage();
+        const auto FailedCount = RenameBatch.Execute();
+
+        return bQueuedNamePending && bPlannedNameIgnored
+            && TestEqual(TEXT("The queued rename should fail"), FailedCount, 1)
+            && TestEqual(TEXT("Executing the batch again should not report the failure again"),
+                         RenameBatch.Execute(),
+                         0)
+            && TestEqual(TEXT("A failed rename should not be pending"),
+                         FRuleRangerUtilities::GetPendingAssetName(Queued),
+                         FString(TEXT("Rock")));
+    }
+    else
+    {
+        return false;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerRenameBatchNestedBatchDefersToOuterBatchTest,
+                                 "RuleRanger.RenameBatch.NestedBatchDefersToOuterBatch",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerRenameBatchNestedBatchDefersToOuterBatchTest::RunTest(const FString&)
+{
+    const auto Object = RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("Rock"));
+    if (TestNotNull(TEXT("Object should be created"), Object))
+    {
+        FRuleRangerRenameBatch OuterBatch;
+        auto bInnerActive{ true };
+        auto InnerCount{ -1 };
+        {
+            FRuleRangerRenameBatch InnerBatch;
+            FRuleRangerUtilities::RecordPlannedRename(Object, TEXT("T_Rock"));
+            bInnerActive = InnerBatch.IsActive();
+            InnerCount = InnerBatch.Num();
+        }
+
+        return TestFalse(TEXT("The nested batch should not be active"), bInnerActive)
+            && TestEqual(TEXT("The nested batch should not record renames"), InnerCount, 0)
+            && TestEqual(TEXT("The outer batch should record the rename"), OuterBatch.Num(), 1)
+            && TestTrue(TEXT("The outer batch should remain active"),
+                        &OuterBatch == FRuleRangerRenameBatch::GetActive());
+    }
+    else
+    {
+        return false;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerRenameBatchExportsPlanTest,
+                                 "RuleRanger.RenameBatch.ExportsPlan",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerRenameBatchExportsPlanTest::RunTest(const FString&)
+{
+    const auto Object = RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("Rock"));
+    if (TestNotNull(TEXT("Object should be created"), Object))
+    {
+        const auto Path = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("RuleRanger"), TEXT("RenamePlan.csv"));
+
+        FRuleRangerRenameBatch RenameBatch;
+        FRuleRangerUtilities::RecordPlannedRename(Object, TEXT("T_Rock"));
+        const auto bExported = RenameBatch.ExportPlan(Path);
+
+        TArray<FString> Lines;
+        FFileHelper::LoadFileToStringArray(Lines, *Path);
+        IFileManager::Get().Delete(*Path);
+
+        return TestTrue(TEXT("The plan should be exported"), bExported)
+            && TestEqual(TEXT("The plan should contain a header and one rename"), Lines.Num(), 2)
+            && TestEqual(TEXT("The header should name the columns"),
+                         Lines.IsValidIndex(0) ? Lines[0] : FString(),
+                         FString(TEXT("ObjectPath,NewName,Status")))
+            && TestEqual(TEXT("The rename should be recorded as planned"),
+                         Lines.IsValidIndex(1) ? Lines[1] : FString(),
+                         Object->GetPathName() + TEXT(",T_Rock,Planned"));
+    }
+    else
+    {
+        return false;
+    }
+}
+
+#endif
@@ -0,0 +1,179 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+    #include "Dom/JsonObject.h"
+    #include "HAL/FileManager.h"
+    #include "Misc/AutomationTest.h"
+    #include "Misc/FileHelper.h"
+    #include "RuleRanger/UI/Commandlet/RuleRangerScanCheckpoint.h"
+    #include "Tests/RuleRanger/RuleRangerAutomationTestHelpers.h"
+
+namespace RuleRangerScanCheckpointTests
+{
+    FString GetCheckpointPath(const TCHAR* const Name)
+    {
+        return FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("RuleRanger"), TEXT("Checkpoint"), Name);
+    }
+
+    void DeleteCheckpoint(const FString& Path)
+    {
+        IFileManager::Get().DeleteDirectory(*FPaths::GetPath(Path), false, true);
+    }
+
+    TSharedPtr<FJsonValue> MakeResult(const TCHAR* const Asset)
+    {
+        const auto Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("Asset"), Asset);
+        return MakeShared<FJsonValueObject>(Result);
+    }
+} // namespace RuleRangerScanCheckpointTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerScanCheckpointResumesProgressTest,
+                                 "RuleRanger.Commandlet.Checkpoint.ResumesProgress",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerScanCheckpointResumesProgressTest::RunTest(const FString&)
+{
+    using namespace RuleRangerScanCheckpointTests;
+
+    const auto Path = GetCheckpointPath(TEXT("Resume.json"));
+    DeleteCheckpoint(Path);
+
+    FRuleRangerScanCounters Counters;
+    TArray<TSharedPtr<FJsonValue>> Results;
+    {
+        FRuleRangerScanCheckpoint Checkpoint(Path);
+        Checkpoint.Load(false, Counters, Results);
+        Checkpoint.BeginPackage(TEXT("/Game/Bob"));
+        Checkpoint.EndPackage(TEXT("/Game/Bob"));
+        Counters.Errors = 2;
+        Counters.AssetsScanned = 1;
+        Checkpoint.Save(Counters, { MakeResult(TEXT("/Game/Bob.Bob")) });
+
+        // Progress after the last save is lost when the scan stops
+        Checkpoint.BeginPackage(TEXT("/Game/Alice"));
+        Checkpoint.EndPackage(TEXT("/Game/Alice"));
+    }
+
+    FRuleRangerScanCounters ResumedCounters;
+    TArray<TSharedPtr<FJsonValue>> ResumedResults;
+    FRuleRangerScanCheckpoint Resumed(Path);
+    const auto bLoaded = Resumed.Load(true, ResumedCounters, ResumedResults);
+    const auto bBobCompleted = Resumed.IsCompleted(TEXT("/Game/Bob"));
+    const auto bAliceCompleted = Resumed.IsCompleted(TEXT("/Game/Alice"));
+    const auto bHasResult = 1 == ResumedResults.Num() && ResumedResults[0]->AsObject().IsValid()
+        && TEXT("/Game/Bob.Bob") == ResumedResults[0]->AsObject()->GetStringField(TEXT("Asset"));
+    Resumed.Complete();
+    const auto bDeletedOnComplete = !IFileManager::Get().FileExists(*Path);
+    DeleteCheckpoint(Path);
+
+    return TestTrue(TEXT("Checkpoint should be loaded"), bLoaded)
+        && TestTrue(TEXT("Saved package should be completed"), bBobCompleted)
+        && TestFalse(TEXT("Package completed after the last save should be scanned again"), bAliceCompleted)
+        && TestEqual(TEXT("Errors should be restored"), ResumedCounters.Errors, 2)
+        && TestEqual(TEXT("Assets scanned should be restored"), ResumedCounters.AssetsScanned, 1)
+        && TestTrue(TEXT("Saved results should be restored"), bHasResult)
+        && TestTrue(TEXT("Checkpoint without quarantined packages should be deleted on completion"),
+                    bDeletedOnComplete);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerScanCheckpointAppendsCompletedPackagesTest,
+                                 "RuleRanger.Commandlet.Checkpoint.AppendsCompletedPackages",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerScanCheckpointAppendsCompletedPackagesTest::RunTest(const FString&)
+{
+    using namespace RuleRangerScanCheckpointTests;
+
+    const auto Path = GetCheckpointPath(TEXT("Append.json"));
+    const auto CompletedPath = Path + TEXT(".completed");
+    DeleteCheckpoint(Path);
+
+    FRuleRangerScanCounters Counters;
+    TArray<TSharedPtr<FJsonValue>> Results;
+    int64 FirstSize{ 0 };
+    {
+        FRuleRangerScanCheckpoint Checkpoint(Path);
+        Checkpoint.Load(false, Counters, Results);
+        Checkpoint.EndPackage(TEXT("/Game/Bob"));
+        Checkpoint.Save(Counters, {});
+        FirstSize = IFileManager::Get().FileSize(*CompletedPath);
+        Checkpoint.EndPackage(TEXT("/Game/Carol"));
+        Checkpoint.Save(Counters, {});
+    }
+    const auto SecondSize = IFileManager::Get().FileSize(*CompletedPath);
+
+    // The scan stops after appending a package but before the checkpoint records the new size
+    FFileHelper::SaveStringToFile(TEXT("/Game/Alice\n"),
+                                  *CompletedPath,
+                                  FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+                                  &IFileManager::Get(),
+                                  FILEWRITE_Append);
+
+    FRuleRangerScanCheckpoint Resumed(Path);
+    const auto bLoaded = Resumed.Load(true, Counters, Results);
+    const auto bBobCompleted = Resumed.IsCompleted(TEXT("/Game/Bob"));
+    const auto bCarolCompleted = Resumed.IsCompleted(TEXT("/Game/Carol"));
+    const auto bAliceCompleted = Resumed.IsCompleted(TEXT("/Game/Alice"));
+    const auto TruncatedSize = IFileManager::Get().FileSize(*CompletedPath);
+    DeleteCheckpoint(Path);
+
+    return TestTrue(TEXT("Checkpoint should be loaded"), bLoaded)
+        && TestTrue(TEXT("A later save should append to the completed packages"), SecondSize > FirstSize)
+        && TestTrue(TEXT("Package saved by the first checkpoint should be completed"), bBobCompleted)
+        && TestTrue(TEXT("Package saved by the second checkpoint should be completed"), bCarolCompleted)
+        && TestFalse(TEXT("Package appended after the last checkpoint should be scanned again"), bAliceCompleted)
+        && TestEqual(TEXT("Packages appended after the last checkpoint should be discarded"),
+                     TruncatedSize,
+                     SecondSize);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerScanCheckpointQuarantinesCurrentPackageTest,
+                                 "RuleRanger.Commandlet.Checkpoint.QuarantinesCurrentPackage",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerScanCheckpointQuarantinesCurrentPackageTest::RunTest(const FString&)
+{
+    using namespace RuleRangerScanCheckpointTests;
+
+    const auto Path = GetCheckpointPath(TEXT("Quarantine.json"));
+    DeleteCheckpoint(Path);
+
+    FRuleRangerScanCounters Counters;
+    TArray<TSharedPtr<FJsonValue>> Results;
+    {
+        FRuleRangerScanCheckpoint Checkpoint(Path);
+        Checkpoint.Load(false, Counters, Results);
+        // The scan stops while processing the package
+        Checkpoint.BeginPackage(TEXT("/Game/Broken"));
+    }
+
+    AddExpectedMessage(TEXT("quarantined package /Game/Broken"), EAutomationExpectedMessageFlags::Contains, 1);
+    {
+        FRuleRangerScanCheckpoint Checkpoint(Path);
+        Checkpoint.Load(true, Counters, Results);
+        Checkpoint.Complete();
+    }
+
+    // A new scan that is not resumed still skips the quarantined package
+    FRuleRangerScanCheckpoint Restarted(Path);
+    const auto bLoaded = Restarted.Load(false, Counters, Results);
+    const auto bQuarantined = Restarted.IsQuarantined(TEXT("/Game/Broken"));
+    const auto QuarantinedCount = Restarted.GetQuarantinedPackages().Num();
+    DeleteCheckpoint(Path);
+
+    return TestTrue(TEXT("Checkpoint should be loaded"), bLoaded)
+        && TestTrue(TEXT("Package being processed should be quarantined"), bQuarantined)
+        && TestEqual(TEXT("Package should be quarantined once"), QuarantinedCount, 1);
+}
+
+#endif
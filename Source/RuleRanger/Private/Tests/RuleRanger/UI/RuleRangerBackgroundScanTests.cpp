@@ -0,0 +1,76 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+    #include "Editor.h"
+    #include "Misc/AutomationTest.h"
+    #include "RuleRanger/UI/RuleRangerEditorSubsystem.h"
+    #include "RuleRanger/UI/ToolTab/RuleRangerBackgroundScan.h"
+    #include "RuleRanger/UI/ToolTab/SRuleRangerToolPanel.h"
+    #include "Tests/RuleRanger/RuleRangerAutomationTestHelpers.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerBackgroundScanCompletesEmptyScanTest,
+                                 "RuleRanger.UI.ToolTab.BackgroundScan.CompletesEmptyScan",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerBackgroundScanCompletesEmptyScanTest::RunTest(const FString&)
+{
+    const auto Subsystem = GEditor ? GEditor->GetEditorSubsystem<URuleRangerEditorSubsystem>() : nullptr;
+    if (!TestNotNull(TEXT("RuleRanger editor subsystem should exist"), Subsystem))
+    {
+        return false;
+    }
+
+    const auto Run = MakeShared<FRuleRangerRun>();
+    const auto Scan = MakeShared<FRuleRangerBackgroundScan>(Run, TArray<FAssetData>(), 0.008);
+    auto FinishedCount{ 0 };
+    Scan->OnFinished.BindLambda([&FinishedCount] { FinishedCount++; });
+    Scan->Start(Subsystem);
+    const auto bRunningAfterStart = Scan->IsRunning();
+    const auto bContinue = Scan->Tick(0.f);
+
+    return TestTrue(TEXT("Scan should run once started"), bRunningAfterStart)
+        && TestFalse(TEXT("Scan should not request further ticks once complete"), bContinue)
+        && TestFalse(TEXT("Scan should not be running once complete"), Scan->IsRunning())
+        && TestEqual(TEXT("OnFinished should be invoked once"), FinishedCount, 1);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerBackgroundScanCancelStopsScanTest,
+                                 "RuleRanger.UI.ToolTab.BackgroundScan.CancelStopsScan",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerBackgroundScanCancelStopsScanTest::RunTest(const FString&)
+{
+    const auto Subsystem = GEditor ? GEditor->GetEditorSubsystem<URuleRangerEditorSubsystem>() : nullptr;
+    const auto Object = RuleRangerTests::NewTransientObject<URuleRangerAutomationTestObject>();
+    if (!TestNotNull(TEXT("RuleRanger editor subsystem should exist"), Subsystem)
+        || !TestNotNull(TEXT("Object should be created"), Object))
+    {
+        return false;
+    }
+
+    const auto Run = MakeShared<FRuleRangerRun>();
+    const auto Scan = MakeShared<FRuleRangerBackgroundScan>(Run, TArray<FAssetData>{ FAssetData(Object) }, 0.008);
+    auto FinishedCount{ 0 };
+    Scan->OnFinished.BindLambda([&FinishedCount] { FinishedCount++; });
+    Scan->Start(Subsystem);
+    Scan->Cancel();
+    Scan->Cancel();
+
+    return TestFalse(TEXT("Scan should not be running once cancelled"), Scan->IsRunning())
+        && TestEqual(TEXT("Cancelled scan should not have scanned assets"), Scan->GetScannedCount(), 0)
+        && TestEqual(TEXT("Cancelled scan should retain the total"), Scan->GetTotalCount(), 1)
+        && TestEqual(TEXT("OnFinished should be invoked once"), FinishedCount, 1)
+        && TestFalse(TEXT("Ticking a cancelled scan should not request further ticks"), Scan->Tick(0.f));
+}
+
+#endif
@@ -30,9 +30,58 @@ public:
         return Subsystem->bRuleSetConfigCacheDirty;
     }
 
-    static bool IsValidationMatchCacheEmpty(const URuleRangerEditorSubsystem* const Subsystem)
+    static bool IsValidationPlanEmpty(const URuleRangerEditorSubsystem* const Subsystem)
     {
-        return Subsystem->ValidationMatchCache.IsEmpty() && !Subsystem->ValidationMatchCacheObject.IsValid();
+        return Subsystem->ValidationPlan.IsEmpty() && !Subsystem->ValidationPlanObject.IsValid();
+    }
+
+    static int32 GetValidationPlanCount(const URuleRangerEditorSubsystem* const Subsystem)
+    {
+        return Subsystem->ValidationPlan.Num();
+    }
+
+    static void OnAssetPostImport(URuleRangerEditorSubsystem* const Subsystem, UObject* const Object)
+    {
+        Subsystem->OnAssetPostImport(nullptr, Object);
+    }
+
+    static int32 GetPendingImportCount(const URuleRangerEditorSubsystem* const Subsystem)
+    {
+        return Subsystem->PendingImports.Num();
+    }
+
+    static void ProcessPendingImports(URuleRangerEditorSubsystem* const Subsystem)
+    {
+        Subsystem->ProcessPendingImports();
+    }
+
+    static void OnWatchedAssetChanged(URuleRangerEditorSubsystem* const Subsystem, const FAssetData& AssetData)
+    {
+        Subsystem->OnWatchedAssetChanged(AssetData);
+    }
+
+    static int32 GetPendingChangedAssetCount(const URuleRangerEditorSubsystem* const Subsystem)
+    {
+        return Subsystem->PendingChangedAssets.Num();
+    }
+
+    static bool TickPendingChanges(URuleRangerEditorSubsystem* const Subsystem, const bool bSettled)
+    {
+        if (bSettled)
+        {
+            Subsystem->LastAssetChangeTime = 0;
+        }
+        return Subsystem->OnPendingChangesTick(0.f);
+    }
+
+    static void ResetPendingChanges(URuleRangerEditorSubsystem* const Subsystem)
+    {
+        if (Subsystem->PendingChangesTickerHandle.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(Subsystem->PendingChangesTickerHandle);
+            Subsystem->PendingChangesTickerHandle.Reset();
+        }
+        Subsystem->PendingChangedAssets.Reset();
     }
 };
 
@@ -173,8 +222,143 @@ bool FRuleRangerEditorSubsystemValidateCachesAndClearsRuleMatchesTest::RunTest(c
         && TestEqual(TEXT("ValidateObject should use the validate trigger"),
                      Fixture.Action->GetLastTrigger(),
                      ERuleRangerActionTrigger::AT_Validate)
-        && TestTrue(TEXT("ValidateObject should clear validation match cache"),
-                    FRuleRangerEditorSubsystemTestAccessor::IsValidationMatchCacheEmpty(Subsystem));
+        && TestTrue(TEXT("ValidateObject should clear the validation plan"),
+                    FRuleRangerEditorSubsystemTestAccessor::IsValidationPlanEmpty(Subsystem));
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerEditorSubsystemValidateReplaysRulesCapturedByCanValidateTest,
+                                 "RuleRanger.UI.EditorSubsystem.ValidateReplaysRulesCapturedByCanValidate",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerEditorSubsystemValidateReplaysRulesCapturedByCanValidateTest::RunTest(const FString&)
+{
+    const auto Subsystem = GEditor ? GEditor->GetEditorSubsystem<URuleRangerEditorSubsystem>() : nullptr;
+    RuleRangerEditorSubsystemTests::FAssetRuleFixture Fixture;
+    if (!TestNotNull(TEXT("RuleRanger editor subsystem should be available"), Subsystem)
+        || !RuleRangerEditorSubsystemTests::CreateAssetRuleFixture(*this, Fixture))
+    {
+        return false;
+    }
+
+    // The same rule is referenced by two rule sets
+    const auto SecondRuleSet =
+        RuleRangerTests::NewTransientObject<URuleRangerRuleSet>(Fixture.Config, TEXT("SecondRuleSet"));
+    if (!TestNotNull(TEXT("Second rule set should be created"), SecondRuleSet))
+    {
+        return false;
+    }
+    SecondRuleSet->Rules = { Fixture.Rule };
+    Fixture.Config->RuleSets.Add(SecondRuleSet);
+
+    RuleRangerTests::FScopedRuleRangerDeveloperSettingsOverride SettingsOverride({ Fixture.Config });
+    const auto Handler = RuleRangerTests::NewTransientObject<URuleRangerAutomationCapturingResultHandler>();
+    if (!TestNotNull(TEXT("Capturing result handler should be created"), Handler))
+    {
+        return false;
+    }
+
+    const bool bCanValidate = Subsystem->CanValidateObject(Fixture.Object, true);
+    const int32 PlanCount = FRuleRangerEditorSubsystemTestAccessor::GetValidationPlanCount(Subsystem);
+    const int32 MatcherCallsAfterCanValidate = Fixture.Matcher->GetCallCount();
+
+    // The plan is replayed so rule sets removed after CanValidate are not traversed again
+    Fixture.Config->RuleSets.Reset();
+    Subsystem->ValidateObject(Fixture.Object, true, Handler);
+
+    return TestTrue(TEXT("CanValidateObject should accept matching save rules"), bCanValidate)
+        && TestEqual(TEXT("CanValidateObject should capture the rule once per rule set"), PlanCount, 2)
+        && TestEqual(TEXT("CanValidateObject should evaluate a shared rule once"), MatcherCallsAfterCanValidate, 1)
+        && TestEqual(TEXT("ValidateObject should replay every captured rule"), Fixture.Action->GetApplyCount(), 2)
+        && TestEqual(TEXT("ValidateObject should use the save trigger"),
+                     Fixture.Action->GetLastTrigger(),
+                     ERuleRangerActionTrigger::AT_Save)
+        && TestTrue(TEXT("ValidateObject should clear the validation plan"),
+                    FRuleRangerEditorSubsystemTestAccessor::IsValidationPlanEmpty(Subsystem));
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerEditorSubsystemProcessesImportsAsBatchTest,
+                                 "RuleRanger.UI.EditorSubsystem.ProcessesImportsAsBatch",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerEditorSubsystemProcessesImportsAsBatchTest::RunTest(const FString&)
+{
+    const auto Subsystem = GEditor ? GEditor->GetEditorSubsystem<URuleRangerEditorSubsystem>() : nullptr;
+    RuleRangerEditorSubsystemTests::FAssetRuleFixture Fixture;
+    if (!TestNotNull(TEXT("RuleRanger editor subsystem should be available"), Subsystem)
+        || !RuleRangerEditorSubsystemTests::CreateAssetRuleFixture(*this, Fixture))
+    {
+        return false;
+    }
+
+    RuleRangerTests::FScopedRuleRangerDeveloperSettingsOverride SettingsOverride({ Fixture.Config });
+
+    // The importer may report the same object more than once within a batch
+    FRuleRangerEditorSubsystemTestAccessor::OnAssetPostImport(Subsystem, Fixture.Object);
+    FRuleRangerEditorSubsystemTestAccessor::OnAssetPostImport(Subsystem, Fixture.Object);
+    const bool bImportDeferred =
+        TestEqual(TEXT("Imported objects should be queued"),
+                  FRuleRangerEditorSubsystemTestAccessor::GetPendingImportCount(Subsystem),
+                  2)
+        && TestEqual(TEXT("Rules should not be applied while the batch is open"), Fixture.Action->GetApplyCount(), 0);
+
+    FRuleRangerEditorSubsystemTestAccessor::ProcessPendingImports(Subsystem);
+    const bool bImportProcessed =
+        TestEqual(TEXT("An object reported twice should be processed once"), Fixture.Action->GetApplyCount(), 1)
+        && TestEqual(TEXT("The first import should use the import trigger"),
+                     Fixture.Action->GetLastTrigger(),
+                     ERuleRangerActionTrigger::AT_Import)
+        && TestEqual(TEXT("Processing should drain the queue"),
+                     FRuleRangerEditorSubsystemTestAccessor::GetPendingImportCount(Subsystem),
+                     0);
+
+    FRuleRangerEditorSubsystemTestAccessor::OnAssetPostImport(Subsystem, Fixture.Object);
+    FRuleRangerEditorSubsystemTestAccessor::ProcessPendingImports(Subsystem);
+
+    return bImportDeferred && bImportProcessed
+        && TestEqual(TEXT("A later import should apply the rule again"), Fixture.Action->GetApplyCount(), 2)
+        && TestEqual(TEXT("A later import of a processed object should use the reimport trigger"),
+                     Fixture.Action->GetLastTrigger(),
+                     ERuleRangerActionTrigger::AT_Reimport);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerEditorSubsystemPrepareForFixHonorsExpectedTypesTest,
+                                 "RuleRanger.UI.EditorSubsystem.PrepareForFixHonorsExpectedTypes",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerEditorSubsystemPrepareForFixHonorsExpectedTypesTest::RunTest(const FString&)
+{
+    const auto Subsystem = GEditor ? GEditor->GetEditorSubsystem<URuleRangerEditorSubsystem>() : nullptr;
+    RuleRangerEditorSubsystemTests::FAssetRuleFixture Fixture;
+    if (!TestNotNull(TEXT("RuleRanger editor subsystem should be available"), Subsystem)
+        || !RuleRangerEditorSubsystemTests::CreateAssetRuleFixture(*this, Fixture))
+    {
+        return false;
+    }
+
+    // A single rule contains preparing actions that expect different types
+    const auto MatchingAction =
+        RuleRangerTests::NewTransientObject<URuleRangerAutomationPreparingTestAction>(Fixture.Rule,
+                                                                                      TEXT("MatchingAction"));
+    const auto OtherTypeAction =
+        RuleRangerTests::NewTransientObject<URuleRangerAutomationPreparingTestAction>(Fixture.Rule,
+                                                                                      TEXT("OtherTypeAction"));
+    if (!TestNotNull(TEXT("Matching action should be created"), MatchingAction)
+        || !TestNotNull(TEXT("Other type action should be created"), OtherTypeAction))
+    {
+        return false;
+    }
+    MatchingAction->ExpectedType = URuleRangerAutomationTestObject::StaticClass();
+    OtherTypeAction->ExpectedType = URuleRangerAutomationDerivedTestObject::StaticClass();
+    Fixture.Rule->Actions = { Fixture.Action, MatchingAction, OtherTypeAction };
+
+    RuleRangerTests::FScopedRuleRangerDeveloperSettingsOverride SettingsOverride({ Fixture.Config });
+    Subsystem->PrepareAssetsForFix({ FAssetData(Fixture.Object) });
+
+    return TestEqual(TEXT("The action expecting the type of the object should prepare it"),
+                     MatchingAction->PreparedObjects.Num(),
+                     1)
+        && TestTrue(TEXT("The prepared object should be the scanned object"),
+                    MatchingAction->PreparedObjects.Contains(Fixture.Object.Get()))
+        && TestTrue(TEXT("The action expecting another type should not be given the object"),
+                    OtherTypeAction->PreparedObjects.IsEmpty())
+        && TestEqual(TEXT("Preparing should not apply the rule"), Fixture.Action->GetApplyCount(), 0);
 }
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerEditorSubsystemProjectScanHonorsReportFixAndCancellationTest,
@@ -248,4 +432,49 @@ bool FRuleRangerEditorSubsystemConfiguredPathsAndProjectRulesReflectSettingsTest
                      FRuleRangerEditorSubsystemTestAccessor::IsRuleSetConfigCacheDirty(Subsystem));
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerEditorSubsystemDebouncesWatchedChangesTest,
+                                 "RuleRanger.UI.EditorSubsystem.DebouncesWatchedChanges",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerEditorSubsystemDebouncesWatchedChangesTest::RunTest(const FString&)
+{
+    const auto Subsystem = GEditor ? GEditor->GetEditorSubsystem<URuleRangerEditorSubsystem>() : nullptr;
+    const auto ObjectA = RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("WatchedA"));
+    const auto ObjectB = RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("WatchedB"));
+    if (!TestNotNull(TEXT("RuleRanger editor subsystem should be available"), Subsystem)
+        || !TestNotNull(TEXT("ObjectA should be created"), ObjectA)
+        || !TestNotNull(TEXT("ObjectB should be created"), ObjectB))
+    {
+        return false;
+    }
+
+    auto BroadcastCount{ 0 };
+    TArray<FAssetData> BroadcastAssets;
+    const auto Handle = Subsystem->OnWatchedAssetsChanged.AddLambda([&](const TArray<FAssetData>& Assets) {
+        BroadcastCount++;
+        BroadcastAssets = Assets;
+    });
+
+    // Saving an asset typically reports the same asset several times
+    FRuleRangerEditorSubsystemTestAccessor::ResetPendingChanges(Subsystem);
+    FRuleRangerEditorSubsystemTestAccessor::OnWatchedAssetChanged(Subsystem, FAssetData(ObjectA));
+    FRuleRangerEditorSubsystemTestAccessor::OnWatchedAssetChanged(Subsystem, FAssetData(ObjectB));
+    FRuleRangerEditorSubsystemTestAccessor::OnWatchedAssetChanged(Subsystem, FAssetData(ObjectA));
+    const auto PendingCount = FRuleRangerEditorSubsystemTestAccessor::GetPendingChangedAssetCount(Subsystem);
+    const auto bKeepTicking = FRuleRangerEditorSubsystemTestAccessor::TickPendingChanges(Subsystem, false);
+    const auto UnsettledBroadcastCount = BroadcastCount;
+    const auto bKeepTickingOnceSettled = FRuleRangerEditorSubsystemTestAccessor::TickPendingChanges(Subsystem, true);
+    const auto RemainingCount = FRuleRangerEditorSubsystemTestAccessor::GetPendingChangedAssetCount(Subsystem);
+
+    Subsystem->OnWatchedAssetsChanged.Remove(Handle);
+    FRuleRangerEditorSubsystemTestAccessor::ResetPendingChanges(Subsystem);
+
+    return TestEqual(TEXT("Repeated changes to an asset should coalesce"), PendingCount, 2)
+        && TestTrue(TEXT("Changes should wait while they have not settled"), bKeepTicking)
+        && TestEqual(TEXT("Nothing should be broadcast before changes settle"), UnsettledBroadcastCount, 0)
+        && TestFalse(TEXT("The ticker should stop once changes settle"), bKeepTickingOnceSettled)
+        && TestEqual(TEXT("Settled changes should be broadcast once"), BroadcastCount, 1)
+        && TestEqual(TEXT("Each changed asset should be broadcast once"), BroadcastAssets.Num(), 2)
+        && TestEqual(TEXT("Broadcasting should drain the pending changes"), RemainingCount, 0);
+}
+
 #endif
@@ -0,0 +1,148 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+    #include "Misc/AutomationTest.h"
+    #include "RuleRanger/UI/ToolTab/RuleRangerRunStore.h"
+    #include "RuleRanger/UI/ToolTab/SRuleRangerToolPanel.h"
+    #include "RuleRangerRule.h"
+    #include "Tests/RuleRanger/RuleRangerAutomationTestHelpers.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerRunStoreSharesTemplatesAcrossAssetsTest,
+                                 "RuleRanger.UI.ToolTab.RunStore.SharesTemplatesAcrossAssets",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerRunStoreSharesTemplatesAcrossAssetsTest::RunTest(const FString&)
+{
+    const auto FirstAsset =
+        RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("StoreAssetOne"));
+    const auto SecondAsset =
+        RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("StoreAssetTwo"));
+    const auto Rule = RuleRangerTests::NewNamedTransientObject<URuleRangerRule>(TEXT("StoreRule"));
+    if (!TestNotNull(TEXT("First asset should be created"), FirstAsset)
+        || !TestNotNull(TEXT("Second asset should be created"), SecondAsset)
+        || !TestNotNull(TEXT("Rule should be created"), Rule))
+    {
+        return false;
+    }
+
+    FRuleRangerRunStore Store;
+    Store.Add(FirstAsset,
+              nullptr,
+              Rule,
+              nullptr,
+              ERuleRangerToolSeverity::Error,
+              FText::FromString(TEXT("StoreAssetOne is missing a tag")));
+    Store.Add(SecondAsset,
+              nullptr,
+              Rule,
+              nullptr,
+              ERuleRangerToolSeverity::Error,
+              FText::FromString(TEXT("StoreAssetTwo is missing a tag")));
+    Store.Add(FirstAsset,
+              nullptr,
+              Rule,
+              nullptr,
+              ERuleRangerToolSeverity::Warning,
+              FText::FromString(TEXT("STOREASSETONE is missing a tag")));
+
+    const auto Row = Store.GetRow(1);
+    return TestEqual(TEXT("Every message should be stored"), Store.Num(), 3)
+        && TestEqual(TEXT("Messages that only differ by asset name should share a template"),
+                     Store.GetTemplateId(0),
+                     Store.GetTemplateId(1))
+        && TestNotEqual(TEXT("Templates should be matched case-sensitively"),
+                        Store.GetTemplateId(0),
+                        Store.GetTemplateId(2))
+        && TestEqual(TEXT("Messages sharing a rule and template should share a group"),
+                     Store.GetGroupSize(Store.GetGroupId(0)),
+                     2)
+        && TestEqual(TEXT("The group label should name the asset with a placeholder"),
+                     Store.GetGroupLabel(Store.GetGroupId(0)),
+                     FString(TEXT("<Asset> is missing a tag")))
+        && TestEqual(TEXT("The message should be reconstructed exactly"),
+                     Store.GetMessage(1),
+                     FString(TEXT("StoreAssetTwo is missing a tag")))
+        && TestEqual(TEXT("The severity should be counted"),
+                     Store.GetSeverityCount(ERuleRangerToolSeverity::Error),
+                     2)
+        && TestEqual(TEXT("The materialized row should reference the asset"), Row->Asset.Get(), SecondAsset)
+        && TestEqual(TEXT("The materialized row should reference the rule"), Row->Rule.Get(), Rule);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerRunStorePreservesPlaceholderCharacterTest,
+                                 "RuleRanger.UI.ToolTab.RunStore.PreservesPlaceholderCharacter",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerRunStorePreservesPlaceholderCharacterTest::RunTest(const FString&)
+{
+    const auto Asset = RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("StoreAsset"));
+    if (!TestNotNull(TEXT("Asset should be created"), Asset))
+    {
+        return false;
+    }
+
+    const TCHAR Placeholder[]{ FRuleRangerRunStore::AssetPlaceholder, TEXT('\0') };
+    const auto Text = FString::Printf(TEXT("StoreAsset contains %s"), Placeholder);
+
+    FRuleRangerRunStore Store;
+    Store.Add(Asset, nullptr, nullptr, nullptr, ERuleRangerToolSeverity::Info, FText::FromString(Text));
+    Store.Reset();
+    Store.Add(Asset, nullptr, nullptr, nullptr, ERuleRangerToolSeverity::Info, FText::FromString(Text));
+
+    return TestEqual(TEXT("Reset should discard earlier messages"), Store.Num(), 1)
+        && TestFalse(TEXT("Text containing the placeholder should not be templated"),
+                     Store.HasAssetPlaceholder(Store.GetTemplateId(0)))
+        && TestEqual(TEXT("The message should be reconstructed exactly"), Store.GetMessage(0), Text);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerRunStoreRemovesMessagesOfAssetsTest,
+                                 "RuleRanger.UI.ToolTab.RunStore.RemovesMessagesOfAssets",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerRunStoreRemovesMessagesOfAssetsTest::RunTest(const FString&)
+{
+    const auto AssetA = RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("RemoveA"));
+    const auto AssetB = RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("RemoveB"));
+    if (!TestNotNull(TEXT("AssetA should be created"), AssetA)
+        || !TestNotNull(TEXT("AssetB should be created"), AssetB))
+    {
+        return false;
+    }
+
+    FRuleRangerRunStore Store;
+    const auto Text = FText::FromString(TEXT("Asset is bad"));
+    Store.Add(AssetA, nullptr, nullptr, nullptr, ERuleRangerToolSeverity::Error, Text);
+    Store.Add(AssetB, nullptr, nullptr, nullptr, ERuleRangerToolSeverity::Error, Text);
+    Store.Add(AssetA, nullptr, nullptr, nullptr, ERuleRangerToolSeverity::Warning, FText::FromString(TEXT("Odd")));
+    const auto GroupId = Store.GetGroupId(0);
+    const auto Revision = Store.GetRemovalRevision();
+
+    const auto Removed = Store.RemoveAssets({ FSoftObjectPath(AssetA) });
+
+    return TestEqual(TEXT("Both messages of AssetA should be removed"), Removed, 2)
+        && TestEqual(TEXT("The message of AssetB should remain"), Store.Num(), 1)
+        && TestEqual(TEXT("The remaining message should reference AssetB"), Store.GetAssetName(0), FString("RemoveB"))
+        && TestEqual(TEXT("The remaining message should keep its group"), Store.GetGroupId(0), GroupId)
+        && TestEqual(TEXT("The group should only count the remaining message"), Store.GetGroupSize(GroupId), 1)
+        && TestEqual(TEXT("The error count should be reduced"),
+                     Store.GetSeverityCount(ERuleRangerToolSeverity::Error),
+                     1)
+        && TestEqual(TEXT("The warning count should be reduced"),
+                     Store.GetSeverityCount(ERuleRangerToolSeverity::Warning),
+                     0)
+        && TestNotEqual(TEXT("The removal revision should change"), Store.GetRemovalRevision(), Revision)
+        && TestEqual(TEXT("Removing an unknown asset should remove nothing"),
+                     Store.RemoveAssets({ FSoftObjectPath(TEXT("/Game/Missing.Missing")) }),
+                     0);
+}
+
+#endif
@@ -83,7 +83,7 @@ bool FRuleRangerToolResultHandlerTranslatesActionMessagesToRowsTest::RunTest(con
 
     return TestEqual(TEXT("The run should receive one row per emitted action message"), Run->Messages.Num(), 4)
         && RuleRangerToolResultHandlerTests::TestMessageRow(*this,
-                                                            Run->Messages[0],
+                                                            Run->Messages.GetRow(0),
                                                             Fixture.Object,
                                                             Fixture.RuleSet,
                                                             Fixture.Rule,
@@ -91,7 +91,7 @@ bool FRuleRangerToolResultHandlerTranslatesActionMessagesToRowsTest::RunTest(con
                                                             ERuleRangerToolSeverity::Info,
                                                             TEXT("Tool info"))
         && RuleRangerToolResultHandlerTests::TestMessageRow(*this,
-                                                            Run->Messages[1],
+                                                            Run->Messages.GetRow(1),
                                                             Fixture.Object,
                                                             Fixture.RuleSet,
                                                             Fixture.Rule,
@@ -99,7 +99,7 @@ bool FRuleRangerToolResultHandlerTranslatesActionMessagesToRowsTest::RunTest(con
                                                             ERuleRangerToolSeverity::Warning,
                                                             TEXT("Tool warning"))
         && RuleRangerToolResultHandlerTests::TestMessageRow(*this,
-                                                            Run->Messages[2],
+                                                            Run->Messages.GetRow(2),
                                                             Fixture.Object,
                                                             Fixture.RuleSet,
                                                             Fixture.Rule,
@@ -107,7 +107,7 @@ bool FRuleRangerToolResultHandlerTranslatesActionMessagesToRowsTest::RunTest(con
                                                             ERuleRangerToolSeverity::Error,
                                                             TEXT("Tool error"))
         && RuleRangerToolResultHandlerTests::TestMessageRow(*this,
-                                                            Run->Messages[3],
+                                                            Run->Messages.GetRow(3),
                                                             Fixture.Object,
                                                             Fixture.RuleSet,
                                                             Fixture.Rule,
@@ -175,7 +175,7 @@ bool FRuleRangerToolProjectResultHandlerTranslatesProjectMessagesToRowsTest::Run
 
     return TestEqual(TEXT("The run should receive one row per emitted project message"), Run->Messages.Num(), 4)
         && RuleRangerToolResultHandlerTests::TestMessageRow(*this,
-                                                            Run->Messages[0],
+                                                            Run->Messages.GetRow(0),
                                                             nullptr,
                                                             Fixture.RuleSet,
                                                             nullptr,
@@ -183,7 +183,7 @@ bool FRuleRangerToolProjectResultHandlerTranslatesProjectMessagesToRowsTest::Run
                                                             ERuleRangerToolSeverity::Info,
                                                             TEXT("Project info"))
         && RuleRangerToolResultHandlerTests::TestMessageRow(*this,
-                                                            Run->Messages[1],
+                                                            Run->Messages.GetRow(1),
                                                             nullptr,
                                                             Fixture.RuleSet,
                                                             nullptr,
@@ -191,7 +191,7 @@ bool FRuleRangerToolProjectResultHandlerTranslatesProjectMessagesToRowsTest::Run
                                                             ERuleRangerToolSeverity::Warning,
                                                             TEXT("Project warning"))
         && RuleRangerToolResultHandlerTests::TestMessageRow(*this,
-                                                            Run->Messages[2],
+                                                            Run->Messages.GetRow(2),
                                                             nullptr,
                                                             Fixture.RuleSet,
                                                             nullptr,
@@ -199,7 +199,7 @@ bool FRuleRangerToolProjectResultHandlerTranslatesProjectMessagesToRowsTest::Run
                                                             ERuleRangerToolSeverity::Error,
                                                             TEXT("Project error"))
         && RuleRangerToolResultHandlerTests::TestMessageRow(*this,
-                                                            Run->Messages[3],
+                                                            Run->Messages.GetRow(3),
                                                             nullptr,
                                                             Fixture.RuleSet,
                                                             nullptr,
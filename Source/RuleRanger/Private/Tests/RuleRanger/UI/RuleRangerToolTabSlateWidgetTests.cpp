@@ -134,12 +134,12 @@ bool FRuleRangerRunViewFiltersSortsAndRefreshesRowsTest::RunTest(const FString&)
 {
     const auto Run = MakeShared<FRuleRangerRun>();
     Run->Title = FText::FromString(TEXT("Smoke Run"));
-    Run->Messages.Add(
-        RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Info, TEXT("Gamma passing detail")));
-    Run->Messages.Add(RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Warning,
-                                                                        TEXT("Beta warning detail")));
-    Run->Messages.Add(RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Error,
-                                                                        TEXT("Alpha failing detail")));
+    Run->Messages.Add(*RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Info,
+                                                                         TEXT("Gamma passing detail")));
+    Run->Messages.Add(*RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Warning,
+                                                                         TEXT("Beta warning detail")));
+    Run->Messages.Add(*RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Error,
+                                                                         TEXT("Alpha failing detail")));
 
     const auto View = SNew(SRuleRangerRunView).Run(Run);
     View->SetSeverityFiltersForTest(true, true, true);
@@ -165,8 +165,8 @@ bool FRuleRangerRunViewFiltersSortsAndRefreshesRowsTest::RunTest(const FString&)
                      View->GetFilteredItemForTest(0)->Severity,
                      ERuleRangerToolSeverity::Warning);
 
-    Run->Messages.Add(RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Error,
-                                                                        TEXT("Delta failing detail")));
+    Run->Messages.Add(*RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Error,
+                                                                         TEXT("Delta failing detail")));
     View->SetSeverityFiltersForTest(true, true, true);
     View->RebuildFilteredForTest();
     const bool bRepeatedRefreshIncludesNewRows =
@@ -198,6 +198,218 @@ bool FRuleRangerRunViewFiltersSortsAndRefreshesRowsTest::RunTest(const FString&)
                     ContextMenu.IsValid() && ContextMenu->GetVisibility().IsVisible());
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerRunViewNarrowsSearchIncrementallyTest,
+                                 "RuleRanger.UI.ToolTab.SlateWidgets.RunView.NarrowsSearchIncrementally",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerRunViewNarrowsSearchIncrementallyTest::RunTest(const FString&)
+{
+    const auto Rule = RuleRangerTests::NewNamedTransientObject<URuleRangerRule>(TEXT("SearchableRule"));
+    if (!TestNotNull(TEXT("Rule should be created"), Rule))
+    {
+        return false;
+    }
+
+    const auto Run = MakeShared<FRuleRangerRun>();
+    Run->Messages.Add(*RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Info,
+                                                                         TEXT("Gamma passing detail")));
+    const auto RuleRow = RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Warning,
+                                                                           TEXT("Beta warning detail"));
+    RuleRow->Rule = Rule;
+    Run->Messages.Add(*RuleRow);
+    Run->Messages.Add(*RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Error,
+                                                                         TEXT("Alpha failing detail")));
+
+    const auto View = SNew(SRuleRangerRunView).Run(Run);
+    View->SetSeverityFiltersForTest(true, true, true);
+
+    View->SetSearchQueryForTest(TEXT("DETAIL"));
+    const bool bSearchIgnoresCase =
+        TestEqual(TEXT("Search should ignore case"), View->GetFilteredItemCountForTest(), 3);
+
+    View->SetSearchQueryForTest(TEXT("DETAIL"));
+    View->SetSearchQueryForTest(TEXT("failing detail"));
+    const bool bExtendedQueryNarrows =
+        TestEqual(TEXT("Extending the query should narrow the matches"), View->GetFilteredItemCountForTest(), 1);
+
+    Run->Messages.Add(*RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Error,
+                                                                         TEXT("Epsilon failing detail")));
+    View->RebuildFilteredForTest();
+    const bool bNewRowsMatched = TestEqual(TEXT("Messages added after narrowing should be matched"),
+                                           View->GetFilteredItemCountForTest(),
+                                           2);
+
+    View->SetSearchQueryForTest(TEXT("ing"));
+    const bool bShortenedQueryWidens =
+        TestEqual(TEXT("Shortening the query should widen the matches"), View->GetFilteredItemCountForTest(), 4);
+
+    View->SetSearchQueryForTest(TEXT("searchablerule"));
+    const bool bRuleNameMatched =
+        TestEqual(TEXT("Search should match the rule name"), View->GetFilteredItemCountForTest(), 1);
+
+    View->SetSearchQueryForTest(TEXT("detail\nbeta"));
+    const bool bFieldsNotJoined = TestEqual(TEXT("Search should not match across fields"),
+                                            View->GetFilteredItemCountForTest(),
+                                            0);
+
+    View->SetSearchQueryForTest(TEXT("detail"));
+    View->SetSeverityFiltersForTest(false, false, true);
+    const bool bSeverityToggleApplied =
+        TestEqual(TEXT("Severity toggles should apply to matches"), View->GetFilteredItemCountForTest(), 2);
+
+    return bSearchIgnoresCase && bExtendedQueryNarrows && bNewRowsMatched && bShortenedQueryWidens
+        && bRuleNameMatched && bFieldsNotJoined && bSeverityToggleApplied;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerRunViewSortsWithTieBreaksTest,
+                                 "RuleRanger.UI.ToolTab.SlateWidgets.RunView.SortsWithTieBreaks",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerRunViewSortsWithTieBreaksTest::RunTest(const FString&)
+{
+    const auto Asset = RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("SortAsset"));
+    if (!TestNotNull(TEXT("Asset should be created"), Asset))
+    {
+        return false;
+    }
+
+    const auto Run = MakeShared<FRuleRangerRun>();
+    Run->Messages.Add(
+        *RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Warning, TEXT("Bravo")));
+    Run->Messages.Add(
+        *RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Error, TEXT("Delta")));
+    Run->Messages.Add(
+        *RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Warning, TEXT("alpha")));
+    const auto AssetRow =
+        RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Warning, TEXT("Charlie"));
+    AssetRow->Asset = Asset;
+    Run->Messages.Add(*AssetRow);
+
+    const auto View = SNew(SRuleRangerRunView).Run(Run);
+    View->SetSeverityFiltersForTest(true, true, true);
+
+    View->SetSortForTest(TEXT("Severity"), EColumnSortMode::Descending);
+    const bool bSeveritySortBreaksTies =
+        TestEqual(TEXT("The error should sort first"), View->GetFilteredItemForTest(0)->Text.ToString(), TEXT("Delta"))
+        && TestEqual(TEXT("Warnings with an asset should sort before warnings without an asset"),
+                     View->GetFilteredItemForTest(1)->Text.ToString(),
+                     TEXT("Charlie"))
+        && TestEqual(TEXT("Remaining ties should sort by message ignoring case"),
+                     View->GetFilteredItemForTest(2)->Text.ToString(),
+                     TEXT("alpha"))
+        && TestEqual(TEXT("The last warning should be Bravo"),
+                     View->GetFilteredItemForTest(3)->Text.ToString(),
+                     TEXT("Bravo"));
+
+    View->SetSortForTest(TEXT("Asset"), EColumnSortMode::Descending);
+    const bool bMissingAssetSortsFirstWhenDescending =
+        TestEqual(TEXT("Rows without an asset should sort first when descending"),
+                  View->GetFilteredItemForTest(0)->Text.ToString(),
+                  TEXT("Delta"))
+        && TestEqual(TEXT("The row with an asset should sort last when descending"),
+                     View->GetFilteredItemForTest(3)->Text.ToString(),
+                     TEXT("Charlie"));
+
+    return bSeveritySortBreaksTies && bMissingAssetSortsFirstWhenDescending;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerRunViewGroupsMessagesByRuleTest,
+                                 "RuleRanger.UI.ToolTab.SlateWidgets.RunView.GroupsMessagesByRule",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerRunViewGroupsMessagesByRuleTest::RunTest(const FString&)
+{
+    const auto FirstAsset =
+        RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("GroupAssetOne"));
+    const auto SecondAsset =
+        RuleRangerTests::NewNamedTransientObject<URuleRangerAutomationTestObject>(TEXT("GroupAssetTwo"));
+    const auto Rule = RuleRangerTests::NewNamedTransientObject<URuleRangerRule>(TEXT("GroupRule"));
+    if (!TestNotNull(TEXT("First asset should be created"), FirstAsset)
+        || !TestNotNull(TEXT("Second asset should be created"), SecondAsset)
+        || !TestNotNull(TEXT("Rule should be created"), Rule))
+    {
+        return false;
+    }
+
+    const auto Run = MakeShared<FRuleRangerRun>();
+    for (const auto Asset : { FirstAsset, SecondAsset })
+    {
+        const auto Row = RuleRangerToolTabSlateWidgetTests::MakeMessageRow(
+            ERuleRangerToolSeverity::Error,
+            *FString::Printf(TEXT("Asset %s is missing a tag"), *Asset->GetName()));
+        Row->Asset = Asset;
+        Row->Rule = Rule;
+        Run->Messages.Add(*Row);
+    }
+    Run->Messages.Add(
+        *RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Warning, TEXT("Unrelated")));
+
+    const auto View = SNew(SRuleRangerRunView).Run(Run);
+    View->SetSeverityFiltersForTest(true, true, true);
+    View->SetSortForTest(TEXT("Severity"), EColumnSortMode::Descending);
+    View->SetGroupByRuleForTest(true);
+
+    const auto Group = View->GetGroupForTest(0);
+    if (!TestEqual(TEXT("Messages that differ by asset name should share a group"), View->GetGroupCountForTest(), 2)
+        || !TestNotNull(TEXT("The first group should exist"), Group.Get()))
+    {
+        return false;
+    }
+
+    const bool bGroupContainsMessages =
+        TestEqual(TEXT("The group should contain both messages"), Group->MessageIndices.Num(), 2)
+        && TestTrue(TEXT("A collapsed group should not create message entries"),
+                    View->GetGroupChildrenForTest(Group).IsEmpty());
+
+    View->ToggleGroupExpansionForTest(Group);
+    const auto Children = View->GetGroupChildrenForTest(Group);
+    const bool bExpandedGroupCreatesEntries =
+        TestEqual(TEXT("An expanded group should create an entry per message"), Children.Num(), 2)
+        && TestEqual(TEXT("The entries should be in display order"), Children[0]->MessageIndex, 0);
+
+    // Context menu actions read the selection of the grouped view while grouping is enabled
+    View->SetGroupItemSelectionForTest(Group, true);
+    const auto SelectedRows = View->GetSelectedRowsForTest();
+    const bool bGroupSelectionSelectsMessages =
+        TestEqual(TEXT("Selecting a group should select each of its messages"), SelectedRows.Num(), 2)
+        && TestTrue(TEXT("The selected messages should reference their assets"),
+                    SelectedRows[0]->Asset.IsValid() && SelectedRows[1]->Asset.IsValid())
+        && TestNotNull(TEXT("The context menu should open in the grouped view"), View->OpenContextMenuForTest().Get());
+
+    View->SetGroupByRuleForTest(false);
+    const bool bFlatViewRestored =
+        TestEqual(TEXT("Disabling grouping should restore the flat rows"), View->GetFilteredItemCountForTest(), 3)
+        && TestTrue(TEXT("The flat view should not report the grouped selection"),
+                    View->GetSelectedRowsForTest().IsEmpty());
+
+    return bGroupContainsMessages && bExpandedGroupCreatesEntries && bGroupSelectionSelectsMessages
+        && bFlatViewRestored;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerToolPanelRunLabelTracksMessagesTest,
+                                 "RuleRanger.UI.ToolTab.SlateWidgets.ToolPanel.RunLabelTracksMessages",
+                                 RuleRangerTests::AutomationTestFlags)
+bool FRuleRangerToolPanelRunLabelTracksMessagesTest::RunTest(const FString&)
+{
+    const auto Run = MakeShared<FRuleRangerRun>();
+    Run->Title = FText::FromString(TEXT("Label Run"));
+
+    const bool bEmptyRunShowsTitle = TestEqual(TEXT("A run without messages should be labelled with its title"),
+                                               SRuleRangerToolPanel::GetRunLabelForTest(Run).ToString(),
+                                               FString(TEXT("Label Run")));
+
+    // Messages added by scan progress are reflected without rebuilding the run tabs
+    Run->Messages.Add(
+        *RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Error, TEXT("Label error")));
+    Run->Messages.Add(
+        *RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Info, TEXT("Label info")));
+    const bool bLabelIncludesCounts = TestEqual(TEXT("The label should include the count of each severity"),
+                                                SRuleRangerToolPanel::GetRunLabelForTest(Run).ToString(),
+                                                FString(TEXT("Label Run (E1 I1)")));
+
+    const bool bMissingRunIsEmpty = TestTrue(TEXT("A released run should have an empty label"),
+                                             SRuleRangerToolPanel::GetRunLabelForTest(nullptr).IsEmpty());
+
+    return bEmptyRunShowsTitle && bLabelIncludesCounts && bMissingRunIsEmpty;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerToolPanelManagesRunsAndRepeatedRefreshesTest,
                                  "RuleRanger.UI.ToolTab.SlateWidgets.ToolPanel.ManagesRunsAndRepeatedRefreshes",
                                  RuleRangerTests::AutomationTestFlags)
@@ -225,9 +437,9 @@ bool FRuleRangerToolPanelManagesRunsAndRepeatedRefreshesTest::RunTest(const FStr
         && TestEqual(TEXT("New runs should start without messages"), FirstRun->Messages.Num(), 0);
 
     FirstRun->Messages.Add(
-        RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Warning, TEXT("Panel warning")));
+        *RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Warning, TEXT("Panel warning")));
     FirstRun->Messages.Add(
-        RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Error, TEXT("Panel error")));
+        *RuleRangerToolTabSlateWidgetTests::MakeMessageRow(ERuleRangerToolSeverity::Error, TEXT("Panel error")));
     Panel->RebuildRunsUIForTest();
     Panel->RebuildRunContentsForTest();
     Panel->RebuildRunsUIForTest();
@@ -24,13 +24,21 @@ public:
     /** Ensure the asset registry has a complete global view before performing path/package lookups. */
     RULERANGER_API static void EnsureAssetRegistryReady();
 
-    /** Method to perform the rename of an asset. */
+    /**
+     * Method to perform the rename of an asset.
+     * If a rename batch is active then the rename is queued and performed when the batch executes.
+     */
     RULERANGER_API static bool RenameAsset(UObject* Object, const FString& NewName);
 
+    /** Return the name the asset will have once any queued rename is performed. */
+    RULERANGER_API static FString GetPendingAssetName(const UObject* Object);
+
+    /** Record a rename that was omitted as part of a dry run so that it appears in the rename plan. */
+    RULERANGER_API static void RecordPlannedRename(const UObject* Object, const FString& NewName);
+
     /**
      * Reduce raw asset-registry rows to one editor-facing representative asset per package.
-     * Redirectors
-     * are ignored and duplicates are suppressed in the output array.
+     * Redirectors are ignored and packages that already have an asset in the output array are skipped.
      */
     RULERANGER_API static void AddPackageRepresentativeAssets(const TArray<FAssetData>& CandidateAssets,
                                                               TArray<FAssetData>& OutAssets);
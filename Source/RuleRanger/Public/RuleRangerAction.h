@@ -46,4 +46,21 @@ public:
      * @return The Class that the Object must be an instance of.
      */
     virtual UClass* GetExpectedType() const;
+
+    /**
+     * Return true if the action should be given the chance to prepare the objects it will be applied to when
+     * a set of objects is scanned and fixed. See PrepareForFix().
+     *
+     * @return true if PrepareForFix() should be invoked, false otherwise.
+     */
+    virtual bool ShouldPrepareForFix() const;
+
+    /**
+     * Prepare the objects that this action will be applied to when a set of objects is scanned and fixed.
+     * This is invoked once before any rules are applied to the objects and allows an action to perform expensive
+     * work for all the objects at once (i.e. requesting compilation) rather than once per object in Apply().
+     *
+     * @param Objects the objects in the scan set that the action will be applied to.
+     */
+    virtual void PrepareForFix(TConstArrayView<UObject*> Objects);
 };
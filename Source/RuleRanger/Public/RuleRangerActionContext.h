@@ -15,6 +15,7 @@
 
 #include "CoreMinimal.h"
 #include "RuleRangerCommonContext.h"
+#include "RuleRangerObjectAnalysis.h"
 #include "UObject/Interface.h"
 #include "RuleRangerActionContext.generated.h"
 
@@ -77,6 +78,16 @@ private:
     UPROPERTY(VisibleAnywhere)
     ERuleRangerActionTrigger ActionTrigger{ ERuleRangerActionTrigger::AT_Max };
 
+    /** The object that the cached analyses were derived from. */
+    TWeakObjectPtr<UObject> AnalysisObject{ nullptr };
+
+    /**
+     * Derived data shared between the actions applied to AnalysisObject, keyed by analysis name.
+     * The analyses survive ClearContext() so that they are shared across every rule applied to the
+     * object and are discarded when a different object is analyzed or InvalidateObjectAnalyses() is invoked.
+     */
+    TMap<FName, TSharedPtr<FRuleRangerObjectAnalysis>> ObjectAnalyses;
+
 public:
     FORCEINLINE const URuleRangerRule* GetRule() const { return Rule; }
     FORCEINLINE const UObject* GetObject() const { return Object; }
@@ -101,4 +112,41 @@ public:
      * @return the trigger for the current action
      */
     FORCEINLINE ERuleRangerActionTrigger GetActionTrigger() const { return ActionTrigger; }
+
+    /**
+     * Return the analysis of the specified type for the object, computing it if it has not already been
+     * computed for the object during the current scan.
+     *
+     * @tparam T the type of analysis. Must extend FRuleRangerObjectAnalysis.
+     * @param InObject the object to analyze.
+     * @return the analysis.
+     */
+    template <typename T>
+    T& GetObjectAnalysis(UObject* InObject)
+    {
+        static_assert(TIsDerivedFrom<T, FRuleRangerObjectAnalysis>::Value,
+                      "T must be derived from FRuleRangerObjectAnalysis");
+        check(InObject);
+        if (AnalysisObject.Get() != InObject)
+        {
+            ObjectAnalyses.Reset();
+            AnalysisObject = InObject;
+        }
+        auto& Analysis = ObjectAnalyses.FindOrAdd(T::GetAnalysisName());
+        if (!Analysis.IsValid())
+        {
+            Analysis = MakeShared<T>(InObject);
+        }
+        return static_cast<T&>(*Analysis);
+    }
+
+    /**
+     * Discard any analyses cached for the current object.
+     * Actions that modify the object in a way that would change an analysis should invoke this method.
+     */
+    FORCEINLINE void InvalidateObjectAnalyses()
+    {
+        AnalysisObject.Reset();
+        ObjectAnalyses.Reset();
+    }
 };
@@ -35,4 +35,23 @@ public:
      * @return true if the asset is a match, false otherwise.
      */
     virtual bool Test(UObject* Object) const;
+
+    /**
+     * Return true if testing an object has no effect other than producing the result.
+     * The matchers of a rule are only evaluated in an order other than the authored order, and the result of a
+     * matcher is only reused for structurally equal matchers, if the matchers are side-effect free. Matchers must
+     * opt in as a matcher may rely on being evaluated after the matchers authored before it.
+     *
+     * @return true if the matcher can be evaluated in any order.
+     */
+    virtual bool IsSideEffectFree() const { return false; }
+
+    /**
+     * Append a description of the class and configuration of the matcher.
+     * Matchers with the same description produce the same result for an object. The default implementation
+     * describes every editable property, describing child matchers by their structure rather than their identity.
+     *
+     * @param OutStructure the string to append the description to.
+     */
+    virtual void AppendStructure(FString& OutStructure) const;
 };
@@ -0,0 +1,30 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Base class for data derived from an object that is expensive to compute and can be shared by every action
+ * that is applied to the object during a single scan.
+ *
+ * Subclasses MUST provide a constructor that accepts the object being analyzed as a UObject* and a static
+ * GetAnalysisName() function that returns a name unique to the analysis type.
+ * Instances are created on demand via URuleRangerActionContext::GetObjectAnalysis().
+ */
+class FRuleRangerObjectAnalysis
+{
+public:
+    virtual ~FRuleRangerObjectAnalysis() = default;
+};
@@ -36,4 +36,13 @@ public:
      * @param ActionContext the context in which the action is invoked.
      */
     virtual void Apply(URuleRangerProjectActionContext* ActionContext);
+
+    /**
+     * Return true if the action can be applied in report mode on a worker thread, concurrently with other
+     * project actions. A concurrency-safe action must only read state that report-mode project actions do not
+     * modify and must only report results through the ActionContext.
+     *
+     * @return true if the action can be applied concurrently in report mode.
+     */
+    virtual bool IsConcurrencySafe() const { return false; }
 };
@@ -22,6 +22,11 @@ class URuleRangerRuleSet;
 class URuleRangerConfig;
 class URuleRangerProjectRule;
 
+namespace RuleRanger::Traversal
+{
+    class FProjectRuleScheduler;
+} // namespace RuleRanger::Traversal
+
 UENUM()
 enum class ERuleRangerProjectActionTrigger : uint8
 {
@@ -48,6 +53,7 @@ class URuleRangerProjectActionContext final : public URuleRangerCommonContext
     friend class URuleRangerEditorSubsystem;
     friend class URuleRangerEditorValidator;
     friend class URuleRangerCommandlet;
+    friend class RuleRanger::Traversal::FProjectRuleScheduler;
 
 protected:
     virtual void ClearContext() override;
@@ -31,6 +31,9 @@ public class RuleRanger : ModuleRules
         // Clipboard (FPlatformApplicationMisc) lives in ApplicationCore
         PrivateDependencyModuleNames.Add("ApplicationCore");
 
+        // The commandlet server mode listens on a loopback socket
+        PrivateDependencyModuleNames.AddRange(new[] { "Networking", "Sockets" });
+
         PrivateIncludePathModuleNames.Add("MessageLog");
     }
 }
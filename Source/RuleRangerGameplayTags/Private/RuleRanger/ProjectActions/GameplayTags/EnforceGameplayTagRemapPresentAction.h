@@ -37,4 +37,5 @@ public:
     TArray<FString> DefaultTargets;
 
     virtual void Apply(URuleRangerProjectActionContext* ActionContext) override;
+    virtual bool IsConcurrencySafe() const override { return true; }
 };
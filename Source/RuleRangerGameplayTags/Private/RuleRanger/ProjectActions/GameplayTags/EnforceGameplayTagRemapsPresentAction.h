@@ -63,4 +63,5 @@ public:
     TArray<TObjectPtr<UDataTable>> RemapTables;
 
     virtual void Apply(URuleRangerProjectActionContext* ActionContext) override;
+    virtual bool IsConcurrencySafe() const override { return true; }
 };
@@ -28,4 +28,5 @@ class UEnforceGameplayTagRemapsSortedAction final : public URuleRangerProjectAct
 
 public:
     virtual void Apply(URuleRangerProjectActionContext* ActionContext) override;
+    virtual bool IsConcurrencySafe() const override { return true; }
 };
@@ -23,15 +23,13 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(EnsureNoMetaSoundSourceReferenceAction)
 
-class IAssetRegistry;
-
 namespace RuleRanger::MetaSoundAction
 {
-    UObject* TryLoadPackageRepresentativeAsset(const FName PackageName)
+    bool TryGetPackageRepresentativeAssetData(const FName PackageName, FAssetData& OutAssetData)
     {
         if (PackageName.IsNone())
         {
-            return nullptr;
+            return false;
         }
 
         const auto& AssetRegistry = FAssetRegistryModule::GetRegistry();
@@ -40,19 +38,26 @@ namespace RuleRanger::MetaSoundAction
         {
             TArray<FAssetData> RepresentativeAssets;
             FRuleRangerUtilities::AddPackageRepresentativeAssets(Assets, RepresentativeAssets);
-            for (const auto& Asset : RepresentativeAssets)
+            if (!RepresentativeAssets.IsEmpty())
             {
-                if (UObject* const Object = Asset.GetAsset())
-                {
-                    return Object;
-                }
+                OutAssetData = RepresentativeAssets[0];
+                return true;
             }
         }
 
+        // Only load the package as a last resort when the asset registry has no data for the package
         const FString PackageNameString = PackageName.ToString();
         const FString ObjectPath =
             FString::Printf(TEXT("%s.%s"), *PackageNameString, *FPackageName::GetShortName(PackageNameString));
-        return FSoftObjectPath(ObjectPath).TryLoad();
+        if (const auto Object = FSoftObjectPath(ObjectPath).TryLoad())
+        {
+            OutAssetData = FAssetData(Object);
+            return true;
+        }
+        else
+        {
+            return false;
+        }
     }
 
     bool ShouldIgnorePackageDependency(const FName PackageName)
@@ -69,32 +74,22 @@ UEnsureNoMetaSoundSourceReferenceAction::UEnsureNoMetaSoundSourceReferenceAction
     AllowList.Add(UMetaSoundSource::StaticClass());
 }
 
-bool UEnsureNoMetaSoundSourceReferenceAction::IsReferenceAllowed(const UObject* MetaSoundSource,
-                                                                 const UObject* Other) const
+bool UEnsureNoMetaSoundSourceReferenceAction::IsReferenceAllowed(const TSet<FSoftObjectPath>& AllowedPaths,
+                                                                 const FAssetData& MetaSoundSource,
+                                                                 const FAssetData& Other) const
 {
     // Allow if the referenced MetaSoundSource is a preset.
-    if (RuleRanger::MetaSound::IsPreset(CastChecked<UMetaSoundSource>(MetaSoundSource)))
+    if (RuleRanger::MetaSound::IsPreset(MetaSoundSource))
     {
         return true;
     }
-    if (const auto OtherMetaSoundSource = Cast<UMetaSoundSource>(Other))
+    // This means that the referencing object is a preset derived from this MetaSoundSource which is fine
+    if (Other.IsInstanceOf(UMetaSoundSource::StaticClass()) && RuleRanger::MetaSound::IsPreset(Other))
     {
-        // This means that the referencing object is a preset derived from this MetaSoundSource which is fine
-        if (RuleRanger::MetaSound::IsPreset(OtherMetaSoundSource))
-        {
-            return true;
-        }
+        return true;
     }
     // Allow if MetaSourceSource is in the allowlist
-    for (const auto& Allowed : AllowList)
-    {
-        const auto Object = Allowed.TryLoad();
-        if (IsValid(MetaSoundSource) && IsValid(Object) && MetaSoundSource == Object)
-        {
-            return true;
-        }
-    }
-    return false;
+    return AllowedPaths.Contains(MetaSoundSource.GetSoftObjectPath());
 }
 
 void UEnsureNoMetaSoundSourceReferenceAction::Apply(URuleRangerActionContext* ActionContext, UObject* Object)
@@ -106,6 +101,18 @@ void UEnsureNoMetaSoundSourceReferenceAction::Apply(URuleRangerActionContext* Ac
 
     const auto PackageName = FSoftObjectPath(Object).GetAssetPath().GetPackageName();
     const auto& AssetRegistry = FAssetRegistryModule::GetRegistry();
+    const FAssetData ObjectAssetData(Object);
+
+    // Resolve the allow list once rather than for every reference. Paths are compared so no asset is loaded.
+    TSet<FSoftObjectPath> AllowedPaths;
+    AllowedPaths.Reserve(AllowList.Num());
+    for (const auto& Allowed : AllowList)
+    {
+        if (!Allowed.IsNull())
+        {
+            AllowedPaths.Add(Allowed);
+        }
+    }
 
     if (Object->IsA(UMetaSoundSource::StaticClass()))
     {
@@ -114,8 +121,9 @@ void UEnsureNoMetaSoundSourceReferenceAction::Apply(URuleRangerActionContext* Ac
 
         for (const auto Referencer : Referencers)
         {
-            const auto Ref = RuleRanger::MetaSoundAction::TryLoadPackageRepresentativeAsset(Referencer);
-            if (Ref && !IsReferenceAllowed(Object, Ref))
+            FAssetData Ref;
+            if (RuleRanger::MetaSoundAction::TryGetPackageRepresentativeAssetData(Referencer, Ref)
+                && !IsReferenceAllowed(AllowedPaths, ObjectAssetData, Ref))
             {
                 FFormatNamedArguments Arguments;
                 Arguments.Add(TEXT("Object"), FText::FromString(Referencer.ToString()));
@@ -139,12 +147,14 @@ void UEnsureNoMetaSoundSourceReferenceAction::Apply(URuleRangerActionContext* Ac
         {
             if (!RuleRanger::MetaSoundAction::ShouldIgnorePackageDependency(Referencer))
             {
-                const auto Ref = RuleRanger::MetaSoundAction::TryLoadPackageRepresentativeAsset(Referencer);
-                if (Ref && Ref->IsA(UMetaSoundSource::StaticClass()) && !IsReferenceAllowed(Ref, Object))
+                FAssetData Ref;
+                if (RuleRanger::MetaSoundAction::TryGetPackageRepresentativeAssetData(Referencer, Ref)
+                    && Ref.IsInstanceOf(UMetaSoundSource::StaticClass())
+                    && !IsReferenceAllowed(AllowedPaths, Ref, ObjectAssetData))
                 {
                     FFormatNamedArguments Arguments;
                     Arguments.Add(TEXT("Object"), FText::FromString(GetNameSafe(Object)));
-                    Arguments.Add(TEXT("MetaSoundSource"), FText::FromString(GetNameSafe(Ref)));
+                    Arguments.Add(TEXT("MetaSoundSource"), FText::FromString(Ref.AssetName.ToString()));
 
                     ActionContext->Error(FText::Format(
                         NSLOCTEXT("RuleRanger",
@@ -17,6 +17,7 @@
 #include "RuleRangerAction.h"
 #include "EnsureNoMetaSoundSourceReferenceAction.generated.h"
 
+struct FAssetData;
 class UMetaSoundSource;
 class FObjectPreSaveContext;
 
@@ -48,5 +49,7 @@ private:
                       AllowPrivateAccess = true))
     TArray<FSoftObjectPath> AllowList;
 
-    bool IsReferenceAllowed(const UObject* MetaSoundSource, const UObject* Other) const;
+    bool IsReferenceAllowed(const TSet<FSoftObjectPath>& AllowedPaths,
+                            const FAssetData& MetaSoundSource,
+                            const FAssetData& Other) const;
 };
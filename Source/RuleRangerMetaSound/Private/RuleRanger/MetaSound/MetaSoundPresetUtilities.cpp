@@ -44,4 +44,19 @@ namespace RuleRanger::MetaSound
         return Source->GetConstDocument().RootGraph.PresetOptions.bIsPreset;
         PRAGMA_ENABLE_DEPRECATION_WARNINGS
     }
+
+    bool IsPreset(const FAssetData& AssetData)
+    {
+#if WITH_EDITORONLY_DATA
+        bool bAssetDataIsValid = false;
+        const FMetaSoundDocumentInfo AssetDocumentInfo(AssetData, bAssetDataIsValid);
+        if (bAssetDataIsValid)
+        {
+            return AssetDocumentInfo.bIsPreset != 0;
+        }
+#endif
+
+        // Fallback to loading the asset when the asset registry data is insufficient
+        return IsPreset(Cast<UMetaSoundSource>(AssetData.GetAsset()));
+    }
 } // namespace RuleRanger::MetaSound
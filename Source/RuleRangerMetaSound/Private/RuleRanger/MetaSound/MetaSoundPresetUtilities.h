@@ -13,9 +13,20 @@
  */
 #pragma once
 
+struct FAssetData;
 class UMetaSoundSource;
 
 namespace RuleRanger::MetaSound
 {
     bool IsPreset(const UMetaSoundSource* Source);
-}
+
+    /**
+     * Determine whether the MetaSoundSource described by the asset data is a preset.
+     * The preset status is read from the tags exported to the asset registry and the asset is only
+     * loaded if the tags are not present (i.e. the asset was saved before the tags were exported).
+     *
+     * @param AssetData the asset data of a MetaSoundSource.
+     * @return true if the MetaSoundSource is a preset, false otherwise.
+     */
+    bool IsPreset(const FAssetData& AssetData);
+} // namespace RuleRanger::MetaSound
@@ -16,12 +16,14 @@
     #include "AssetRegistry/AssetRegistryModule.h"
     #include "DocumentTemplates/MetasoundFrontendPresetTemplate.h"
     #include "HAL/FileManager.h"
+    #include "MetasoundAssetManager.h"
     #include "MetasoundSource.h"
     #include "Misc/AutomationTest.h"
     #include "Misc/PackageName.h"
     #include "Misc/Paths.h"
     #include "RuleRanger/Actions/MetaSound/EnsureMetaSoundAuthorBlankAction.h"
     #include "RuleRanger/Actions/MetaSound/EnsureNoMetaSoundSourceReferenceAction.h"
+    #include "RuleRanger/MetaSound/MetaSoundPresetUtilities.h"
     #include "RuleRanger/Matchers/MetaSound/MetasoundPresetMatcher.h"
     #include "RuleRangerAction.h"
     #include "RuleRangerActionContext.h"
@@ -351,6 +353,26 @@ namespace RuleRangerMetaSoundTests
         }
         return nullptr;
     }
+
+    bool TryGetRegistryAssetData(FAutomationTestBase& Test, const UObject* const Asset, FAssetData& OutAssetData)
+    {
+        const auto& AssetRegistry = FAssetRegistryModule::GetRegistry();
+        TArray<FAssetData> Assets;
+        AssetRegistry.GetAssetsByPackageName(Asset->GetPackage()->GetFName(), Assets, true);
+        if (Test.TestEqual(TEXT("Asset registry should describe the saved asset"), Assets.Num(), 1))
+        {
+            OutAssetData = Assets[0];
+            return true;
+        }
+        return false;
+    }
+
+    bool HasRegistryDocumentInfo(const FAssetData& AssetData)
+    {
+        bool bIsValid = false;
+        const FMetaSoundDocumentInfo DocumentInfo(AssetData, bIsValid);
+        return bIsValid;
+    }
 } // namespace RuleRangerMetaSoundTests
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerMetaSoundPresetMatcherAcceptsPresetSourceTest,
@@ -390,6 +412,38 @@ bool FRuleRangerMetaSoundPresetMatcherRejectsNullAndWrongTypeTest::RunTest(const
         && TestFalse(TEXT("Non-MetaSound objects should not match"), Matcher->Test(Object));
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerMetaSoundPresetUtilitiesReadsPresetFromAssetRegistryTest,
+                                 "RuleRanger.MetaSound.PresetUtilities.ReadsPresetFromAssetRegistry",
+                                 RuleRangerMetaSoundTests::AutomationTestFlags)
+bool FRuleRangerMetaSoundPresetUtilitiesReadsPresetFromAssetRegistryTest::RunTest(const FString&)
+{
+    using namespace RuleRangerMetaSoundTests;
+
+    const auto Preset =
+        NewPackagedMetaSoundSource(NewUniquePackageName(TEXT("RegistryPreset")), TEXT("RegistryPreset"), true);
+    const auto NonPreset =
+        NewPackagedMetaSoundSource(NewUniquePackageName(TEXT("RegistrySource")), TEXT("RegistrySource"), false);
+    FAssetData PresetData;
+    FAssetData NonPresetData;
+    if (TestNotNull(TEXT("Preset MetaSound source should be created"), Preset)
+        && TestNotNull(TEXT("Non-preset MetaSound source should be created"), NonPreset)
+        && SaveAssetAndRefreshAssetRegistry(*this, Preset) && SaveAssetAndRefreshAssetRegistry(*this, NonPreset)
+        && TryGetRegistryAssetData(*this, Preset, PresetData)
+        && TryGetRegistryAssetData(*this, NonPreset, NonPresetData))
+    {
+        // The tags must be present for the preset status to be read without loading the asset
+        return TestTrue(TEXT("Preset registry data should contain the document info"),
+                        HasRegistryDocumentInfo(PresetData))
+            && TestTrue(TEXT("Non-preset registry data should contain the document info"),
+                        HasRegistryDocumentInfo(NonPresetData))
+            && TestTrue(TEXT("Preset should be detected from registry data"),
+                        RuleRanger::MetaSound::IsPreset(PresetData))
+            && TestFalse(TEXT("Non-preset should be detected from registry data"),
+                         RuleRanger::MetaSound::IsPreset(NonPresetData));
+    }
+    return false;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRuleRangerEnsureMetaSoundAuthorBlankAllowsBlankAuthorTest,
                                  "RuleRanger.Actions.MetaSound.EnsureAuthorBlank.AllowsBlankAuthor",
                                  RuleRangerMetaSoundTests::AutomationTestFlags)
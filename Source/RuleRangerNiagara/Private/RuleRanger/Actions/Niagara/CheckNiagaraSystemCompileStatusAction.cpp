@@ -12,6 +12,7 @@
  * limitations under the License.
  */
 #include "CheckNiagaraSystemCompileStatusAction.h"
+#include "Misc/ScopedSlowTask.h"
 #include "NiagaraScript.h"
 #include "NiagaraScriptSource.h"
 #include "NiagaraSystem.h"
@@ -177,3 +178,50 @@ UClass* UCheckNiagaraSystemCompileStatusAction::GetExpectedType() const
 {
     return UNiagaraSystem::StaticClass();
 }
+
+bool UCheckNiagaraSystemCompileStatusAction::ShouldPrepareForFix() const
+{
+    return true;
+}
+
+void UCheckNiagaraSystemCompileStatusAction::PrepareForFix(const TConstArrayView<UObject*> Objects)
+{
+    // Request compilation of every system that needs it before waiting on any of them so that
+    // the scripts of all the systems are compiled concurrently rather than one system at a time
+    TArray<UNiagaraSystem*> Systems;
+    for (const auto Object : Objects)
+    {
+        // ReSharper disable once CppTooWideScopeInitStatement
+        const auto System = Cast<UNiagaraSystem>(Object);
+        if (System && System->NeedsRequestCompile())
+        {
+            if (!System->HasOutstandingCompilationRequests(true))
+            {
+                System->RequestCompile(false);
+            }
+            Systems.Add(System);
+        }
+    }
+
+    if (!Systems.IsEmpty())
+    {
+        LogInfo(FString::Printf(TEXT("Requested compilation of %d NiagaraSystem(s) before applying rules."),
+                                Systems.Num()));
+
+        FScopedSlowTask SlowTask(Systems.Num(),
+                                 NSLOCTEXT("RuleRanger",
+                                           "NiagaraSystemsCompiling",
+                                           "Rule Ranger: Waiting for NiagaraSystems to compile"));
+        SlowTask.MakeDialogDelayed(.5f);
+        for (const auto System : Systems)
+        {
+            SlowTask.EnterProgressFrame(
+                1,
+                FText::Format(NSLOCTEXT("RuleRanger",
+                                        "NiagaraSystemCompiling",
+                                        "Rule Ranger: Waiting for NiagaraSystem {0} to compile"),
+                              FText::FromString(System->GetName())));
+            System->WaitForCompilationComplete(true);
+        }
+    }
+}
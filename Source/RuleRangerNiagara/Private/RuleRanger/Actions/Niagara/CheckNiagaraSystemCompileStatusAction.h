@@ -55,4 +55,8 @@ public:
     virtual void Apply(URuleRangerActionContext* ActionContext, UObject* Object) override;
 
     virtual UClass* GetExpectedType() const override;
+
+    virtual bool ShouldPrepareForFix() const override;
+
+    virtual void PrepareForFix(TConstArrayView<UObject*> Objects) override;
 };
@@ -14,6 +14,7 @@
 
 import argparse
 import json
+import socket
 import subprocess
 import sys
 import tempfile
@@ -24,7 +25,13 @@ from unreal_locator import find_unreal_home, get_unreal_commands
 DEFAULT_REPORT_PATH = Path("Saved/AutomationReports/RuleRangerAssetCheck/report.json")
 DEFAULT_LOG_PATH = Path("Saved/Logs/RuleRangerAssetCheck.log")
 DEFAULT_OUTPUT_LOG_PATH = Path("Saved/Logs/RuleRangerAssetCheckOutput.log")
+DEFAULT_SERVER_LOG_PATH = Path("Saved/Logs/RuleRangerServer.log")
+DEFAULT_SERVER_OUTPUT_LOG_PATH = Path("Saved/Logs/RuleRangerServerOutput.log")
 PACKAGE_LIST_LIMIT = 5
+DEFAULT_SERVER_PORT = 47820
+SERVER_HOST = "127.0.0.1"
+SERVER_CONNECT_TIMEOUT_SECONDS = 1.0
+SERVER_RESPONSE_TIMEOUT_SECONDS = 600.0
 
 
 def parse_args() -> argparse.Namespace:
@@ -33,6 +40,21 @@ def parse_args() -> argparse.Namespace:
     parser.add_argument("--staged-only", action="store_true", help="Only analyze staged assets")
     parser.add_argument("--report", type=str, help="Path to the JSON report")
     parser.add_argument("--asset-path", type=str, help="Additional asset paths to analyze")
+    parser.add_argument(
+        "--include-referencers",
+        type=int,
+        default=0,
+        metavar="DEPTH",
+        help="Also analyze the assets that reference the staged assets, up to DEPTH levels of referencers",
+    )
+    parser.add_argument(
+        "--server",
+        action="store_true",
+        help="Send the check to a running RuleRanger server, running the commandlet if no server is running",
+    )
+    parser.add_argument("--server-port", type=int, default=DEFAULT_SERVER_PORT, help="The RuleRanger server port")
+    parser.add_argument("--start-server", action="store_true", help="Start a RuleRanger server in the background")
+    parser.add_argument("--stop-server", action="store_true", help="Stop a running RuleRanger server")
     parser.add_argument("files", type=str, nargs="*", help="The files to analyze")
     return parser.parse_args()
 
@@ -228,10 +250,91 @@ def build_command(
     ]
 
 
+def format_server_request(command_args: list[str]) -> str:
+    # The server parses the request as a commandlet command line so values containing spaces are quoted
+    formatted_args: list[str] = []
+    for command_arg in command_args:
+        if " " in command_arg and "=" in command_arg:
+            key, value = command_arg.split("=", 1)
+            formatted_args.append(f'{key}="{value}"')
+        else:
+            formatted_args.append(command_arg)
+    return " ".join(formatted_args)
+
+
+def send_server_request(port: int, request: str) -> dict | None:
+    """Send a request to a RuleRanger server and return the response or None if no server is running."""
+    try:
+        with socket.create_connection((SERVER_HOST, port), timeout=SERVER_CONNECT_TIMEOUT_SECONDS) as connection:
+            connection.settimeout(SERVER_RESPONSE_TIMEOUT_SECONDS)
+            connection.sendall(f"{request}\n".encode("utf-8"))
+            response = bytearray()
+            while not response.endswith(b"\n"):
+                chunk = connection.recv(65536)
+                if not chunk:
+                    break
+                response.extend(chunk)
+    except OSError:
+        return None
+
+    try:
+        return json.loads(response.decode("utf-8"))
+    except (UnicodeDecodeError, json.JSONDecodeError):
+        return None
+
+
+def run_server_check(port: int, command_args: list[str], report_path: Path) -> int | None:
+    """Run the check on a RuleRanger server and write the report it returns, or return None if no server is running."""
+    # The server rejects options that write files so the report is returned in the response and written here
+    response = send_server_request(port, format_server_request(command_args))
+    if response is None:
+        return None
+
+    return_code = int(response.pop("ExitCode", 1))
+    if "Error" in response:
+        print(f"RuleRanger server error: {response['Error']}", file=sys.stderr)
+    elif "Summary" in response:
+        with report_path.open("w", encoding="utf-8") as report_file:
+            json.dump(response, report_file, indent=2)
+    return return_code
+
+
+def start_server(repo_root: Path, uproject: Path, editor_cmd: Path, port: int) -> int:
+    log_path = (repo_root / DEFAULT_SERVER_LOG_PATH).resolve()
+    output_log_path = (repo_root / DEFAULT_SERVER_OUTPUT_LOG_PATH).resolve()
+    output_log_path.parent.mkdir(parents=True, exist_ok=True)
+
+    # The argument file is left in place as the server outlives this script
+    with tempfile.NamedTemporaryFile("w", delete=False, suffix=".txt", encoding="utf-8") as argfile:
+        for server_arg in ["-run=RuleRanger", "-server", f"-serverPort={port}"]:
+            argfile.write(f"{server_arg}\n")
+        argfile_path = Path(argfile.name).resolve()
+
+    report_path = resolve_report_path(repo_root, None)
+    command = build_command(editor_cmd, uproject, log_path, report_path, argfile_path)
+    with output_log_path.open("w", encoding="utf-8") as output_log_file:
+        subprocess.Popen(
+            command,
+            cwd=repo_root,
+            stdout=output_log_file,
+            stderr=subprocess.STDOUT,
+            start_new_session=True,
+        )
+    print(f"Starting RuleRanger server on port {port}. Output Log: {rel_posix_path(output_log_path, repo_root)}")
+    return 0
+
+
 def main() -> int:
     args = parse_args()
     repo_root = Path.cwd().resolve()
 
+    if args.stop_server:
+        if send_server_request(args.server_port, "-shutdown") is None:
+            print(f"No RuleRanger server is listening on port {args.server_port}")
+        else:
+            print(f"Stopped RuleRanger server on port {args.server_port}")
+        return 0
+
     if args.staged_only and args.asset_path:
         print("--staged-only is not compatible with --asset-path", file=sys.stderr)
         return 1
@@ -247,6 +350,9 @@ def main() -> int:
         print(f"An error occurred: {error}", file=sys.stderr)
         return 1
 
+    if args.start_server:
+        return start_server(repo_root, uproject, editor_cmd, args.server_port)
+
     asset_packages: list[str] = []
     asset_paths: list[str] = []
 
@@ -266,30 +372,41 @@ def main() -> int:
     log_path, output_log_path = resolve_log_paths(repo_root)
     clean_output_paths(report_path, log_path, output_log_path)
 
-    command_args = ["-run=RuleRanger", f"-report={report_path}"]
+    command_args = ["-run=RuleRanger"]
     if asset_packages:
         command_args.append(f"-packages={','.join(asset_packages)}")
+        if args.include_referencers > 0:
+            command_args.append(f"-includeReferencers={args.include_referencers}")
     if asset_paths:
         command_args.append(f"-paths={','.join(asset_paths)}")
     command_args.append("-quiet")
 
     with tempfile.NamedTemporaryFile("w", delete=False, suffix=".txt", encoding="utf-8") as argfile:
-        for command_arg in command_args:
+        for command_arg in [*command_args, f"-report={report_path}"]:
             argfile.write(f"{command_arg}\n")
         argfile_path = Path(argfile.name).resolve()
 
     command = build_command(editor_cmd, uproject, log_path, report_path, argfile_path)
 
+    server_return_code = None
+    if args.server:
+        server_return_code = run_server_check(args.server_port, command_args, report_path)
+        if server_return_code is not None:
+            command = [f"{SERVER_HOST}:{args.server_port}", *command_args]
+
     try:
-        with output_log_path.open("w", encoding="utf-8") as output_log_file:
-            process = subprocess.run(
-                command,
-                cwd=repo_root,
-                check=False,
-                stdout=output_log_file,
-                stderr=subprocess.STDOUT,
-                text=True,
-            )
+        if server_return_code is not None:
+            return_code = server_return_code
+        else:
+            with output_log_path.open("w", encoding="utf-8") as output_log_file:
+                return_code = subprocess.run(
+                    command,
+                    cwd=repo_root,
+                    check=False,
+                    stdout=output_log_file,
+                    stderr=subprocess.STDOUT,
+                    text=True,
+                ).returncode
     finally:
         argfile_path.unlink(missing_ok=True)
 
@@ -319,7 +436,7 @@ def main() -> int:
         print(f"\n  Report Error: {report_error}", flush=True)
         return 1
 
-    return process.returncode
+    return return_code
 
 
 if __name__ == "__main__":
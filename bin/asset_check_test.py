@@ -0,0 +1,94 @@
+#!/usr/bin/env python
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import json
+import socket
+import tempfile
+import threading
+import unittest
+from pathlib import Path
+
+import asset_check
+
+
+class StubServer:
+    """Serves a single request with a canned response, as a RuleRanger server does."""
+
+    def __init__(self, response: dict) -> None:
+        self.response = response
+        self.request: str | None = None
+        self.listener = socket.create_server((asset_check.SERVER_HOST, 0))
+        self.port = self.listener.getsockname()[1]
+        self.thread = threading.Thread(target=self.serve, daemon=True)
+        self.thread.start()
+
+    def serve(self) -> None:
+        connection, _ = self.listener.accept()
+        with connection:
+            request = bytearray()
+            while not request.endswith(b"\n"):
+                chunk = connection.recv(4096)
+                if not chunk:
+                    break
+                request.extend(chunk)
+            self.request = request.decode("utf-8").rstrip("\n")
+            connection.sendall(f"{json.dumps(self.response)}\n".encode("utf-8"))
+
+    def close(self) -> None:
+        self.thread.join(timeout=5)
+        self.listener.close()
+
+
+class RunServerCheckTest(unittest.TestCase):
+    def setUp(self) -> None:
+        self.directory = tempfile.TemporaryDirectory()
+        self.report_path = Path(self.directory.name) / "report.json"
+        self.command_args = ["-run=RuleRanger", "-packages=/Game/Rock", "-quiet"]
+
+    def tearDown(self) -> None:
+        self.directory.cleanup()
+
+    def test_writes_report_returned_by_server(self) -> None:
+        report = {"Summary": {"AssetsScanned": 1, "Errors": 1}, "AssetRuleResults": [], "ProjectRuleResults": []}
+        server = StubServer({**report, "ExitCode": 1})
+        try:
+            return_code = asset_check.run_server_check(server.port, self.command_args, self.report_path)
+        finally:
+            server.close()
+
+        self.assertEqual(1, return_code)
+        self.assertEqual("-run=RuleRanger -packages=/Game/Rock -quiet", server.request)
+        self.assertEqual(report, asset_check.load_report(self.report_path))
+
+    def test_rejected_request_writes_no_report(self) -> None:
+        server = StubServer({"ExitCode": 1, "Error": "The -report option is not supported by server requests"})
+        try:
+            return_code = asset_check.run_server_check(server.port, self.command_args, self.report_path)
+        finally:
+            server.close()
+
+        self.assertEqual(1, return_code)
+        self.assertFalse(self.report_path.exists())
+
+    def test_returns_none_without_server(self) -> None:
+        # Bind and release a port so that nothing is listening on it
+        with socket.create_server((asset_check.SERVER_HOST, 0)) as listener:
+            port = listener.getsockname()[1]
+
+        self.assertIsNone(asset_check.run_server_check(port, self.command_args, self.report_path))
+        self.assertFalse(self.report_path.exists())
+
+
+if __name__ == "__main__":
+    unittest.main()